@@ -6,6 +6,12 @@
  * @brief Math objects hasher warehouse.
  */
 
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
 #include <boost/container_hash/hash.hpp>
 #include <math/types.h>
 #include <utils/constants.h>
@@ -13,45 +19,187 @@
 namespace math
 {
 
+    namespace detail
+    {
+        // Mixing constants of wyhash
+        inline constexpr std::uint64_t hash_secret[4] = {0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL};
+
+        // Scale applied to floating point coefficients before they are truncated - one unit per `floating_point_precision`
+        inline constexpr double hash_scale = 1.0 / utils::floating_point_precision;
+
+        // Largest magnitude of a scaled coefficient that still converts to a 64 bit integer
+        inline constexpr double hash_limit = 9.2e18;
+
+        // Multiply two words into 128 bits and fold the halves together
+        inline std::uint64_t hash_mix(const std::uint64_t lhs, const std::uint64_t rhs)
+        {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+            return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#else
+            const std::uint64_t lhs_low = lhs & 0xffffffffULL, lhs_high = lhs >> 32;
+            const std::uint64_t rhs_low = rhs & 0xffffffffULL, rhs_high = rhs >> 32;
+            const std::uint64_t low_low = lhs_low * rhs_low, low_high = lhs_low * rhs_high;
+            const std::uint64_t high_low = lhs_high * rhs_low, high_high = lhs_high * rhs_high;
+            const std::uint64_t middle = (low_low >> 32) + (low_high & 0xffffffffULL) + (high_low & 0xffffffffULL);
+            const std::uint64_t low = (middle << 32) | (low_low & 0xffffffffULL);
+            const std::uint64_t high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+            return low ^ high;
+#endif
+        }
+
+        // Quantize a coefficient to one word - floating point values are truncated to a multiple of `floating_point_precision`
+        template <typename T>
+        inline std::uint64_t hash_quantize(const T &value)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                return static_cast<std::uint64_t>(static_cast<std::int64_t>(std::clamp(static_cast<double>(value) * hash_scale, -hash_limit, hash_limit)));
+            }
+            else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+            {
+                return static_cast<std::uint64_t>(value);
+            }
+            else
+            {
+                return static_cast<std::uint64_t>(boost::hash_value(value));
+            }
+        }
+
+        // Hash `count` words of a `rows` row matrix, two words per multiply on two independent lanes - `word(i)` returns the
+        // i-th quantized coefficient
+        template <typename F>
+        inline std::size_t hash_words(const std::size_t rows, const std::size_t count, const std::size_t seed, F &&word)
+        {
+            std::uint64_t state = hash_mix(static_cast<std::uint64_t>(seed) ^ hash_secret[0], static_cast<std::uint64_t>(rows) ^ hash_secret[1]);
+            std::uint64_t other_state = state ^ hash_secret[2];
+            std::size_t idx = 0;
+            for (; idx + 4 <= count; idx += 4)
+            {
+                state = hash_mix(word(idx) ^ hash_secret[1], word(idx + 1) ^ state);
+                other_state = hash_mix(word(idx + 2) ^ hash_secret[2], word(idx + 3) ^ other_state);
+            }
+            for (; idx + 2 <= count; idx += 2)
+            {
+                state = hash_mix(word(idx) ^ hash_secret[1], word(idx + 1) ^ state);
+            }
+            if (idx < count)
+            {
+                state = hash_mix(word(idx) ^ hash_secret[1], state ^ hash_secret[2]);
+            }
+            return static_cast<std::size_t>(hash_mix(state ^ hash_secret[3], other_state ^ static_cast<std::uint64_t>(count) ^ hash_secret[1]));
+        }
+    }
+
     /**
-     * @struct MatrixHasher
-     * @brief This struct represents a hasher for the `Matrix` type.
-     * @tparam T Type.
-     * @tparam R Rows.
-     * @tparam C Columns.
+     * @struct DenseHasher
+     * @brief This struct represents a hasher for any dense `Eigen` matrix or vector, including dynamic size ones. Floating
+     * point coefficients are truncated to multiples of `utils::floating_point_precision` and the quantized buffer is
+     * hashed two 64 bit words at a time with the 128 bit multiply and fold mixing of wyhash. The shape is part of the hash, so a
+     * dynamic matrix and its reshaped copy hash differently. Expressions are evaluated before they are hashed.
      */
-    template <typename T, unsigned int R, unsigned int C>
-    struct MatrixHasher
+    struct DenseHasher
     {
         /**
-         * @brief Hash the matrix type and return the hash value of the matrix.
+         * @brief Hash a dense matrix and return the hash value of the matrix.
+         * @tparam Derived Eigen matrix or expression type.
          * @param matrix matrix to hash.
-         * @param seed seed value for the hash - seed will be alterd by the boost library - default is 42.
+         * @param seed seed value for the hash - default is 42.
          * @return std::size_t - hash value of the matrix.
          */
-        std::size_t operator()(const Matrix<T, R, C> &matrix, std::size_t seed = 42) const
+        template <typename Derived>
+        std::size_t operator()(const Eigen::DenseBase<Derived> &matrix, const std::size_t seed = 42) const
         {
-            if constexpr (std::is_floating_point_v<T>)
+            const auto &evaluated = matrix.derived().eval();
+            const auto *data = evaluated.data();
+            return detail::hash_words(static_cast<std::size_t>(evaluated.rows()), static_cast<std::size_t>(evaluated.size()), seed,
+                                      [data](const std::size_t idx)
+                                      { return detail::hash_quantize(data[idx]); });
+        }
+
+        /**
+         * @brief Hash every column of a matrix in one call - `hashes[j]` equals the hash of `columns.col(j)` on its own.
+         * Floating point columns are quantized a block at a time with vectorized `Eigen` expressions before they are mixed.
+         * @tparam Derived Eigen matrix or expression type.
+         * @param columns matrix holding one state per column.
+         * @param hashes output - one hash per column (size must be `columns.cols()`).
+         * @param seed seed value for the hash - default is 42.
+         */
+        template <typename Derived>
+        void hash_columns(const Eigen::DenseBase<Derived> &columns,
+                          std::span<std::size_t> hashes,
+                          const std::size_t seed = 42) const
+        {
+            using Scalar = typename Derived::Scalar;
+            if (hashes.size() != static_cast<std::size_t>(columns.cols()))
+            {
+                throw std::invalid_argument("DenseHasher needs one output hash per column");
+            }
+            const std::size_t rows = static_cast<std::size_t>(columns.rows());
+            if constexpr (std::is_floating_point_v<Scalar>)
             {
-                for (unsigned int r = 0; r < R; ++r)
+                // Blocks of about 32 KiB of quantized words
+                const Eigen::Index block_size = static_cast<Eigen::Index>(std::max<std::size_t>(4096 / std::max<std::size_t>(rows, 1), 1));
+                Eigen::ArrayXXd scaled;
+                for (Eigen::Index begin = 0; begin < columns.cols(); begin += block_size)
                 {
-                    for (unsigned int c = 0; c < C; ++c)
+                    const Eigen::Index num_columns = std::min(block_size, columns.cols() - begin);
+                    scaled = (columns.derived().middleCols(begin, num_columns).template cast<double>().array() * detail::hash_scale)
+                                 .max(-detail::hash_limit)
+                                 .min(detail::hash_limit);
+                    for (Eigen::Index col = 0; col < num_columns; ++col)
                     {
-                        boost::hash_combine(seed, static_cast<long long int>(matrix(r, c) / utils::floating_point_precision));
+                        const double *data = scaled.col(col).data();
+                        hashes[static_cast<std::size_t>(begin + col)] = detail::hash_words(rows, rows, seed, [data](const std::size_t idx)
+                                                                                            { return static_cast<std::uint64_t>(static_cast<std::int64_t>(data[idx])); });
                     }
                 }
             }
             else
             {
-                for (unsigned int r = 0; r < R; ++r)
+                const auto &evaluated = columns.derived().eval();
+                for (Eigen::Index col = 0; col < evaluated.cols(); ++col)
                 {
-                    for (unsigned int c = 0; c < C; ++c)
-                    {
-                        boost::hash_combine(seed, matrix(r, c));
-                    }
+                    hashes[static_cast<std::size_t>(col)] = detail::hash_words(rows, rows, seed, [&evaluated, col](const std::size_t idx)
+                                                                               { return detail::hash_quantize(evaluated(static_cast<Eigen::Index>(idx), col)); });
                 }
             }
-            return seed;
+        }
+    };
+
+    /**
+     * @struct MatrixHasher
+     * @brief This struct represents a hasher for the `Matrix` type (see `DenseHasher`).
+     * @tparam T Type.
+     * @tparam R Rows.
+     * @tparam C Columns.
+     */
+    template <typename T, unsigned int R, unsigned int C>
+    struct MatrixHasher
+    {
+        /**
+         * @brief Hash the matrix type and return the hash value of the matrix.
+         * @param matrix matrix to hash.
+         * @param seed seed value for the hash - default is 42.
+         * @return std::size_t - hash value of the matrix.
+         */
+        std::size_t operator()(const Matrix<T, R, C> &matrix, const std::size_t seed = 42) const
+        {
+            return DenseHasher()(matrix, seed);
+        }
+
+        /**
+         * @brief Hash N column vectors in one call - `hashes[j]` equals the hash of `columns.col(j)` on its own.
+         * @param columns column vectors, one per column.
+         * @param hashes output - one hash per column (size must be `columns.cols()`).
+         * @param seed seed value for the hash - default is 42.
+         */
+        void hash_columns(const ColumnVectors<T, R> &columns,
+                          std::span<std::size_t> hashes,
+                          const std::size_t seed = 42) const
+            requires(C == 1U)
+        {
+            DenseHasher().hash_columns(columns, hashes, seed);
         }
     };
 
@@ -36,6 +36,21 @@ namespace math
     template <typename T, unsigned int R, unsigned int C>
     using Matrix = Eigen::Matrix<T, R, C>;
 
+    /**
+     * @brief Column major matrix with a dynamic number of rows and columns
+     * @tparam T Type.
+     */
+    template <typename T>
+    using DynamicMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+
+    /**
+     * @brief Column major matrix of a dynamic number of column vectors
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    using ColumnVectors = Eigen::Matrix<T, D, Eigen::Dynamic>;
+
 } // namespace math
 
 #endif // MATH_TYPES_H
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef MATH_TEST_HASHER_H
+#define MATH_TEST_HASHER_H
+
+/**
+ * @file hasher_test.h
+ * @brief Contains the declarations for testing the hashers. Use this to define your helpers.
+ */
+
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include <math/hasher.h>
+
+namespace math
+{
+
+    namespace math_hasher_tests
+    {
+        struct HasherTestParameters
+        {
+            const Eigen::Index rows;    // Number of rows of every column
+            const Eigen::Index columns; // Number of columns hashed at once
+            const std::size_t seed;     // Seed of the hash
+        };
+
+        /**
+         * @class HasherTest
+         * @brief This class is a test fixture for testing the hashers.
+         * It fills integer and floating point matrices with random columns - a third of the floating point coefficients sit
+         * within a hair of a quantization boundary (a multiple of `utils::floating_point_precision`) on either side.
+         */
+        class HasherTest : public ::testing::TestWithParam<HasherTestParameters>
+        {
+        protected:
+            DynamicMatrix<int> int_columns;       // Integer columns
+            DynamicMatrix<double> double_columns; // Floating point columns
+            DynamicMatrix<float> float_columns;   // Single precision columns
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                HasherTestParameters props = GetParam();
+                std::mt19937 generator(7);
+                std::uniform_int_distribution<int> int_distribution(-1000000, 1000000);
+                std::uniform_real_distribution<double> real_distribution(-1000.0, 1000.0);
+                std::uniform_int_distribution<int> kind_distribution(0, 2);
+                int_columns.resize(props.rows, props.columns);
+                double_columns.resize(props.rows, props.columns);
+                float_columns.resize(props.rows, props.columns);
+                for (Eigen::Index col = 0; col < props.columns; ++col)
+                {
+                    for (Eigen::Index row = 0; row < props.rows; ++row)
+                    {
+                        int_columns(row, col) = int_distribution(generator);
+                        double value = real_distribution(generator);
+                        const int kind = kind_distribution(generator);
+                        if (kind != 0)
+                        {
+                            // Snap to a quantization boundary and step off it by a few ulps
+                            const double boundary = std::round(value / utils::floating_point_precision) * utils::floating_point_precision;
+                            value = std::nextafter(std::nextafter(boundary, kind == 1 ? -2000.0 : 2000.0), kind == 1 ? -2000.0 : 2000.0);
+                        }
+                        double_columns(row, col) = value;
+                        float_columns(row, col) = static_cast<float>(value);
+                    }
+                }
+            }
+        };
+    }
+
+} // namespace math
+
+#endif // MATH_TEST_HASHER_H
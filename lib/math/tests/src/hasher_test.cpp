@@ -0,0 +1,151 @@
+/**
+ * @file hasher_test.cpp
+ * @brief Unit tests for the hashers.
+ */
+
+#include <gtest/gtest.h>
+#include <hasher_test.h>
+
+namespace math
+{
+    namespace math_hasher_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            HasherTestSuite,
+            HasherTest,
+            ::testing::Values(
+                HasherTestParameters{
+                    1,   // Number of rows of every column
+                    5,   // Number of columns hashed at once
+                    42}, // Seed of the hash
+                HasherTestParameters{
+                    3,
+                    200,
+                    0},
+                HasherTestParameters{
+                    4,
+                    1500, // More than one quantization block of the floating point path
+                    7},
+                HasherTestParameters{
+                    7,
+                    64,
+                    12345},
+                HasherTestParameters{
+                    9000, // Columns longer than a quantization block
+                    3,
+                    42}));
+
+        TEST_P(HasherTest, ColumnHashesMatchSingleHashes)
+        {
+            // Get the parameters for the test
+            HasherTestParameters props = GetParam();
+            std::vector<std::size_t> hashes(static_cast<std::size_t>(props.columns));
+            DenseHasher hasher;
+            hasher.hash_columns(int_columns, hashes, props.seed);
+            for (Eigen::Index col = 0; col < props.columns; ++col)
+            {
+                EXPECT_EQ(hashes[col], hasher(int_columns.col(col), props.seed)) << "Integer column " << col << " hashes differently on its own";
+            }
+            hasher.hash_columns(double_columns, hashes, props.seed);
+            for (Eigen::Index col = 0; col < props.columns; ++col)
+            {
+                EXPECT_EQ(hashes[col], hasher(double_columns.col(col), props.seed)) << "Floating point column " << col << " hashes differently on its own";
+            }
+            hasher.hash_columns(float_columns, hashes, props.seed);
+            for (Eigen::Index col = 0; col < props.columns; ++col)
+            {
+                EXPECT_EQ(hashes[col], hasher(float_columns.col(col), props.seed)) << "Single precision column " << col << " hashes differently on its own";
+            }
+            // Hashing a block of columns matches hashing the columns one by one
+            const Eigen::Index num_columns = props.columns / 2;
+            std::vector<std::size_t> block_hashes(static_cast<std::size_t>(num_columns));
+            hasher.hash_columns(double_columns.rightCols(num_columns), block_hashes, props.seed);
+            for (Eigen::Index col = 0; col < num_columns; ++col)
+            {
+                EXPECT_EQ(block_hashes[col], hasher(double_columns.col(props.columns - num_columns + col), props.seed));
+            }
+            EXPECT_THROW(hasher.hash_columns(double_columns, std::span<std::size_t>(hashes).first(hashes.size() - 1), props.seed), std::invalid_argument);
+        }
+
+        TEST(HasherQuantizationTest, QuantizationBoundaries)
+        {
+            DenseHasher hasher;
+            // Values within one quantization step hash the same, values on either side of a boundary do not
+            const double boundary = 1234 * utils::floating_point_precision;
+            ColumnVector<double, 2> below;
+            below << boundary - 0.25 * utils::floating_point_precision, 1.0;
+            ColumnVector<double, 2> above;
+            above << boundary + 0.25 * utils::floating_point_precision, 1.0;
+            ColumnVector<double, 2> just_above;
+            just_above << boundary + 0.75 * utils::floating_point_precision, 1.0;
+            EXPECT_NE(hasher(below), hasher(above));
+            EXPECT_EQ(hasher(above), hasher(just_above));
+            // Huge values are clamped rather than overflowing
+            ColumnVector<double, 2> huge;
+            huge << 1e300, -1e300;
+            ColumnVectors<double, 2> columns(2, 4);
+            columns << below, above, just_above, huge;
+            std::vector<std::size_t> hashes(4);
+            hasher.hash_columns(columns, hashes);
+            EXPECT_EQ(hashes[0], hasher(below));
+            EXPECT_EQ(hashes[1], hasher(above));
+            EXPECT_EQ(hashes[2], hasher(just_above));
+            EXPECT_EQ(hashes[3], hasher(huge));
+        }
+
+        TEST(HasherSeedAndShapeTest, SeedAndShapeChangeTheHash)
+        {
+            DenseHasher hasher;
+            DynamicMatrix<int> matrix(2, 6);
+            matrix << 1, 2, 3, 4, 5, 6,
+                7, 8, 9, 10, 11, 12;
+            EXPECT_EQ(hasher(matrix, 1), hasher(matrix, 1));
+            EXPECT_NE(hasher(matrix, 1), hasher(matrix, 2));
+            EXPECT_NE(hasher(matrix), hasher(matrix, 0));
+            // Same coefficients in memory order, different shape
+            const DynamicMatrix<int> reshaped = matrix.reshaped(3, 4);
+            const DynamicMatrix<int> flat = matrix.reshaped(12, 1);
+            EXPECT_NE(hasher(matrix), hasher(reshaped));
+            EXPECT_NE(hasher(matrix), hasher(flat));
+            EXPECT_NE(hasher(reshaped), hasher(flat));
+            // Seeds are applied per column by `hash_columns` too
+            std::vector<std::size_t> seeded(6);
+            std::vector<std::size_t> other_seeded(6);
+            hasher.hash_columns(matrix, seeded, 1);
+            hasher.hash_columns(matrix, other_seeded, 2);
+            for (std::size_t col = 0; col < seeded.size(); ++col)
+            {
+                EXPECT_NE(seeded[col], other_seeded[col]);
+            }
+        }
+
+        TEST(HasherOverloadTest, MatrixAndColumnVectorsOverloadsAgree)
+        {
+            using T = double;
+            constexpr unsigned int D = 3;
+            Matrix<T, 2, 3> matrix;
+            matrix << 0.5, -1.25, 3.0,
+                1e-7, 2.0, -4.5;
+            EXPECT_EQ((MatrixHasher<T, 2, 3>()(matrix)), DenseHasher()(matrix));
+            EXPECT_EQ((MatrixHasher<T, 2, 3>()(matrix, 9)), DenseHasher()(matrix, 9));
+            RowVector<T, D> row_vector = matrix.row(0);
+            EXPECT_EQ((RowVectorHasher<T, D>()(row_vector)), DenseHasher()(row_vector));
+            ColumnVectors<T, D> columns(D, 10);
+            for (Eigen::Index col = 0; col < columns.cols(); ++col)
+            {
+                columns.col(col) << static_cast<T>(col) * 0.1, -static_cast<T>(col), static_cast<T>(col * col) / 3.0;
+            }
+            std::vector<std::size_t> hashes(static_cast<std::size_t>(columns.cols()));
+            std::vector<std::size_t> dense_hashes(static_cast<std::size_t>(columns.cols()));
+            ColumnVectorHasher<T, D> hasher;
+            hasher.hash_columns(columns, hashes, 5);
+            DenseHasher().hash_columns(columns, dense_hashes, 5);
+            EXPECT_EQ(hashes, dense_hashes);
+            for (Eigen::Index col = 0; col < columns.cols(); ++col)
+            {
+                const ColumnVector<T, D> column = columns.col(col);
+                EXPECT_EQ(hashes[col], hasher(column, 5)) << "ColumnVectorHasher disagrees between its overloads on column " << col;
+            }
+        }
+    }
+}
@@ -0,0 +1,281 @@
+#ifndef SEARCH_CACHE_PATH_CACHE_H
+#define SEARCH_CACHE_PATH_CACHE_H
+
+/**
+ * @file path_cache.h
+ * @brief Least recently used cache of search results keyed by start, goal and search algorithm.
+ */
+
+#include <list>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <unordered_map>
+#include <plog/Log.h>
+#include <boost/container_hash/hash.hpp>
+#include <utils/constants.h>
+#include <search/node/node.h>
+#include <search/environment/environment.h>
+
+namespace search
+{
+
+    /**
+     * @class PathCache
+     * @brief This class sits in front of the `search` of an environment and keeps the paths of recent queries, keyed by
+     * `(start id, goal id, search algorithm)`, so repeated queries are answered with one hash lookup instead of a search.
+     * Entries are evicted least recently used first once their estimated size exceeds the memory budget. The whole cache is
+     * dropped as soon as the environment version changes - for a `Graph` on every `initialize`, edge mutation and
+     * `set_cost_function` - so a hit is always the path a search would return now. Thread safe - queries that miss search
+     * outside the lock, so concurrent misses of the same key may both search.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     */
+    template <typename T, unsigned int D, typename E>
+        requires(VersionedEnvironment<E, T, D>)
+    class PathCache
+    {
+
+        using SearchAlgorithm = utils::SearchAlgorithm;
+        using Path = std::vector<std::pair<const Node<T, D> *, double>>;
+
+        // Cache key - node ids and search algorithm of a query
+        struct Key
+        {
+            std::uint32_t start_id;
+            std::uint32_t goal_id;
+            SearchAlgorithm search_algorithm;
+
+            bool operator==(const Key &) const = default;
+        };
+
+        // Cache key hasher
+        struct KeyHasher
+        {
+            std::size_t operator()(const Key &key) const
+            {
+                std::size_t seed = 42;
+                boost::hash_combine(seed, key.start_id);
+                boost::hash_combine(seed, key.goal_id);
+                boost::hash_combine(seed, static_cast<std::uint8_t>(key.search_algorithm));
+                return seed;
+            }
+        };
+
+        // Cached path of a query
+        using Entry = std::pair<Key, Path>;
+
+    private:
+        // Environment the searches run in
+        const E *env_;
+
+        // Maximum estimated size of the cached entries in bytes
+        std::size_t memory_budget_;
+
+        // Estimated size of the cached entries in bytes
+        std::size_t memory_usage_ = 0;
+
+        // Environment version the entries were computed against
+        std::uint64_t version_;
+
+        // Number of queries answered from the cache
+        std::size_t num_hits_ = 0;
+
+        // Number of queries that ran a search
+        std::size_t num_misses_ = 0;
+
+        // Entries, most recently used first
+        std::list<Entry> entries_;
+
+        // Key to entry lookup
+        std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHasher> index_;
+
+        // Guards every member above
+        mutable std::mutex mutex_;
+
+        // Estimate the memory held by an entry - list node, index node and path buffer
+        static std::size_t _get_entry_size(const Path &path)
+        {
+            return sizeof(Entry) + 2 * sizeof(void *) +
+                   sizeof(std::pair<const Key, typename std::list<Entry>::iterator>) + 2 * sizeof(void *) +
+                   path.capacity() * sizeof(typename Path::value_type);
+        }
+
+        // Drop every entry - the caller holds the lock
+        void _clear()
+        {
+            entries_.clear();
+            index_.clear();
+            memory_usage_ = 0;
+        }
+
+        // Drop every entry when the environment changed since they were computed - the caller holds the lock
+        void _check_version()
+        {
+            const std::uint64_t version = env_->get_version();
+            if (version != version_)
+            {
+                PLOGD << "Environment changed from version " << version_ << " to " << version << ", dropping " << entries_.size() << " cached paths";
+                this->_clear();
+                version_ = version;
+            }
+        }
+
+        // Evict least recently used entries until the cache fits its budget - the caller holds the lock
+        void _evict()
+        {
+            while (memory_usage_ > memory_budget_ && !entries_.empty())
+            {
+                memory_usage_ -= _get_entry_size(entries_.back().second);
+                index_.erase(entries_.back().first);
+                entries_.pop_back();
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new PathCache object in front of an initialized environment.
+         * @param env environment the searches run in - must outlive the cache.
+         * @param memory_budget maximum estimated size of the cached paths in bytes - default is 64 MiB.
+         */
+        explicit PathCache(const E &env, const std::size_t memory_budget = 64 * 1024 * 1024)
+            : env_(&env),
+              memory_budget_(memory_budget),
+              version_(env.get_version())
+        {
+            PLOGD << "Initializing PathCache object with a budget of " << memory_budget_ << " bytes.";
+        }
+
+        /**
+         * @brief Destroy the PathCache object.
+         */
+        ~PathCache()
+        {
+            PLOGD << "Destroying PathCache object.";
+        }
+
+        /**
+         * @brief Return the cached path from start to goal, or search the environment and cache the result.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc) - default is DFS.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const Path search(const Node<T, D> &start_node,
+                          const Node<T, D> &goal_node,
+                          const SearchAlgorithm search_algorithm = SearchAlgorithm::DFS)
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, search_algorithm, workspace);
+        }
+
+        /**
+         * @brief Return the cached path from start to goal, or search the environment reusing the scratch memory of
+         * `workspace` and cache the result.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc).
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const Path search(const Node<T, D> &start_node,
+                          const Node<T, D> &goal_node,
+                          const SearchAlgorithm search_algorithm,
+                          SearchWorkspace &workspace)
+        {
+            const Key key{env_->get_node_id(start_node), env_->get_node_id(goal_node), search_algorithm};
+            std::uint64_t version;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                this->_check_version();
+                const auto it = index_.find(key);
+                if (it != index_.end())
+                {
+                    ++num_hits_;
+                    entries_.splice(entries_.begin(), entries_, it->second);
+                    return it->second->second;
+                }
+                ++num_misses_;
+                version = version_;
+            }
+            PLOGD << "Path cache miss from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            Path path = env_->search(start_node, goal_node, search_algorithm, workspace);
+            path.shrink_to_fit();
+            const std::size_t entry_size = _get_entry_size(path);
+            std::lock_guard<std::mutex> lock(mutex_);
+            this->_check_version();
+            // Skip results computed against an older version, paths larger than the budget and keys cached meanwhile
+            if (version == version_ && entry_size <= memory_budget_ && index_.find(key) == index_.end())
+            {
+                entries_.emplace_front(key, path);
+                index_.emplace(key, entries_.begin());
+                memory_usage_ += entry_size;
+                this->_evict();
+            }
+            return path;
+        }
+
+        /**
+         * @brief Drop every cached path. The hit and miss counters are kept.
+         */
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            this->_clear();
+        }
+
+        /**
+         * @brief Get the number of cached paths.
+         * @return std::size_t number of cached paths.
+         */
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return entries_.size();
+        }
+
+        /**
+         * @brief Get the estimated size of the cached paths in bytes.
+         * @return std::size_t memory usage in bytes.
+         */
+        std::size_t get_memory_usage() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return memory_usage_;
+        }
+
+        /**
+         * @brief Get the memory budget.
+         * @return std::size_t memory budget in bytes.
+         */
+        std::size_t get_memory_budget() const
+        {
+            return memory_budget_;
+        }
+
+        /**
+         * @brief Get the number of queries answered from the cache.
+         * @return std::size_t number of hits.
+         */
+        std::size_t get_num_hits() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return num_hits_;
+        }
+
+        /**
+         * @brief Get the number of queries that ran a search.
+         * @return std::size_t number of misses.
+         */
+        std::size_t get_num_misses() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return num_misses_;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_CACHE_PATH_CACHE_H
@@ -0,0 +1,101 @@
+#ifndef SEARCH_CONTAINER_ATOMIC_BITMAP_H
+#define SEARCH_CONTAINER_ATOMIC_BITMAP_H
+
+/**
+ * @file atomic_bitmap.h
+ * @brief A fixed size bitmap whose bits can be claimed concurrently.
+ */
+
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace search
+{
+
+    /**
+     * @class AtomicBitmap
+     * @brief This class represents a bitmap of `size` bits backed by 64 bit atomic words. `set` is safe to call from many
+     * threads at once and reports whether the caller was the one that flipped the bit.
+     */
+    class AtomicBitmap
+    {
+
+    private:
+        // Number of bits
+        std::size_t size_ = 0;
+
+        // Number of words
+        std::size_t num_words_ = 0;
+
+        // Bit storage
+        std::unique_ptr<std::atomic<std::uint64_t>[]> words_;
+
+    public:
+        /**
+         * @brief Construct an empty AtomicBitmap object.
+         */
+        AtomicBitmap() = default;
+
+        /**
+         * @brief Construct a new AtomicBitmap object with every bit cleared.
+         * @param size number of bits.
+         */
+        explicit AtomicBitmap(const std::size_t size)
+            : size_(size),
+              num_words_((size + 63) / 64),
+              words_(std::make_unique<std::atomic<std::uint64_t>[]>(num_words_))
+        {
+            clear();
+        }
+
+        /**
+         * @brief Get the number of bits.
+         * @return std::size_t number of bits.
+         */
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Clear every bit (not thread safe).
+         */
+        void clear()
+        {
+            for (std::size_t idx = 0; idx < num_words_; ++idx)
+            {
+                words_[idx].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Test a bit.
+         * @param idx bit index.
+         * @return true if the bit is set, false otherwise.
+         */
+        bool test(const std::size_t idx) const
+        {
+            return (words_[idx >> 6].load(std::memory_order_relaxed) >> (idx & 63)) & 1ULL;
+        }
+
+        /**
+         * @brief Set a bit atomically.
+         * @param idx bit index.
+         * @return true if this call set the bit, false if it was already set.
+         */
+        bool set(const std::size_t idx)
+        {
+            const std::uint64_t mask = 1ULL << (idx & 63);
+            if (words_[idx >> 6].load(std::memory_order_relaxed) & mask)
+            {
+                return false;
+            }
+            return !(words_[idx >> 6].fetch_or(mask, std::memory_order_relaxed) & mask);
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_CONTAINER_ATOMIC_BITMAP_H
@@ -0,0 +1,286 @@
+#ifndef SEARCH_CONTAINER_INDEXED_HEAP_H
+#define SEARCH_CONTAINER_INDEXED_HEAP_H
+
+/**
+ * @file indexed_heap.h
+ * @brief An indexed d-ary min heap over dense ids with decrease-key support.
+ */
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace search
+{
+
+    /**
+     * @class IndexedDaryHeap
+     * @brief This class represents a d-ary min heap whose items are dense ids in `[0, capacity)`. The position of every id is
+     * kept in a flat array so `contains` and `decrease_key` are O(1) lookups without hashing.
+     * @tparam K Key type.
+     * @tparam A Arity of the heap - default is 4.
+     */
+    template <typename K, std::size_t A = 4>
+        requires(A >= 2)
+    class IndexedDaryHeap
+    {
+
+    private:
+        // Sentinel position for ids that are not in the heap
+        static constexpr std::uint32_t npos_ = std::numeric_limits<std::uint32_t>::max();
+
+        // Heap ordered (key, id) entries
+        std::vector<std::pair<K, std::uint32_t>> heap_;
+
+        // Position of every id in `heap_`
+        std::vector<std::uint32_t> positions_;
+
+        // Move the entry at `pos` up until the heap property holds
+        void _sift_up(std::size_t pos)
+        {
+            const std::pair<K, std::uint32_t> entry = heap_[pos];
+            while (pos > 0)
+            {
+                const std::size_t parent = (pos - 1) / A;
+                if (!(entry.first < heap_[parent].first))
+                {
+                    break;
+                }
+                heap_[pos] = heap_[parent];
+                positions_[heap_[pos].second] = static_cast<std::uint32_t>(pos);
+                pos = parent;
+            }
+            heap_[pos] = entry;
+            positions_[entry.second] = static_cast<std::uint32_t>(pos);
+        }
+
+        // Move the entry at `pos` down until the heap property holds
+        void _sift_down(std::size_t pos)
+        {
+            const std::pair<K, std::uint32_t> entry = heap_[pos];
+            const std::size_t size = heap_.size();
+            while (true)
+            {
+                const std::size_t first_child = pos * A + 1;
+                if (first_child >= size)
+                {
+                    break;
+                }
+                const std::size_t last_child = std::min(first_child + A, size);
+                std::size_t best_child = first_child;
+                for (std::size_t child = first_child + 1; child < last_child; ++child)
+                {
+                    if (heap_[child].first < heap_[best_child].first)
+                    {
+                        best_child = child;
+                    }
+                }
+                if (!(heap_[best_child].first < entry.first))
+                {
+                    break;
+                }
+                heap_[pos] = heap_[best_child];
+                positions_[heap_[pos].second] = static_cast<std::uint32_t>(pos);
+                pos = best_child;
+            }
+            heap_[pos] = entry;
+            positions_[entry.second] = static_cast<std::uint32_t>(pos);
+        }
+
+    public:
+        /**
+         * @brief Construct a new IndexedDaryHeap object.
+         * @param capacity number of distinct ids the heap can hold - default is 0.
+         */
+        explicit IndexedDaryHeap(const std::size_t capacity = 0)
+            : positions_(capacity, npos_)
+        {
+        }
+
+        /**
+         * @brief Resize the id range of the heap - the heap must be empty.
+         * @param capacity number of distinct ids the heap can hold.
+         */
+        void resize(const std::size_t capacity)
+        {
+            positions_.assign(capacity, npos_);
+        }
+
+        /**
+         * @brief Extend the id range of the heap, keeping its items.
+         * @param capacity number of distinct ids the heap can hold - ignored when not larger than the current range.
+         */
+        void grow(const std::size_t capacity)
+        {
+            if (capacity > positions_.size())
+            {
+                positions_.resize(capacity, npos_);
+            }
+        }
+
+        /**
+         * @brief Get the id range of the heap.
+         * @return std::size_t number of distinct ids the heap can hold.
+         */
+        std::size_t capacity() const
+        {
+            return positions_.size();
+        }
+
+        /**
+         * @brief Check whether the heap is empty.
+         * @return true if the heap is empty, false otherwise.
+         */
+        bool empty() const
+        {
+            return heap_.empty();
+        }
+
+        /**
+         * @brief Get the number of items in the heap.
+         * @return std::size_t number of items.
+         */
+        std::size_t size() const
+        {
+            return heap_.size();
+        }
+
+        /**
+         * @brief Check whether an id is in the heap.
+         * @param id id to check.
+         * @return true if the id is in the heap, false otherwise.
+         */
+        bool contains(const std::uint32_t id) const
+        {
+            return positions_[id] != npos_;
+        }
+
+        /**
+         * @brief Get the key of an id in the heap.
+         * @param id id in the heap.
+         * @return const K& key of the id.
+         */
+        const K &get_key(const std::uint32_t id) const
+        {
+            return heap_[positions_[id]].first;
+        }
+
+        /**
+         * @brief Get the minimum (key, id) entry.
+         * @return const std::pair<K, std::uint32_t>& minimum entry.
+         */
+        const std::pair<K, std::uint32_t> &top() const
+        {
+            return heap_.front();
+        }
+
+        /**
+         * @brief Insert an id that is not in the heap.
+         * @param id id to insert.
+         * @param key key of the id.
+         */
+        void push(const std::uint32_t id, const K &key)
+        {
+            heap_.emplace_back(key, id);
+            _sift_up(heap_.size() - 1);
+        }
+
+        /**
+         * @brief Lower the key of an id that is in the heap.
+         * @param id id in the heap.
+         * @param key new key - must not be greater than the current key.
+         */
+        void decrease_key(const std::uint32_t id, const K &key)
+        {
+            const std::size_t pos = positions_[id];
+            heap_[pos].first = key;
+            _sift_up(pos);
+        }
+
+        /**
+         * @brief Insert an id or lower its key if it is already in the heap with a greater key.
+         * @param id id to insert or update.
+         * @param key key of the id.
+         * @return true if the heap changed, false otherwise.
+         */
+        bool push_or_decrease(const std::uint32_t id, const K &key)
+        {
+            if (!contains(id))
+            {
+                push(id, key);
+                return true;
+            }
+            if (key < get_key(id))
+            {
+                decrease_key(id, key);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Remove an id from the heap if it is present.
+         * @param id id to remove.
+         */
+        void erase(const std::uint32_t id)
+        {
+            if (!contains(id))
+            {
+                return;
+            }
+            const std::size_t pos = positions_[id];
+            positions_[id] = npos_;
+            const std::pair<K, std::uint32_t> last = heap_.back();
+            heap_.pop_back();
+            if (pos == heap_.size())
+            {
+                return;
+            }
+            heap_[pos] = last;
+            positions_[last.second] = static_cast<std::uint32_t>(pos);
+            if (pos > 0 && last.first < heap_[(pos - 1) / A].first)
+            {
+                _sift_up(pos);
+            }
+            else
+            {
+                _sift_down(pos);
+            }
+        }
+
+        /**
+         * @brief Remove and return the minimum (key, id) entry.
+         * @return std::pair<K, std::uint32_t> minimum entry.
+         */
+        std::pair<K, std::uint32_t> pop()
+        {
+            const std::pair<K, std::uint32_t> top_entry = heap_.front();
+            positions_[top_entry.second] = npos_;
+            const std::pair<K, std::uint32_t> last = heap_.back();
+            heap_.pop_back();
+            if (!heap_.empty())
+            {
+                heap_.front() = last;
+                _sift_down(0);
+            }
+            return top_entry;
+        }
+
+        /**
+         * @brief Remove every item - only touches the ids still in the heap, so the cost is O(size) and not O(capacity).
+         */
+        void clear()
+        {
+            for (const std::pair<K, std::uint32_t> &entry : heap_)
+            {
+                positions_[entry.second] = npos_;
+            }
+            heap_.clear();
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_CONTAINER_INDEXED_HEAP_H
@@ -0,0 +1,153 @@
+#ifndef SEARCH_CONTAINER_RADIX_HEAP_H
+#define SEARCH_CONTAINER_RADIX_HEAP_H
+
+/**
+ * @file radix_heap.h
+ * @brief A monotone radix heap for integer keys.
+ */
+
+#include <array>
+#include <bit>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include <plog/Log.h>
+
+namespace search
+{
+
+    /**
+     * @class RadixHeap
+     * @brief This class represents a monotone radix min heap over unsigned 64 bit keys. Keys pushed must never be smaller than
+     * the last popped key, which holds for Dijkstra style searches with non negative edge costs. There is no decrease-key -
+     * push the id again with the smaller key and skip stale entries when they are popped.
+     */
+    class RadixHeap
+    {
+
+    private:
+        // Number of buckets - one for the last popped key plus one per bit of the key
+        static constexpr std::size_t num_buckets_ = std::numeric_limits<std::uint64_t>::digits + 1;
+
+        // Buckets of (key, id) entries - bucket `b` holds keys whose highest bit differing from `last_` is `b - 1`
+        std::array<std::vector<std::pair<std::uint64_t, std::uint32_t>>, num_buckets_> buckets_;
+
+        // Last popped key
+        std::uint64_t last_ = 0;
+
+        // Number of entries
+        std::size_t size_ = 0;
+
+        // Bucket index of a key relative to the last popped key
+        std::size_t _get_bucket(const std::uint64_t key) const
+        {
+            return key == last_ ? 0 : std::bit_width(key ^ last_);
+        }
+
+        // Redistribute the first non empty bucket so that bucket 0 holds the minimum keys
+        void _pull()
+        {
+            if (!buckets_[0].empty())
+            {
+                return;
+            }
+            std::size_t bucket = 1;
+            while (buckets_[bucket].empty())
+            {
+                ++bucket;
+            }
+            std::uint64_t new_last = std::numeric_limits<std::uint64_t>::max();
+            for (const std::pair<std::uint64_t, std::uint32_t> &entry : buckets_[bucket])
+            {
+                new_last = std::min(new_last, entry.first);
+            }
+            last_ = new_last;
+            for (const std::pair<std::uint64_t, std::uint32_t> &entry : buckets_[bucket])
+            {
+                buckets_[_get_bucket(entry.first)].push_back(entry);
+            }
+            buckets_[bucket].clear();
+        }
+
+    public:
+        /**
+         * @brief Construct a new RadixHeap object.
+         */
+        RadixHeap() = default;
+
+        /**
+         * @brief Check whether the heap is empty.
+         * @return true if the heap is empty, false otherwise.
+         */
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        /**
+         * @brief Get the number of entries in the heap.
+         * @return std::size_t number of entries.
+         */
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Insert an entry.
+         * @param id id to insert.
+         * @param key key of the id - must not be smaller than the last popped key.
+         */
+        void push(const std::uint32_t id, const std::uint64_t key)
+        {
+            if (key < last_)
+            {
+                PLOGE << "Radix heap key " << key << " is smaller than the last popped key " << last_;
+                throw std::invalid_argument("Radix heap keys must be monotone");
+            }
+            buckets_[_get_bucket(key)].emplace_back(key, id);
+            ++size_;
+        }
+
+        /**
+         * @brief Get the minimum (key, id) entry.
+         * @return const std::pair<std::uint64_t, std::uint32_t>& minimum entry.
+         */
+        const std::pair<std::uint64_t, std::uint32_t> &top()
+        {
+            _pull();
+            return buckets_[0].back();
+        }
+
+        /**
+         * @brief Remove and return the minimum (key, id) entry.
+         * @return std::pair<std::uint64_t, std::uint32_t> minimum entry.
+         */
+        std::pair<std::uint64_t, std::uint32_t> pop()
+        {
+            _pull();
+            const std::pair<std::uint64_t, std::uint32_t> entry = buckets_[0].back();
+            buckets_[0].pop_back();
+            --size_;
+            return entry;
+        }
+
+        /**
+         * @brief Remove every entry and reset the monotone lower bound - keeps the bucket storage for reuse.
+         */
+        void clear()
+        {
+            for (std::vector<std::pair<std::uint64_t, std::uint32_t>> &bucket : buckets_)
+            {
+                bucket.clear();
+            }
+            last_ = 0;
+            size_ = 0;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_CONTAINER_RADIX_HEAP_H
@@ -0,0 +1,238 @@
+#ifndef SEARCH_CONTAINER_STATE_TABLE_H
+#define SEARCH_CONTAINER_STATE_TABLE_H
+
+/**
+ * @file state_table.h
+ * @brief Open-addressing table that interns vector states under dense ids.
+ */
+
+#include <span>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+#include <plog/Log.h>
+#include <math/types.h>
+#include <math/hasher.h>
+
+namespace search
+{
+
+    /**
+     * @class StateTable
+     * @brief This class interns `math::ColumnVector<T, D>` states: every distinct state gets a dense id, in discovery order.
+     * States are stored inline, column after column, and the index is a linear probing table of 64-bit buckets holding the
+     * upper half of the state hash next to the id - so a table of n states costs n states plus 11 to 22 bytes per state in
+     * two geometrically grown allocations, with no allocation per state, and a lookup compares at most a few states. Hashes
+     * come from `math::ColumnVectorHasher`, which quantizes floating values; states compare exactly, so continuous states
+     * should be snapped by whoever generates them. Not thread safe.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class StateTable
+    {
+
+        using State = math::ColumnVector<T, D>;
+
+    private:
+        // Highest id - one id is left out so `id + 1` fits a bucket
+        static constexpr std::size_t max_size_ = std::numeric_limits<std::uint32_t>::max() - 1;
+
+        // States by id - only the first `size_` columns are used
+        math::ColumnVectors<T, D> states_;
+
+        // Number of states
+        std::size_t size_ = 0;
+
+        // Buckets - upper 32 bits of the hash and `id + 1` in the lower 32 bits, 0 when empty
+        std::vector<std::uint64_t> buckets_;
+
+        // Hasher of the states
+        math::ColumnVectorHasher<T, D> hasher_;
+
+        // Get the bucket tag of a hash
+        static std::uint64_t _get_tag(const std::size_t hash)
+        {
+            return static_cast<std::uint64_t>(hash) >> 32;
+        }
+
+        // Find the bucket of a state - either the one holding it or the empty one where it belongs
+        std::size_t _find_bucket(const State &state, const std::size_t hash) const
+        {
+            const std::size_t mask = buckets_.size() - 1;
+            const std::uint64_t tag = _get_tag(hash);
+            for (std::size_t idx = hash & mask;; idx = (idx + 1) & mask)
+            {
+                const std::uint64_t bucket = buckets_[idx];
+                if (bucket == 0 || ((bucket >> 32) == tag && states_.col(static_cast<Eigen::Index>((bucket & 0xFFFFFFFFULL) - 1)) == state))
+                {
+                    return idx;
+                }
+            }
+        }
+
+        // Rebuild the buckets with `num_buckets` buckets - a power of two - hashing the stored states in bulk
+        void _rehash(const std::size_t num_buckets)
+        {
+            PLOGD << "Rehashing StateTable of " << size_ << " states into " << num_buckets << " buckets.";
+            std::vector<std::size_t> hashes(size_);
+            math::DenseHasher().hash_columns(states_.leftCols(static_cast<Eigen::Index>(size_)), hashes);
+            buckets_.assign(num_buckets, 0);
+            const std::size_t mask = num_buckets - 1;
+            for (std::size_t id = 0; id < size_; ++id)
+            {
+                std::size_t idx = hashes[id] & mask;
+                while (buckets_[idx] != 0)
+                {
+                    idx = (idx + 1) & mask;
+                }
+                buckets_[idx] = (_get_tag(hashes[id]) << 32) | (id + 1);
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new StateTable object.
+         * @param capacity number of states to make room for - default is 0.
+         */
+        explicit StateTable(const std::size_t capacity = 0)
+        {
+            this->reserve(capacity);
+        }
+
+        /**
+         * @brief Make room for `capacity` states without rehashing.
+         * @param capacity number of states.
+         */
+        void reserve(const std::size_t capacity)
+        {
+            if (capacity > max_size_)
+            {
+                PLOGE << "StateTable can not hold " << capacity << " states";
+                throw std::length_error("Number of states exceeds the 32-bit id range");
+            }
+            if (static_cast<std::size_t>(states_.cols()) < capacity)
+            {
+                states_.conservativeResize(Eigen::NoChange, static_cast<Eigen::Index>(capacity));
+            }
+            // Keep the load factor at or below 3/4
+            std::size_t num_buckets = 16;
+            while (num_buckets * 3 < capacity * 4)
+            {
+                num_buckets *= 2;
+            }
+            if (num_buckets > buckets_.size())
+            {
+                this->_rehash(num_buckets);
+            }
+        }
+
+        /**
+         * @brief Intern a state.
+         * @param state state.
+         * @return std::pair<std::uint32_t, bool> id of the state and whether it was inserted by this call.
+         */
+        std::pair<std::uint32_t, bool> insert(const State &state)
+        {
+            if ((size_ + 1) * 4 > buckets_.size() * 3)
+            {
+                this->reserve(std::min(std::max<std::size_t>(2 * size_, size_ + 1), max_size_));
+            }
+            const std::size_t hash = hasher_(state);
+            const std::size_t idx = this->_find_bucket(state, hash);
+            if (buckets_[idx] != 0)
+            {
+                return {static_cast<std::uint32_t>((buckets_[idx] & 0xFFFFFFFFULL) - 1), false};
+            }
+            if (size_ == max_size_)
+            {
+                PLOGE << "StateTable is full with " << size_ << " states";
+                throw std::length_error("Number of states exceeds the 32-bit id range");
+            }
+            if (static_cast<std::size_t>(states_.cols()) == size_)
+            {
+                states_.conservativeResize(Eigen::NoChange, static_cast<Eigen::Index>(std::min(std::max<std::size_t>(2 * size_, 16), max_size_)));
+            }
+            states_.col(static_cast<Eigen::Index>(size_)) = state;
+            buckets_[idx] = (_get_tag(hash) << 32) | (size_ + 1);
+            return {static_cast<std::uint32_t>(size_++), true};
+        }
+
+        /**
+         * @brief Find the id of a state.
+         * @param state state.
+         * @return std::optional<std::uint32_t> id of the state, empty if the state was never inserted.
+         */
+        std::optional<std::uint32_t> find(const State &state) const
+        {
+            if (buckets_.empty())
+            {
+                return std::nullopt;
+            }
+            const std::uint64_t bucket = buckets_[this->_find_bucket(state, hasher_(state))];
+            if (bucket == 0)
+            {
+                return std::nullopt;
+            }
+            return static_cast<std::uint32_t>((bucket & 0xFFFFFFFFULL) - 1);
+        }
+
+        /**
+         * @brief Get a state - the reference is invalidated by the next insertion.
+         * @param id id of the state.
+         * @return auto column of the state.
+         */
+        auto get_state(const std::uint32_t id) const
+        {
+            if (id >= size_)
+            {
+                PLOGE << "State id " << id << " is out of range for " << size_ << " states";
+                throw std::out_of_range("State id out of range");
+            }
+            return states_.col(static_cast<Eigen::Index>(id));
+        }
+
+        /**
+         * @brief Get the number of states.
+         * @return std::size_t number of states.
+         */
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Get the largest number of states the table can hold.
+         * @return std::size_t maximum number of states.
+         */
+        static constexpr std::size_t max_size()
+        {
+            return max_size_;
+        }
+
+        /**
+         * @brief Remove every state, keeping the allocations.
+         */
+        void clear()
+        {
+            size_ = 0;
+            std::fill(buckets_.begin(), buckets_.end(), 0);
+        }
+
+        /**
+         * @brief Get the number of bytes held by the states and the buckets.
+         * @return std::size_t memory footprint in bytes.
+         */
+        std::size_t get_memory_usage() const
+        {
+            return static_cast<std::size_t>(states_.size()) * sizeof(T) + buckets_.capacity() * sizeof(std::uint64_t);
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_CONTAINER_STATE_TABLE_H
@@ -27,7 +27,7 @@ namespace search
 
     private:
         // Distance value
-        double distance_value_;
+        double distance_value_ = 0.0;
 
         // Distance metric
         DistanceMetric distance_metric_;
@@ -40,7 +40,7 @@ namespace search
         DistanceCost(DistanceMetric distance_metric = DistanceMetric::EUCLIDEAN)
             : distance_metric_(distance_metric)
         {
-            PLOGD << "Initializing DistanceCost with distance metric: " << distance_metric_ << " (" << static_cast<uint8_t>(distance_metric_) << ")";
+            PLOGD << "Initializing DistanceCost with distance metric: " << static_cast<int>(distance_metric_);
         }
 
         /**
@@ -60,6 +60,27 @@ namespace search
             return distance_metric_;
         }
 
+        /**
+         * @brief Get the distance between two node values using the distance metric.
+         * @param from_value value of node A.
+         * @param to_value value of node B.
+         * @return double distance between `from_value` and `to_value`.
+         */
+        double get_distance(const NodeValue<T, D> &from_value,
+                            const NodeValue<T, D> &to_value) const
+        {
+            switch (distance_metric_)
+            {
+            case DistanceMetric::EUCLIDEAN:
+                return (from_value.value - to_value.value).template cast<double>().norm();
+            case DistanceMetric::MANHATTAN:
+                return (from_value.value - to_value.value).template cast<double>().template lpNorm<1>();
+            default:
+                PLOGE << "Unknown distance metric: " << static_cast<int>(distance_metric_);
+                throw std::invalid_argument("Unknown distance metric");
+            }
+        }
+
         /**
          * @brief Get the cost of going from node A to node B (`from_node` to `to_node`).
          * The cost is calculated using the distance metrics.
@@ -71,18 +92,7 @@ namespace search
                               const Node<T, D> &to_node) const override
         {
             PLOGD << "Calculating distance based cost from node: " << from_node.get_name() << " to node: " << to_node.get_name();
-            switch (distance_metric_)
-            {
-            case DistanceMetric::EUCLIDEAN:
-                PLOGD << "Using Euclidean distance metric";
-                return (from_node.getNodeValue().value - to_node.getNodeValue().value).norm();
-            case DistanceMetric::MANHATTAN:
-                PLOGD << "Using Manhattan distance metric";
-                return (from_node.getNodeValue().value - to_node.getNodeValue().value).template lpNorm<1>();
-            default:
-                PLOGE << "Unknown distance metric: " << static_cast<uint8_t>(distance_metric_);
-                throw std::invalid_argument("Unknown distance metric");
-            }
+            return get_distance(from_node.get_node_value(), to_node.get_node_value());
         }
 
         /**
@@ -93,7 +103,8 @@ namespace search
          */
         friend std::ostream &operator<<(std::ostream &os, const DistanceCost<T, D> &cost)
         {
-            os << "DistanceCost[DistanceMetric: " << static_cast<uint8_t>(cost.getDistanceMetric()) << "]";
+            os << "DistanceCost[DistanceMetric: " << static_cast<int>(cost.get_distance_metric()) << "]";
+            return os;
         }
     };
 
@@ -0,0 +1,237 @@
+#ifndef SEARCH_COST_STATIC_AGGREGATE_COST_H
+#define SEARCH_COST_STATIC_AGGREGATE_COST_H
+
+/**
+ * @file static_aggregate_cost.h
+ * @brief This class aggregates multiple cost functions, known at compile time, into one.
+ */
+
+#include <array>
+#include <concepts>
+#include <tuple>
+#include <utility>
+#include <plog/Log.h>
+#include <search/cost/cost.h>
+
+namespace search
+{
+
+    /**
+     * @struct StaticWeights
+     * @brief Weights of a `StaticAggregateCost` fixed at compile time - `StaticAggregateCost<T, D, StaticWeights<1.0, 0.5>, C0, C1>`.
+     * @tparam W Weight of each cost function, in order.
+     */
+    template <double... W>
+    struct StaticWeights
+    {
+        // Weights as a constant expression
+        static constexpr std::array<double, sizeof...(W)> values = {W...};
+    };
+
+    /**
+     * @class StaticAggregateCost
+     * @brief This class represents an aggregate cost function that combines multiple cost functions into one, like
+     * `AggregateCost`, but keeps the concrete cost types. The components are held by value and called without virtual
+     * dispatch, so the weighted sum is unrolled and inlined at compile time. Pass `StaticWeights<W...>` as the first cost
+     * type to fix the weights at compile time as well, otherwise they are set at construction.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam C Cost function types, optionally preceded by `StaticWeights<W...>`.
+     */
+    template <typename T, unsigned int D, typename... C>
+    class StaticAggregateCost;
+
+    /**
+     * @class StaticAggregateCost
+     * @brief Aggregate cost with weights set at construction.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam C Cost function types.
+     */
+    template <typename T, unsigned int D, typename... C>
+        requires(sizeof...(C) > 0 && (std::derived_from<C, Cost<T, D>> && ...))
+    class StaticAggregateCost<T, D, C...> final : public Cost<T, D>
+    {
+
+    private:
+        // Cost functions
+        std::tuple<C...> cost_functions_;
+
+        // weights for each cost function
+        std::array<double, sizeof...(C)> weights_;
+
+        // Weighted sum of the cost functions - qualified calls bypass the virtual table
+        template <std::size_t... I>
+        double _get_cost(const Node<T, D> &from_node,
+                         const Node<T, D> &to_node,
+                         std::index_sequence<I...>) const
+        {
+            return ((weights_[I] * std::get<I>(cost_functions_).C::get_cost(from_node, to_node)) + ...);
+        }
+
+    public:
+        /**
+         * @brief Construct a new StaticAggregateCost object with equally distributed weights.
+         * @param cost_functions cost functions to combine (copied).
+         */
+        StaticAggregateCost(const C &...cost_functions)
+            : cost_functions_(cost_functions...)
+        {
+            PLOGD << "Initializing StaticAggregateCost with " << sizeof...(C) << " cost functions and equally distributed weights";
+            weights_.fill(1.0);
+        }
+
+        /**
+         * @brief Construct a new StaticAggregateCost object.
+         * @param weights weights for each cost function.
+         * @param cost_functions cost functions to combine (copied).
+         */
+        StaticAggregateCost(const std::array<double, sizeof...(C)> &weights, const C &...cost_functions)
+            : cost_functions_(cost_functions...),
+              weights_(weights)
+        {
+            PLOGD << "Initializing StaticAggregateCost with " << sizeof...(C) << " cost functions and " << weights_.size() << " weights";
+        }
+
+        /**
+         * @brief Destructor for the StaticAggregateCost class.
+         */
+        ~StaticAggregateCost()
+        {
+            PLOGD << "Destroying StaticAggregateCost object";
+        }
+
+        /**
+         * @brief Get the weights of the cost functions.
+         * @return const std::array<double, sizeof...(C)>& weights.
+         */
+        const std::array<double, sizeof...(C)> &get_weights() const
+        {
+            return weights_;
+        }
+
+        /**
+         * @brief Get the const of going from node A to node B (`from_node` to `to_node`).
+         * @param from_node node A.
+         * @param to_node node B.
+         * @return const double cost of going `from_node` to `to_node`.
+         */
+        const double get_cost(const Node<T, D> &from_node,
+                              const Node<T, D> &to_node) const override
+        {
+            return this->_get_cost(from_node, to_node, std::index_sequence_for<C...>{});
+        }
+
+        /**
+         * @brief << operator - function for streaming the StaticAggregateCost to an output stream.
+         * @param os output stream.
+         * @param cost cost to stream.
+         * @return std::ostream& output stream.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const StaticAggregateCost<T, D, C...> &cost)
+        {
+            os << "StaticAggregateCost[";
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                ((os << cost.weights_[I] << " * " << std::get<I>(cost.cost_functions_) << ", "), ...);
+            }(std::index_sequence_for<C...>{});
+            os << "]";
+            return os;
+        }
+    };
+
+    /**
+     * @class StaticAggregateCost
+     * @brief Aggregate cost with weights fixed at compile time - every weight is a constant of the unrolled sum, so the
+     * object only holds the cost functions.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam W Weight of each cost function.
+     * @tparam C Cost function types.
+     */
+    template <typename T, unsigned int D, double... W, typename... C>
+        requires(sizeof...(C) > 0 && sizeof...(W) == sizeof...(C) && (std::derived_from<C, Cost<T, D>> && ...))
+    class StaticAggregateCost<T, D, StaticWeights<W...>, C...> final : public Cost<T, D>
+    {
+
+    private:
+        // Cost functions
+        std::tuple<C...> cost_functions_;
+
+        // Weighted sum of the cost functions - qualified calls bypass the virtual table
+        template <std::size_t... I>
+        double _get_cost(const Node<T, D> &from_node,
+                         const Node<T, D> &to_node,
+                         std::index_sequence<I...>) const
+        {
+            return ((StaticWeights<W...>::values[I] * std::get<I>(cost_functions_).C::get_cost(from_node, to_node)) + ...);
+        }
+
+    public:
+        /**
+         * @brief Construct a new StaticAggregateCost object.
+         * @param cost_functions cost functions to combine (copied).
+         */
+        StaticAggregateCost(const C &...cost_functions)
+            : cost_functions_(cost_functions...)
+        {
+            PLOGD << "Initializing StaticAggregateCost with " << sizeof...(C) << " cost functions and compile time weights";
+        }
+
+        /**
+         * @brief Destructor for the StaticAggregateCost class.
+         */
+        ~StaticAggregateCost()
+        {
+            PLOGD << "Destroying StaticAggregateCost object";
+        }
+
+        /**
+         * @brief Get the weights of the cost functions.
+         * @return const std::array<double, sizeof...(C)>& weights.
+         */
+        static constexpr const std::array<double, sizeof...(C)> &get_weights()
+        {
+            return StaticWeights<W...>::values;
+        }
+
+        /**
+         * @brief Get the const of going from node A to node B (`from_node` to `to_node`).
+         * @param from_node node A.
+         * @param to_node node B.
+         * @return const double cost of going `from_node` to `to_node`.
+         */
+        const double get_cost(const Node<T, D> &from_node,
+                              const Node<T, D> &to_node) const override
+        {
+            return this->_get_cost(from_node, to_node, std::index_sequence_for<C...>{});
+        }
+
+        /**
+         * @brief << operator - function for streaming the StaticAggregateCost to an output stream.
+         * @param os output stream.
+         * @param cost cost to stream.
+         * @return std::ostream& output stream.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const StaticAggregateCost<T, D, StaticWeights<W...>, C...> &cost)
+        {
+            os << "StaticAggregateCost[";
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                ((os << StaticWeights<W...>::values[I] << " * " << std::get<I>(cost.cost_functions_) << ", "), ...);
+            }(std::index_sequence_for<C...>{});
+            os << "]";
+            return os;
+        }
+    };
+
+    // Deduce the type and dimension from the first cost function - `StaticAggregateCost(DistanceCost<T, D>(...), ...)`
+    template <template <typename, unsigned int> class C0, typename T, unsigned int D, typename... C>
+    StaticAggregateCost(const C0<T, D> &, const C &...) -> StaticAggregateCost<T, D, C0<T, D>, C...>;
+
+    template <std::size_t N, template <typename, unsigned int> class C0, typename T, unsigned int D, typename... C>
+    StaticAggregateCost(const std::array<double, N> &, const C0<T, D> &, const C &...) -> StaticAggregateCost<T, D, C0<T, D>, C...>;
+
+} // namespace search
+
+#endif // SEARCH_COST_STATIC_AGGREGATE_COST_H
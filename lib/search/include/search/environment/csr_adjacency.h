@@ -0,0 +1,343 @@
+#ifndef SEARCH_ENVIRONMENT_CSR_ADJACENCY_H
+#define SEARCH_ENVIRONMENT_CSR_ADJACENCY_H
+
+/**
+ * @file csr_adjacency.h
+ * @brief Compressed sparse row (CSR) adjacency storage shared by the index based environments.
+ */
+
+#include <span>
+#include <utility>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <plog/Log.h>
+
+namespace search
+{
+
+    /**
+     * @class CsrAdjacency
+     * @brief This class represents a directed adjacency in compressed sparse row form - the out edges of node `i` are
+     * `targets[offsets[i] .. offsets[i + 1])`. Node ids are dense `uint32_t` indices.
+     */
+    class CsrAdjacency
+    {
+
+    private:
+        // Edge offsets per node (size = number of nodes + 1)
+        std::vector<std::size_t> offsets_;
+
+        // Edge targets (size = number of edges)
+        std::vector<std::uint32_t> targets_;
+
+        // Optional edge weights (size = number of edges when set, empty otherwise)
+        std::vector<double> weights_;
+
+    public:
+        /**
+         * @brief Construct an empty CsrAdjacency object.
+         */
+        CsrAdjacency() = default;
+
+        /**
+         * @brief Construct a new CsrAdjacency object from an edge list using a counting sort.
+         * The relative order of the edges leaving a node is the same as in `edges`.
+         * @param num_nodes number of nodes.
+         * @param edges list of edges (from index, to index).
+         */
+        CsrAdjacency(const std::size_t num_nodes,
+                     std::span<const std::pair<std::size_t, std::size_t>> edges)
+            : offsets_(num_nodes + 1, 0),
+              targets_(edges.size())
+        {
+            PLOGD << "Building CSR adjacency with " << num_nodes << " nodes and " << edges.size() << " edges.";
+            if (num_nodes > std::numeric_limits<std::uint32_t>::max())
+            {
+                PLOGE << "Number of nodes " << num_nodes << " exceeds the 32-bit node id range";
+                throw std::invalid_argument("Number of nodes exceeds the 32-bit node id range");
+            }
+            for (const std::pair<std::size_t, std::size_t> &edge : edges)
+            {
+                if (edge.first >= num_nodes || edge.second >= num_nodes)
+                {
+                    PLOGE << "Edge (" << edge.first << ", " << edge.second << ") is out of range for " << num_nodes << " nodes";
+                    throw std::out_of_range("Edge index out of range");
+                }
+                ++offsets_[edge.first + 1];
+            }
+            for (std::size_t idx = 0; idx < num_nodes; ++idx)
+            {
+                offsets_[idx + 1] += offsets_[idx];
+            }
+            std::vector<std::size_t> cursor(offsets_.begin(), offsets_.end() - 1);
+            for (const std::pair<std::size_t, std::size_t> &edge : edges)
+            {
+                targets_[cursor[edge.first]++] = static_cast<std::uint32_t>(edge.second);
+            }
+        }
+
+        /**
+         * @brief Construct a new CsrAdjacency object taking over prebuilt offset and target arrays.
+         * @param offsets edge offsets per node (size = number of nodes + 1, non decreasing, starting at 0).
+         * @param targets edge targets (size = `offsets.back()`).
+         */
+        CsrAdjacency(std::vector<std::size_t> offsets,
+                     std::vector<std::uint32_t> targets)
+            : offsets_(std::move(offsets)),
+              targets_(std::move(targets))
+        {
+            PLOGD << "Adopting CSR adjacency with " << get_num_nodes() << " nodes and " << targets_.size() << " edges.";
+            CsrAdjacency::validate(std::span<const std::size_t>(offsets_), std::span<const std::uint32_t>(targets_));
+        }
+
+        /**
+         * @brief Check that offsets index a section of `count` entries - `offsets[i] .. offsets[i + 1]` is the slice of
+         * entry `i`, so they must start at 0, never decrease and end at `count`.
+         * @tparam O Offset type.
+         * @param offsets offsets per entry (size = number of entries + 1).
+         * @param count size of the indexed section.
+         */
+        template <typename O>
+        static void validate_offsets(std::span<const O> offsets, const std::size_t count)
+        {
+            if (offsets.empty() || offsets.front() != 0 || offsets.back() != count ||
+                !std::is_sorted(offsets.begin(), offsets.end()))
+            {
+                PLOGE << "CSR offsets do not describe " << count << " entries";
+                throw std::invalid_argument("CSR offsets must be non decreasing from 0 to the section size");
+            }
+        }
+
+        /**
+         * @brief Check that offset and target arrays form a valid CSR adjacency - used on arrays adopted from outside, e.g.
+         * read from a file, before any of them is dereferenced.
+         * @tparam O Offset type.
+         * @param offsets edge offsets per node (size = number of nodes + 1, non decreasing, starting at 0).
+         * @param targets edge targets (size = `offsets.back()`, every target below the number of nodes).
+         */
+        template <typename O>
+        static void validate(std::span<const O> offsets, std::span<const std::uint32_t> targets)
+        {
+            CsrAdjacency::validate_offsets(offsets, targets.size());
+            const std::size_t num_nodes = offsets.size() - 1;
+            if (num_nodes > std::numeric_limits<std::uint32_t>::max())
+            {
+                PLOGE << "Number of nodes " << num_nodes << " exceeds the 32-bit node id range";
+                throw std::invalid_argument("Number of nodes exceeds the 32-bit node id range");
+            }
+            for (const std::uint32_t target : targets)
+            {
+                if (target >= num_nodes)
+                {
+                    PLOGE << "Edge target " << target << " is out of range for " << num_nodes << " nodes";
+                    throw std::out_of_range("Edge index out of range");
+                }
+            }
+        }
+
+        /**
+         * @brief Get the number of nodes.
+         * @return std::size_t number of nodes.
+         */
+        std::size_t get_num_nodes() const
+        {
+            return offsets_.empty() ? 0 : offsets_.size() - 1;
+        }
+
+        /**
+         * @brief Get the number of edges.
+         * @return std::size_t number of edges.
+         */
+        std::size_t get_num_edges() const
+        {
+            return targets_.size();
+        }
+
+        /**
+         * @brief Get the index of the first out edge of a node - out edges are `[get_offset(id), get_offset(id + 1))`.
+         * @param id node id (`id == get_num_nodes()` is allowed and returns the number of edges).
+         * @return std::size_t index of the first out edge.
+         */
+        std::size_t get_offset(const std::uint32_t id) const
+        {
+            return offsets_[id];
+        }
+
+        /**
+         * @brief Get the target node of an edge.
+         * @param edge edge index.
+         * @return std::uint32_t target node id.
+         */
+        std::uint32_t get_target(const std::size_t edge) const
+        {
+            return targets_[edge];
+        }
+
+        /**
+         * @brief Get the neighbors (out edge targets) of a node.
+         * @param id node id.
+         * @return std::span<const std::uint32_t> neighbor ids.
+         */
+        std::span<const std::uint32_t> get_neighbors(const std::uint32_t id) const
+        {
+            return {targets_.data() + offsets_[id], targets_.data() + offsets_[id + 1]};
+        }
+
+        /**
+         * @brief Check whether edge weights are stored.
+         * @return true if edge weights are stored, false otherwise.
+         */
+        bool has_weights() const
+        {
+            return !weights_.empty();
+        }
+
+        /**
+         * @brief Get the weight of an edge - only valid when `has_weights()`.
+         * @param edge edge index.
+         * @return double weight of the edge.
+         */
+        double get_weight(const std::size_t edge) const
+        {
+            return weights_[edge];
+        }
+
+        /**
+         * @brief Store one weight per edge, aligned with the edge indices.
+         * @param weights edge weights.
+         */
+        void set_weights(std::vector<double> weights)
+        {
+            if (weights.size() != targets_.size())
+            {
+                PLOGE << "Got " << weights.size() << " edge weights for " << targets_.size() << " edges";
+                throw std::invalid_argument("Number of edge weights must match the number of edges");
+            }
+            weights_ = std::move(weights);
+        }
+
+        /**
+         * @brief Drop the stored edge weights.
+         */
+        void clear_weights()
+        {
+            weights_.clear();
+            weights_.shrink_to_fit();
+        }
+
+        /**
+         * @brief Set the weight of an edge - only valid when `has_weights()`.
+         * @param edge edge index.
+         * @param weight weight of the edge.
+         */
+        void set_weight(const std::size_t edge, const double weight)
+        {
+            weights_[edge] = weight;
+        }
+
+        /**
+         * @brief Find the first out edge of `from` that points to `to`.
+         * @param from source node id.
+         * @param to target node id.
+         * @return std::size_t index of the edge, `get_num_edges()` when there is none.
+         */
+        std::size_t find_edge(const std::uint32_t from, const std::uint32_t to) const
+        {
+            const auto begin = targets_.begin() + offsets_[from];
+            const auto end = targets_.begin() + offsets_[from + 1];
+            const auto it = std::find(begin, end, to);
+            return it == end ? targets_.size() : static_cast<std::size_t>(it - targets_.begin());
+        }
+
+        /**
+         * @brief Append an out edge to `from` - shifts every later edge, so it costs O(number of edges).
+         * @param from source node id.
+         * @param to target node id.
+         * @param weight weight of the edge - ignored unless `has_weights()`.
+         * @return std::size_t index of the new edge.
+         */
+        std::size_t insert_edge(const std::uint32_t from, const std::uint32_t to, const double weight = 0.0)
+        {
+            if (from >= get_num_nodes() || to >= get_num_nodes())
+            {
+                PLOGE << "Edge (" << from << ", " << to << ") is out of range for " << get_num_nodes() << " nodes";
+                throw std::out_of_range("Edge index out of range");
+            }
+            const std::size_t edge = offsets_[from + 1];
+            targets_.insert(targets_.begin() + edge, to);
+            if (has_weights())
+            {
+                weights_.insert(weights_.begin() + edge, weight);
+            }
+            for (std::size_t idx = from + 1; idx < offsets_.size(); ++idx)
+            {
+                ++offsets_[idx];
+            }
+            return edge;
+        }
+
+        /**
+         * @brief Remove an edge - shifts every later edge, so it costs O(number of edges).
+         * @param from source node id of the edge.
+         * @param edge edge index (see `find_edge`).
+         */
+        void erase_edge(const std::uint32_t from, const std::size_t edge)
+        {
+            targets_.erase(targets_.begin() + edge);
+            if (has_weights())
+            {
+                weights_.erase(weights_.begin() + edge);
+            }
+            for (std::size_t idx = from + 1; idx < offsets_.size(); ++idx)
+            {
+                --offsets_[idx];
+            }
+        }
+
+        /**
+         * @brief Get the transpose of this adjacency (every edge reversed) - weights are not carried over.
+         * @return CsrAdjacency transposed adjacency.
+         */
+        CsrAdjacency transpose() const
+        {
+            PLOGD << "Transposing CSR adjacency.";
+            const std::size_t num_nodes = get_num_nodes();
+            CsrAdjacency transposed;
+            transposed.offsets_.assign(num_nodes + 1, 0);
+            transposed.targets_.resize(targets_.size());
+            for (const std::uint32_t target : targets_)
+            {
+                ++transposed.offsets_[target + 1];
+            }
+            for (std::size_t idx = 0; idx < num_nodes; ++idx)
+            {
+                transposed.offsets_[idx + 1] += transposed.offsets_[idx];
+            }
+            std::vector<std::size_t> cursor(transposed.offsets_.begin(), transposed.offsets_.end() - 1);
+            for (std::uint32_t from = 0; from < num_nodes; ++from)
+            {
+                for (std::size_t edge = offsets_[from]; edge < offsets_[from + 1]; ++edge)
+                {
+                    transposed.targets_[cursor[targets_[edge]]++] = from;
+                }
+            }
+            return transposed;
+        }
+
+        /**
+         * @brief Get the number of bytes held by the adjacency arrays.
+         * @return std::size_t memory footprint in bytes.
+         */
+        std::size_t get_memory_usage() const
+        {
+            return offsets_.capacity() * sizeof(std::size_t) + targets_.capacity() * sizeof(std::uint32_t) +
+                   weights_.capacity() * sizeof(double);
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_ENVIRONMENT_CSR_ADJACENCY_H
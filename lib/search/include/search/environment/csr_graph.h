@@ -0,0 +1,416 @@
+#ifndef SEARCH_ENVIRONMENT_CSR_GRAPH_H
+#define SEARCH_ENVIRONMENT_CSR_GRAPH_H
+
+/**
+ * @file csr_graph.h
+ * @brief A compact graph based environment backed by a CSR adjacency and dense node ids.
+ */
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <plog/Log.h>
+#include <search/cost/cost.h>
+#include <search/environment/environment.h>
+#include <search/environment/csr_adjacency.h>
+#include <search/environment/indexed_graph.h>
+#include <search/search/dfs.h>
+#include <search/search/bfs.h>
+#include <search/search/ucs.h>
+#include <search/search/a_star.h>
+#include <search/search/ida_star.h>
+#include <search/search/sma_star.h>
+#include <search/search/ara_star.h>
+#include <search/search/batch_search.h>
+
+namespace search
+{
+
+    /**
+     * @class CsrGraph
+     * @brief This class represents a graph based environment whose adjacency is held in contiguous offset / target arrays
+     * (compressed sparse row) over dense `uint32_t` node ids. Unlike `Graph` it does not populate the per node neighbor
+     * lists, so edge expansion never leaves the CSR arrays.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class CsrGraph : public BatchSearchEnvironment<T, D, CsrGraph<T, D>>
+    {
+
+        using SearchAlgorithm = utils::SearchAlgorithm;
+
+    private:
+        // Edges between nodes - released once the adjacency is built
+        std::vector<std::pair<std::size_t, std::size_t>> edges_;
+
+        // List of nodes - indexed by node id
+        std::vector<const Node<T, D> *> nodes_;
+
+        // Node ids sorted by node address - binary searched to resolve the start and goal of a query
+        std::vector<std::uint32_t> sorted_ids_;
+
+        // Out edges in CSR form
+        CsrAdjacency adjacency_;
+
+        // In edges in CSR form (transpose of `adjacency_`)
+        CsrAdjacency reverse_adjacency_;
+
+        // Cost functions - pointer because we usually pass a child class of Cost<T, D> and we need polymorphism
+        const Cost<T, D> *cost_function_;
+
+        // Whether `adjacency_` is already built - handed over prebuilt or built from `edges_` (then released) by a previous `initialize`
+        bool has_adjacency_ = false;
+
+        // Function to build the CSR adjacency and the node id lookup
+        void _create_csr_graph()
+        {
+            PLOGD << "Creating CSR graph.";
+            if (!has_adjacency_)
+            {
+                adjacency_ = CsrAdjacency(nodes_.size(), edges_);
+                has_adjacency_ = true;
+            }
+            else
+            {
+                adjacency_.clear_weights();
+            }
+            reverse_adjacency_ = adjacency_.transpose();
+            sorted_ids_.resize(nodes_.size());
+            std::iota(sorted_ids_.begin(), sorted_ids_.end(), 0U);
+            std::sort(sorted_ids_.begin(), sorted_ids_.end(), [this](const std::uint32_t a, const std::uint32_t b)
+                      { return nodes_[a] != nodes_[b] ? std::less<const Node<T, D> *>()(nodes_[a], nodes_[b]) : a < b; });
+            edges_.clear();
+            edges_.shrink_to_fit();
+        }
+
+    public:
+        /**
+         * @brief Construct a new CsrGraph object.
+         * @param nodes list of nodes in the graph (raw pointers).
+         * @param edges list of edges in the graph.
+         * @param cost_function cost function for the graph.
+         */
+        CsrGraph(const std::vector<Node<T, D> *> &nodes,
+                 const std::vector<std::pair<std::size_t, std::size_t>> &edges,
+                 const Cost<T, D> &cost_function)
+            : edges_(edges),
+              nodes_(nodes.begin(), nodes.end()),
+              cost_function_(&cost_function)
+        {
+            PLOGD << "Initializing CsrGraph object with " << nodes_.size() << " raw nodes pointers and " << edges_.size() << " edges.";
+        }
+
+        /**
+         * @brief Construct a new CsrGraph object.
+         * @param nodes list of nodes in the graph (smart pointers).
+         * @param edges list of edges in the graph.
+         * @param cost_function cost function for the graph.
+         */
+        CsrGraph(const std::vector<std::unique_ptr<Node<T, D>>> &nodes,
+                 const std::vector<std::pair<std::size_t, std::size_t>> &edges,
+                 const Cost<T, D> &cost_function)
+            : edges_(edges),
+              cost_function_(&cost_function)
+        {
+            PLOGD << "Initializing CsrGraph object with " << nodes.size() << " smart nodes pointers and " << edges_.size() << " edges.";
+            nodes_.reserve(nodes.size());
+            for (const std::unique_ptr<Node<T, D>> &node : nodes)
+            {
+                nodes_.emplace_back(node.get());
+            }
+        }
+
+        /**
+         * @brief Construct a new CsrGraph object around a prebuilt adjacency (e.g. from `read_edge_list`).
+         * @param nodes list of nodes in the graph (raw pointers) - node `i` is id `i` of the adjacency.
+         * @param adjacency out edges in CSR form.
+         * @param cost_function cost function for the graph.
+         */
+        CsrGraph(const std::vector<Node<T, D> *> &nodes,
+                 CsrAdjacency adjacency,
+                 const Cost<T, D> &cost_function)
+            : nodes_(nodes.begin(), nodes.end()),
+              adjacency_(std::move(adjacency)),
+              cost_function_(&cost_function),
+              has_adjacency_(true)
+        {
+            PLOGD << "Initializing CsrGraph object with " << nodes_.size() << " raw nodes pointers and a prebuilt adjacency of " << adjacency_.get_num_edges() << " edges.";
+            if (adjacency_.get_num_nodes() != nodes_.size())
+            {
+                PLOGE << "Adjacency has " << adjacency_.get_num_nodes() << " nodes but " << nodes_.size() << " nodes were given";
+                throw std::invalid_argument("Adjacency size must match the number of nodes");
+            }
+        }
+
+        /**
+         * @brief Construct a new CsrGraph object around a prebuilt adjacency (e.g. from `read_edge_list`).
+         * @param nodes list of nodes in the graph (smart pointers) - node `i` is id `i` of the adjacency.
+         * @param adjacency out edges in CSR form.
+         * @param cost_function cost function for the graph.
+         */
+        CsrGraph(const std::vector<std::unique_ptr<Node<T, D>>> &nodes,
+                 CsrAdjacency adjacency,
+                 const Cost<T, D> &cost_function)
+            : adjacency_(std::move(adjacency)),
+              cost_function_(&cost_function),
+              has_adjacency_(true)
+        {
+            PLOGD << "Initializing CsrGraph object with " << nodes.size() << " smart nodes pointers and a prebuilt adjacency of " << adjacency_.get_num_edges() << " edges.";
+            nodes_.reserve(nodes.size());
+            for (const std::unique_ptr<Node<T, D>> &node : nodes)
+            {
+                nodes_.emplace_back(node.get());
+            }
+            if (adjacency_.get_num_nodes() != nodes_.size())
+            {
+                PLOGE << "Adjacency has " << adjacency_.get_num_nodes() << " nodes but " << nodes_.size() << " nodes were given";
+                throw std::invalid_argument("Adjacency size must match the number of nodes");
+            }
+        }
+
+        /**
+         * @brief Destructor for the CsrGraph class.
+         */
+        ~CsrGraph()
+        {
+            PLOGD << "Destroying CsrGraph object.";
+        }
+
+        /**
+         * @brief Initialize the graph - builds the CSR adjacency. Edge costs are evaluated through the cost function on every expansion.
+         */
+        void initialize() override
+        {
+            this->initialize(false);
+        }
+
+        /**
+         * @brief Initialize the graph - builds the CSR adjacency.
+         * @param precompute_edge_costs when true the cost function is evaluated once per edge and searches read the stored
+         * costs instead of calling it - the cost function and node values must not change afterwards.
+         */
+        void initialize(const bool precompute_edge_costs)
+        {
+            PLOGD << "Initializing CsrGraph based environment.";
+            this->_create_csr_graph();
+            if (precompute_edge_costs)
+            {
+                evaluate_edge_costs(adjacency_, nodes_, *cost_function_);
+            }
+        }
+
+        /**
+         * @brief Check whether the edge costs were precomputed by `initialize`.
+         * @return true if the edge costs are stored, false if they are evaluated on every expansion.
+         */
+        bool has_precomputed_edge_costs() const
+        {
+            return adjacency_.has_weights();
+        }
+
+        /**
+         * @brief Get the number of nodes in the graph.
+         * @return std::size_t number of nodes.
+         */
+        std::size_t get_num_nodes() const
+        {
+            return nodes_.size();
+        }
+
+        /**
+         * @brief Get the number of edges in the graph.
+         * @return std::size_t number of edges.
+         */
+        std::size_t get_num_edges() const
+        {
+            return adjacency_.get_num_edges();
+        }
+
+        /**
+         * @brief Get the node at a given index.
+         * @param index Index (node id) of the node to retrieve.
+         * @return const Node<T, D>* Pointer to the node at the given index.
+         */
+        const Node<T, D> *get_node(const std::size_t index) const
+        {
+            return nodes_[index];
+        }
+
+        /**
+         * @brief Get the dense id of a node.
+         * @param node node in the graph.
+         * @return std::uint32_t id of the node.
+         */
+        std::uint32_t get_node_id(const Node<T, D> &node) const
+        {
+            const auto it = std::lower_bound(sorted_ids_.begin(), sorted_ids_.end(), &node, [this](const std::uint32_t id, const Node<T, D> *target)
+                                             { return std::less<const Node<T, D> *>()(nodes_[id], target); });
+            if (it == sorted_ids_.end() || nodes_[*it] != &node)
+            {
+                PLOGE << "Node " << node.get_name() << " is not part of the graph";
+                throw std::invalid_argument("Node is not part of the graph");
+            }
+            return *it;
+        }
+
+        /**
+         * @brief Get the value of a node.
+         * @param id node id.
+         * @return const NodeValue<T, D>& value of the node.
+         */
+        const NodeValue<T, D> &get_node_value(const std::uint32_t id) const
+        {
+            return nodes_[id]->get_node_value();
+        }
+
+        /**
+         * @brief Get the neighbor ids (out edge targets) of a node.
+         * @param id node id.
+         * @return std::span<const std::uint32_t> neighbor ids.
+         */
+        std::span<const std::uint32_t> get_neighbor_ids(const std::uint32_t id) const
+        {
+            return adjacency_.get_neighbors(id);
+        }
+
+        /**
+         * @brief Get the predecessor ids (in edge sources) of a node.
+         * @param id node id.
+         * @return std::span<const std::uint32_t> predecessor ids.
+         */
+        std::span<const std::uint32_t> get_predecessor_ids(const std::uint32_t id) const
+        {
+            return reverse_adjacency_.get_neighbors(id);
+        }
+
+        /**
+         * @brief Visit every out edge of a node.
+         * @tparam F Visitor type - callable as `visit(neighbor_id, edge_cost)`.
+         * @param id node id.
+         * @param visit visitor.
+         */
+        template <typename F>
+        void for_each_edge(const std::uint32_t id, F &&visit) const
+        {
+            const std::size_t begin = adjacency_.get_offset(id);
+            const std::size_t end = adjacency_.get_offset(id + 1);
+            if (adjacency_.has_weights())
+            {
+                for (std::size_t edge = begin; edge < end; ++edge)
+                {
+                    visit(adjacency_.get_target(edge), adjacency_.get_weight(edge));
+                }
+                return;
+            }
+            const Node<T, D> &from_node = *nodes_[id];
+            for (std::size_t edge = begin; edge < end; ++edge)
+            {
+                const std::uint32_t to_id = adjacency_.get_target(edge);
+                visit(to_id, cost_function_->get_cost(from_node, *nodes_[to_id]));
+            }
+        }
+
+        /**
+         * @brief Get the cost of going from node A to node B (`from_node` to `to_node`) | A -> B.
+         * @param from_node node A.
+         * @param to_node node B.
+         * @return const double cost of going `from_node` to `to_node`.
+         */
+        const double get_cost(const Node<T, D> &from_node,
+                              const Node<T, D> &to_node) const override
+        {
+            PLOGD << "Getting cost from node: " << from_node.get_name() << " to node: " << to_node.get_name();
+            return cost_function_->get_cost(from_node, to_node);
+        }
+
+        /**
+         * @brief Perform space search and return paths from start to goal for a CSR graph based environment.
+         * The informed searches (A*, IDA*, SMA* and ARA*) use the `CostHeuristic` of the cost function - the distance of a
+         * `DistanceCost` and no estimate otherwise. Use `AStar` directly for other heuristics or weighted A*.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc) - default is DFS.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm = SearchAlgorithm::DFS) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, search_algorithm, workspace);
+        }
+
+        /**
+         * @brief Perform space search reusing the scratch memory of `workspace` and return paths from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc).
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            switch (search_algorithm)
+            {
+            case SearchAlgorithm::DFS:
+                PLOGD << "Using DFS search algorithm.";
+                return DFS<T, D, CsrGraph<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::BFS:
+                PLOGD << "Using BFS search algorithm.";
+                return BFS<T, D, CsrGraph<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::UCS:
+                PLOGD << "Using UCS search algorithm.";
+                return UCS<T, D, CsrGraph<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::A_STAR:
+                PLOGD << "Using A* search algorithm.";
+                return AStar<T, D, CsrGraph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(cost_function_)).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::IDA_STAR:
+                PLOGD << "Using IDA* search algorithm.";
+                return IdaStar<T, D, CsrGraph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(cost_function_)).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::SMA_STAR:
+                PLOGD << "Using SMA* search algorithm.";
+                return SmaStar<T, D, CsrGraph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(cost_function_)).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::ARA_STAR:
+                PLOGD << "Using ARA* search algorithm.";
+                return AraStar<T, D, CsrGraph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(cost_function_)).search(start_node, goal_node, *this, workspace);
+            default:
+                PLOGE << "Unknown search algorithm.";
+                throw std::invalid_argument("Unknown search algorithm.");
+            }
+        }
+
+        /**
+         * @brief Get the number of bytes held by the graph structure (node table, id lookup and adjacency).
+         * @return std::size_t memory footprint in bytes.
+         */
+        std::size_t get_memory_usage() const
+        {
+            return nodes_.capacity() * sizeof(const Node<T, D> *) +
+                   sorted_ids_.capacity() * sizeof(std::uint32_t) +
+                   adjacency_.get_memory_usage() + reverse_adjacency_.get_memory_usage();
+        }
+
+        /**
+         * @brief << operator - function for streaming the CsrGraph to an output stream.
+         * @param os output stream.
+         * @param env environment to stream.
+         * @return std::ostream& output stream.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const CsrGraph<T, D> &env)
+        {
+            os << "CsrGraph[Nodes: " << env.nodes_.size() << " | Edges: " << env.adjacency_.get_num_edges() << "]";
+            return os;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_ENVIRONMENT_CSR_GRAPH_H
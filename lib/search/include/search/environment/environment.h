@@ -6,8 +6,18 @@
  * @brief Abstract class for representing the environment in which the search algorithm operates.
  */
 
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <atomic>
+#include <future>
+#include <thread>
 #include <utils/constants.h>
 #include <search/node/node.h>
+#include <search/search/workspace.h>
+#include <search/search/batch_result.h>
+#include <search/parallel/executor.h>
+#include <search/parallel/parallel_for.h>
 
 namespace search
 {
@@ -23,6 +33,7 @@ namespace search
     {
 
         using SearchAlgorithm = utils::SearchAlgorithm;
+        using TaskPriority = utils::TaskPriority;
 
     public:
         /**
@@ -55,8 +66,156 @@ namespace search
             const Node<T, D> &start_node,
             const Node<T, D> &goal_node,
             SearchAlgorithm search_algorithm = SearchAlgorithm::DFS) const = 0;
+
+        /**
+         * @brief Perform space search reusing the scratch memory of `workspace` and return paths from start to goal.
+         * The default implementation ignores the workspace - environments override it to run allocation free and to let the
+         * searches poll the cancellation token of the workspace (see `CancellationToken`).
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc).
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        virtual const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm,
+            SearchWorkspace &) const
+        {
+            return search(start_node, goal_node, search_algorithm);
+        }
+
+        /**
+         * @brief Queue a space search on an executor and return its path through a future. The environment must be initialized
+         * and left unchanged until the future is ready, which makes concurrent queries safe on every environment whose searches
+         * only read it - environments whose searches write to them override it to serialize their queries (see
+         * `ImplicitEnvironment`). Every worker thread keeps one `SearchWorkspace` per node type that it reuses across queries.
+         * The environment, the nodes and the token must outlive the search.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc) - default is DFS.
+         * @param priority priority of the query on the executor - default is normal.
+         * @param token cancellation token polled by the search, nullptr to run it to completion - default is nullptr.
+         * @param executor executor that runs the search - default is the process wide executor.
+         * @return std::future of a vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        virtual std::future<std::vector<std::pair<const Node<T, D> *, double>>> search_async(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm = SearchAlgorithm::DFS,
+            const TaskPriority priority = TaskPriority::NORMAL,
+            const CancellationToken *token = nullptr,
+            WorkStealingExecutor &executor = WorkStealingExecutor::get_default()) const
+        {
+            return executor.submit([this, start = &start_node, goal = &goal_node, search_algorithm, token]()
+                                   { return this->_search_on_thread(*start, *goal, search_algorithm, token); },
+                                   priority);
+        }
+
+        /**
+         * @brief Answer a batch of start to goal queries, handing them out one at a time to `num_threads` threads - each with
+         * its own `SearchWorkspace`. The environment must be initialized and left unchanged while the batch runs. The default
+         * implementation runs every query through `search`, indexed environments derive from `BatchSearchEnvironment` to run
+         * the queries sharing a start as one one-to-many search.
+         * @param queries start and goal of every query.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc).
+         * @param num_threads number of threads answering the queries - default is the number of hardware threads.
+         * @return SearchBatchResult<T, D> path of every query in columnar form, in query order.
+         */
+        virtual SearchBatchResult<T, D> search_batch(
+            const std::span<const SearchQuery<T, D>> queries,
+            SearchAlgorithm search_algorithm,
+            const std::size_t num_threads = std::thread::hardware_concurrency()) const
+        {
+            std::vector<typename SearchBatchResult<T, D>::Buffer> buffers(std::clamp<std::size_t>(queries.size(), 1, std::max<std::size_t>(num_threads, 1)));
+            std::atomic<std::size_t> next_query = 0;
+            const std::size_t num_chunks = parallel_for(buffers.size(), num_threads, [&](const std::size_t chunk, const std::size_t, const std::size_t)
+                                                        {
+                SearchWorkspace workspace;
+                for (std::size_t query = next_query.fetch_add(1, std::memory_order_relaxed); query < queries.size();
+                     query = next_query.fetch_add(1, std::memory_order_relaxed))
+                {
+                    buffers[chunk].add(query, this->search(*queries[query].start_node, *queries[query].goal_node, search_algorithm, workspace));
+                } },
+                                                        1);
+            return SearchBatchResult<T, D>(queries.size(), std::span<const typename SearchBatchResult<T, D>::Buffer>(buffers.data(), num_chunks));
+        }
+
+    protected:
+        // Run a search with the workspace of the calling thread, polling `token` until it returns or throws
+        std::vector<std::pair<const Node<T, D> *, double>> _search_on_thread(const Node<T, D> &start_node,
+                                                                              const Node<T, D> &goal_node,
+                                                                              SearchAlgorithm search_algorithm,
+                                                                              const CancellationToken *token) const
+        {
+            thread_local SearchWorkspace workspace;
+            const CancellationScope scope(workspace, token);
+            return this->search(start_node, goal_node, search_algorithm, workspace);
+        }
     };
 
+    /**
+     * @concept IndexedEnvironment
+     * @brief An environment whose nodes are addressed by dense `uint32_t` ids in `[0, get_num_nodes())`.
+     * Search algorithms use the id based interface to run over flat arrays instead of pointer keyed maps.
+     * `for_each_edge(id, visit)` calls `visit(neighbor_id, edge_cost)` for every out edge of `id`. Environments that discover
+     * their nodes while they are searched may visit ids past the `get_num_nodes()` seen when the search started.
+     * @tparam E Environment type.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename E, typename T, unsigned int D>
+    concept IndexedEnvironment = std::derived_from<E, Environment<T, D>> &&
+                                 requires(const E &env, const Node<T, D> &node, const std::uint32_t id) {
+                                     { env.get_num_nodes() } -> std::convertible_to<std::size_t>;
+                                     { env.get_node_id(node) } -> std::same_as<std::uint32_t>;
+                                     { env.get_node(id) } -> std::convertible_to<const Node<T, D> *>;
+                                     { env.get_node_value(id) } -> std::convertible_to<const NodeValue<T, D> &>;
+                                     env.for_each_edge(id, [](const std::uint32_t, const double) {});
+                                 };
+
+    /**
+     * @concept AdjacencyEnvironment
+     * @brief An indexed environment that exposes its out and in adjacency as contiguous id spans.
+     * @tparam E Environment type.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename E, typename T, unsigned int D>
+    concept AdjacencyEnvironment = IndexedEnvironment<E, T, D> &&
+                                   requires(const E &env, const std::uint32_t id) {
+                                       { env.get_num_edges() } -> std::convertible_to<std::size_t>;
+                                       { env.get_neighbor_ids(id) } -> std::convertible_to<std::span<const std::uint32_t>>;
+                                       { env.get_predecessor_ids(id) } -> std::convertible_to<std::span<const std::uint32_t>>;
+                                   };
+
+    /**
+     * @concept ConcurrentEnvironment
+     * @brief An indexed environment whose searches only read it, so several of them may run at once on different threads.
+     * Environments opt in with a `static constexpr bool is_concurrent = true` member (see `BatchSearchEnvironment`).
+     * @tparam E Environment type.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename E, typename T, unsigned int D>
+    concept ConcurrentEnvironment = IndexedEnvironment<E, T, D> &&
+                                    requires { requires E::is_concurrent; };
+
+    /**
+     * @concept VersionedEnvironment
+     * @brief An indexed environment whose version changes whenever its edges or edge costs change, so results computed
+     * against it can be invalidated.
+     * @tparam E Environment type.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename E, typename T, unsigned int D>
+    concept VersionedEnvironment = IndexedEnvironment<E, T, D> &&
+                                   requires(const E &env) {
+                                       { env.get_version() } -> std::convertible_to<std::uint64_t>;
+                                   };
+
 } // namespace search
 
 #endif // SEARCH_ENVIRONMENT_ENVIRONMENT_H
\ No newline at end of file
@@ -6,10 +6,20 @@
  * @brief A graph based environment for search algorithms.
  */
 
+#include <memory_resource>
 #include <plog/Log.h>
 #include <search/cost/cost.h>
 #include <search/environment/environment.h>
+#include <search/environment/csr_adjacency.h>
+#include <search/environment/indexed_graph.h>
 #include <search/search/dfs.h>
+#include <search/search/bfs.h>
+#include <search/search/ucs.h>
+#include <search/search/a_star.h>
+#include <search/search/ida_star.h>
+#include <search/search/sma_star.h>
+#include <search/search/ara_star.h>
+#include <search/search/batch_search.h>
 
 namespace search
 {
@@ -17,48 +27,102 @@ namespace search
     /**
      * @class Graph
      * @brief This class represents a graph based environment (nodes connected by edges) in which the search algorithm operates.
+     * The node list, edge list and node id lookup are allocated from a `std::pmr::memory_resource` - pass the one of a
+     * `NodeArena` to keep the whole graph in the arena.
      * @tparam T Type.
      * @tparam D Dimension.
      */
     template <typename T, unsigned int D>
-    class Graph : public Environment<T, D>
+    class Graph : public BatchSearchEnvironment<T, D, Graph<T, D>>
     {
 
         using SearchAlgorithm = utils::SearchAlgorithm;
 
     private:
         // Edges between nodes
-        std::vector<std::pair<std::size_t, std::size_t>> edges_;
+        std::pmr::vector<std::pair<std::size_t, std::size_t>> edges_;
 
         // List of nodes
-        std::vector<Node<T, D> *> nodes_;
+        std::pmr::vector<Node<T, D> *> nodes_;
 
         // Cost functions - pointer because we usually pass a child class of Cost<T, D> and we need polymorphism
         const Cost<T, D> *cost_function_;
 
-        // Function to create connected graph
+        // Node to node id (index in `nodes_`) lookup
+        std::pmr::unordered_map<const Node<T, D> *, std::uint32_t> node_ids_;
+
+        // Out edges over node ids in CSR form
+        CsrAdjacency adjacency_;
+
+        // In edges over node ids in CSR form (transpose of `adjacency_`)
+        CsrAdjacency reverse_adjacency_;
+
+        // Number of changes (initializations and edge mutations) made to the graph
+        std::uint64_t version_ = 0;
+
+        // Function to create connected graph - runs after `_create_adjacency` so every neighbor list is sized once
         void _create_connected_graph()
         {
             PLOGD << "Creating connected graph.";
+            for (std::uint32_t id = 0; id < nodes_.size(); ++id)
+            {
+                nodes_[id]->reserve_neighbors(adjacency_.get_neighbors(id).size());
+            }
             for (const std::pair<std::size_t, std::size_t> &edge : edges_)
             {
                 nodes_[edge.first]->add_neighbor(nodes_[edge.second]);
             }
         }
 
+        // Function to create the id based view of the graph used by the indexed search algorithms
+        void _create_adjacency()
+        {
+            PLOGD << "Creating graph adjacency.";
+            adjacency_ = CsrAdjacency(nodes_.size(), edges_);
+            reverse_adjacency_ = adjacency_.transpose();
+            index_nodes(nodes_, node_ids_);
+        }
+
+        // Function to check that a node id is part of the graph
+        void _check_node_id(const std::uint32_t id) const
+        {
+            if (id >= nodes_.size())
+            {
+                PLOGE << "Node id " << id << " is out of range for " << nodes_.size() << " nodes";
+                throw std::out_of_range("Node id out of range");
+            }
+        }
+
+        // Function to find the first edge between two nodes, throws when there is none
+        std::size_t _find_edge(const std::uint32_t from_id, const std::uint32_t to_id) const
+        {
+            this->_check_node_id(from_id);
+            this->_check_node_id(to_id);
+            const std::size_t edge = adjacency_.find_edge(from_id, to_id);
+            if (edge == adjacency_.get_num_edges())
+            {
+                PLOGE << "There is no edge from node id " << from_id << " to node id " << to_id;
+                throw std::invalid_argument("Edge is not part of the graph");
+            }
+            return edge;
+        }
+
     public:
         /**
          * @brief Construct a new Graph object.
          * @param nodes list of nodes in the graph (raw pointers).
          * @param edges list of edges in the graph.
          * @param cost_function cost function for the graph.
+         * @param resource memory resource of the graph containers - default is the default memory resource.
          */
         Graph(const std::vector<Node<T, D> *> &nodes,
               const std::vector<std::pair<std::size_t, std::size_t>> &edges,
-              const Cost<T, D> &cost_function)
-            : nodes_(nodes),
-              edges_(edges),
-              cost_function_(&cost_function)
+              const Cost<T, D> &cost_function,
+              std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+            : edges_(edges.begin(), edges.end(), resource),
+              nodes_(nodes.begin(), nodes.end(), resource),
+              cost_function_(&cost_function),
+              node_ids_(resource)
         {
             PLOGD << "Initializing Graph object with " << nodes_.size() << " raw nodes pointers and " << edges_.size() << " edges.";
         }
@@ -68,15 +132,20 @@ namespace search
          * @param nodes list of nodes in the graph (smart pointers).
          * @param edges list of edges in the graph.
          * @param cost_function cost function for the graph.
+         * @param resource memory resource of the graph containers - default is the default memory resource.
          */
         Graph(const std::vector<std::unique_ptr<Node<T, D>>> &nodes,
               const std::vector<std::pair<std::size_t, std::size_t>> &edges,
-              const Cost<T, D> &cost_function)
-            : edges_(edges),
-              cost_function_(&cost_function)
+              const Cost<T, D> &cost_function,
+              std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+            : edges_(edges.begin(), edges.end(), resource),
+              nodes_(resource),
+              cost_function_(&cost_function),
+              node_ids_(resource)
         {
             PLOGD << "Initializing Graph object with " << nodes.size() << " smart nodes pointers and " << edges_.size() << " edges.";
             // Convert unique_ptr to raw pointers for internal use
+            nodes_.reserve(nodes.size());
             for (const std::unique_ptr<Node<T, D>> &node : nodes)
             {
                 nodes_.emplace_back(node.get());
@@ -92,12 +161,162 @@ namespace search
         }
 
         /**
-         * @brief Initialize the graph.
+         * @brief Initialize the graph. Edge costs are evaluated through the cost function on every expansion.
          */
         void initialize() override
+        {
+            this->initialize(false);
+        }
+
+        /**
+         * @brief Initialize the graph.
+         * @param precompute_edge_costs when true the cost function is evaluated once per edge and searches read the stored
+         * costs instead of calling it - the cost function and node values must not change afterwards.
+         */
+        void initialize(const bool precompute_edge_costs)
         {
             PLOGD << "Initializing Graph based environment.";
+            this->_create_adjacency();
             this->_create_connected_graph();
+            if (precompute_edge_costs)
+            {
+                evaluate_edge_costs(adjacency_, nodes_, *cost_function_);
+            }
+            ++version_;
+        }
+
+        /**
+         * @brief Add an edge to an initialized graph. With precomputed edge costs the cost function is evaluated for the new edge.
+         * Costs O(number of edges) - the CSR arrays are shifted.
+         * @param from_id id of the source node.
+         * @param to_id id of the target node.
+         */
+        void add_edge(const std::uint32_t from_id, const std::uint32_t to_id)
+        {
+            this->_check_node_id(from_id);
+            this->_check_node_id(to_id);
+            PLOGD << "Adding edge from node id " << from_id << " to node id " << to_id;
+            const double edge_cost = adjacency_.has_weights() ? cost_function_->get_cost(*nodes_[from_id], *nodes_[to_id]) : 0.0;
+            adjacency_.insert_edge(from_id, to_id, edge_cost);
+            reverse_adjacency_.insert_edge(to_id, from_id);
+            edges_.emplace_back(from_id, to_id);
+            nodes_[from_id]->add_neighbor(nodes_[to_id]);
+            ++version_;
+        }
+
+        /**
+         * @brief Add an edge with a given cost to an initialized graph - edge costs are precomputed first if they are not yet.
+         * Costs O(number of edges) - the CSR arrays are shifted.
+         * @param from_id id of the source node.
+         * @param to_id id of the target node.
+         * @param edge_cost cost of the edge.
+         */
+        void add_edge(const std::uint32_t from_id, const std::uint32_t to_id, const double edge_cost)
+        {
+            if (!adjacency_.has_weights())
+            {
+                evaluate_edge_costs(adjacency_, nodes_, *cost_function_);
+            }
+            this->add_edge(from_id, to_id);
+            adjacency_.set_weight(adjacency_.get_offset(from_id + 1) - 1, edge_cost);
+        }
+
+        /**
+         * @brief Remove the first edge between two nodes of an initialized graph. Costs O(number of edges) - the CSR arrays are shifted.
+         * @param from_id id of the source node.
+         * @param to_id id of the target node.
+         */
+        void remove_edge(const std::uint32_t from_id, const std::uint32_t to_id)
+        {
+            const std::size_t edge = this->_find_edge(from_id, to_id);
+            PLOGD << "Removing edge from node id " << from_id << " to node id " << to_id;
+            adjacency_.erase_edge(from_id, edge);
+            reverse_adjacency_.erase_edge(to_id, reverse_adjacency_.find_edge(to_id, from_id));
+            edges_.erase(std::find(edges_.begin(), edges_.end(), std::pair<std::size_t, std::size_t>(from_id, to_id)));
+            nodes_[from_id]->remove_neighbor(nodes_[to_id]);
+            ++version_;
+        }
+
+        /**
+         * @brief Change the cost of the first edge between two nodes of an initialized graph in O(out degree) - edge costs
+         * are precomputed first if they are not yet, after which the cost function is no longer consulted by the searches.
+         * Calling `initialize` again drops the updated costs.
+         * @param from_id id of the source node.
+         * @param to_id id of the target node.
+         * @param edge_cost new cost of the edge.
+         */
+        void update_edge_cost(const std::uint32_t from_id, const std::uint32_t to_id, const double edge_cost)
+        {
+            const std::size_t edge = this->_find_edge(from_id, to_id);
+            PLOGD << "Updating the cost of the edge from node id " << from_id << " to node id " << to_id << " to " << edge_cost;
+            if (!adjacency_.has_weights())
+            {
+                evaluate_edge_costs(adjacency_, nodes_, *cost_function_);
+            }
+            adjacency_.set_weight(edge, edge_cost);
+            ++version_;
+        }
+
+        /**
+         * @brief Replace the cost function of the graph. With precomputed edge costs every edge cost is evaluated again, which
+         * drops the costs set by `update_edge_cost`.
+         * @param cost_function new cost function - must outlive the graph.
+         */
+        void set_cost_function(const Cost<T, D> &cost_function)
+        {
+            PLOGD << "Setting the cost function of the graph.";
+            cost_function_ = &cost_function;
+            if (adjacency_.has_weights())
+            {
+                evaluate_edge_costs(adjacency_, nodes_, *cost_function_);
+            }
+            ++version_;
+        }
+
+        /**
+         * @brief Get the cost function of the graph.
+         * @return const Cost<T, D>& cost function.
+         */
+        const Cost<T, D> &get_cost_function() const
+        {
+            return *cost_function_;
+        }
+
+        /**
+         * @brief Get the version of the graph - it changes on every `initialize`, edge mutation and cost function change, so
+         * it can be used to tell whether results computed earlier are still valid.
+         * @return std::uint64_t version of the graph.
+         */
+        std::uint64_t get_version() const
+        {
+            return version_;
+        }
+
+        /**
+         * @brief Check whether the edge costs were precomputed by `initialize`.
+         * @return true if the edge costs are stored, false if they are evaluated on every expansion.
+         */
+        bool has_precomputed_edge_costs() const
+        {
+            return adjacency_.has_weights();
+        }
+
+        /**
+         * @brief Get the number of nodes in the graph.
+         * @return std::size_t number of nodes.
+         */
+        std::size_t get_num_nodes() const
+        {
+            return nodes_.size();
+        }
+
+        /**
+         * @brief Get the number of edges in the graph.
+         * @return std::size_t number of edges.
+         */
+        std::size_t get_num_edges() const
+        {
+            return edges_.size();
         }
 
         /**
@@ -112,7 +331,81 @@ namespace search
         }
 
         /**
-         * @brief Get the cost of going from node A to node B (`from_node` to `to_node`) | A -> B.
+         * @brief Get the id (index) of a node.
+         * @param node node in the graph.
+         * @return std::uint32_t id of the node.
+         */
+        std::uint32_t get_node_id(const Node<T, D> &node) const
+        {
+            const auto it = node_ids_.find(&node);
+            if (it == node_ids_.end())
+            {
+                PLOGE << "Node " << node.get_name() << " is not part of the graph";
+                throw std::invalid_argument("Node is not part of the graph");
+            }
+            return it->second;
+        }
+
+        /**
+         * @brief Get the value of a node.
+         * @param id node id.
+         * @return const NodeValue<T, D>& value of the node.
+         */
+        const NodeValue<T, D> &get_node_value(const std::uint32_t id) const
+        {
+            return nodes_[id]->get_node_value();
+        }
+
+        /**
+         * @brief Get the neighbor ids (out edge targets) of a node.
+         * @param id node id.
+         * @return std::span<const std::uint32_t> neighbor ids.
+         */
+        std::span<const std::uint32_t> get_neighbor_ids(const std::uint32_t id) const
+        {
+            return adjacency_.get_neighbors(id);
+        }
+
+        /**
+         * @brief Get the predecessor ids (in edge sources) of a node.
+         * @param id node id.
+         * @return std::span<const std::uint32_t> predecessor ids.
+         */
+        std::span<const std::uint32_t> get_predecessor_ids(const std::uint32_t id) const
+        {
+            return reverse_adjacency_.get_neighbors(id);
+        }
+
+        /**
+         * @brief Visit every out edge of a node.
+         * @tparam F Visitor type - callable as `visit(neighbor_id, edge_cost)`.
+         * @param id node id.
+         * @param visit visitor.
+         */
+        template <typename F>
+        void for_each_edge(const std::uint32_t id, F &&visit) const
+        {
+            const std::size_t begin = adjacency_.get_offset(id);
+            const std::size_t end = adjacency_.get_offset(id + 1);
+            if (adjacency_.has_weights())
+            {
+                for (std::size_t edge = begin; edge < end; ++edge)
+                {
+                    visit(adjacency_.get_target(edge), adjacency_.get_weight(edge));
+                }
+                return;
+            }
+            const Node<T, D> &from_node = *nodes_[id];
+            for (std::size_t edge = begin; edge < end; ++edge)
+            {
+                const std::uint32_t to_id = adjacency_.get_target(edge);
+                visit(to_id, cost_function_->get_cost(from_node, *nodes_[to_id]));
+            }
+        }
+
+        /**
+         * @brief Get the cost of going from node A to node B (`from_node` to `to_node`) | A -> B - the stored cost of the
+         * edge between them when edge costs are precomputed, the cost function otherwise.
          * @param from_node node A.
          * @param to_node node B.
          * @return const double cost of going `from_node` to `to_node`.
@@ -121,11 +414,26 @@ namespace search
                               const Node<T, D> &to_node) const override
         {
             PLOGD << "Getting cost from node: " << from_node.get_name() << " to node: " << to_node.get_name();
+            if (adjacency_.has_weights())
+            {
+                const auto from_it = node_ids_.find(&from_node);
+                const auto to_it = node_ids_.find(&to_node);
+                if (from_it != node_ids_.end() && to_it != node_ids_.end())
+                {
+                    const std::size_t edge = adjacency_.find_edge(from_it->second, to_it->second);
+                    if (edge != adjacency_.get_num_edges())
+                    {
+                        return adjacency_.get_weight(edge);
+                    }
+                }
+            }
             return cost_function_->get_cost(from_node, to_node);
         }
 
         /**
          * @brief Perform space search and return paths from start to goal for a graph based environment.
+         * The informed searches (A*, IDA*, SMA* and ARA*) use the `CostHeuristic` of the cost function - the distance of a
+         * `DistanceCost` and no estimate otherwise. Use `AStar` directly for other heuristics or weighted A*.
          * @param start_node The starting node.
          * @param goal_node The goal node.
          * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc) - default is DFS.
@@ -135,27 +443,53 @@ namespace search
             const Node<T, D> &start_node,
             const Node<T, D> &goal_node,
             SearchAlgorithm search_algorithm = SearchAlgorithm::DFS) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, search_algorithm, workspace);
+        }
+
+        /**
+         * @brief Perform space search reusing the scratch memory of `workspace` and return paths from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc).
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm,
+            SearchWorkspace &workspace) const override
         {
             PLOGD << "Performing search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
             switch (search_algorithm)
             {
             case SearchAlgorithm::DFS:
                 PLOGD << "Using DFS search algorithm.";
-                return DFS<T, D, Graph<T, D>>().search(start_node, goal_node, *this);
+                return DFS<T, D, Graph<T, D>>().search(start_node, goal_node, *this, workspace);
             case SearchAlgorithm::BFS:
                 PLOGD << "Using BFS search algorithm.";
-                break;
+                return BFS<T, D, Graph<T, D>>().search(start_node, goal_node, *this, workspace);
             case SearchAlgorithm::UCS:
                 PLOGD << "Using UCS search algorithm.";
-                break;
+                return UCS<T, D, Graph<T, D>>().search(start_node, goal_node, *this, workspace);
             case SearchAlgorithm::A_STAR:
                 PLOGD << "Using A* search algorithm.";
-                break;
+                return AStar<T, D, Graph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(cost_function_)).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::IDA_STAR:
+                PLOGD << "Using IDA* search algorithm.";
+                return IdaStar<T, D, Graph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(cost_function_)).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::SMA_STAR:
+                PLOGD << "Using SMA* search algorithm.";
+                return SmaStar<T, D, Graph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(cost_function_)).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::ARA_STAR:
+                PLOGD << "Using ARA* search algorithm.";
+                return AraStar<T, D, Graph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(cost_function_)).search(start_node, goal_node, *this, workspace);
             default:
                 PLOGE << "Unknown search algorithm.";
                 throw std::invalid_argument("Unknown search algorithm.");
             }
-            return {};
         }
 
         /**
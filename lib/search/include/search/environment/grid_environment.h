@@ -0,0 +1,503 @@
+#ifndef SEARCH_ENVIRONMENT_GRID_ENVIRONMENT_H
+#define SEARCH_ENVIRONMENT_GRID_ENVIRONMENT_H
+
+/**
+ * @file grid_environment.h
+ * @brief An occupancy grid environment whose neighbors are generated from cell coordinates.
+ */
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <plog/Log.h>
+#include <search/node/node_pool.h>
+#include <search/environment/environment.h>
+#include <search/search/dfs.h>
+#include <search/search/bfs.h>
+#include <search/search/ucs.h>
+#include <search/search/a_star.h>
+#include <search/search/ida_star.h>
+#include <search/search/sma_star.h>
+#include <search/search/ara_star.h>
+#include <search/search/batch_search.h>
+#include <search/search/jps.h>
+
+namespace search
+{
+
+    /**
+     * @class GridEnvironment
+     * @brief This class represents a `D` dimensional occupancy grid. Only a packed bitmap of blocked cells is stored - one bit
+     * per cell - and the neighbors of a cell are generated from its coordinates, so a 4096 x 4096 map takes 2 MiB. Cell ids
+     * are row major with the first coordinate varying fastest, and the value of a node is its cell coordinates. Moves go to
+     * the 2 * D axis neighbors and, when diagonal moves are allowed, to every other cell of the surrounding 3^D block as long
+     * as no blocked cell is cut on the way (every axis step of the move must be free). A move costs its Euclidean length.
+     * `Node` objects are only materialized (with the `DENSE` identity) for the cells handed out by `get_node`, i.e. the
+     * start, goal and path cells, and they are kept until the next `initialize`.
+     * The compact footprint is that of the map only. Every search runs on a `SearchWorkspace`, whose dense per node arrays
+     * are sized to the whole grid on its first query - about 28 bytes per cell, so roughly 450 MiB for a 4096 x 4096 map,
+     * whatever the number of cells the search visits. Keep one workspace per thread and reuse it across queries (the
+     * `search` overload without a workspace builds a new one every time).
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class GridEnvironment : public BatchSearchEnvironment<T, D, GridEnvironment<T, D>>
+    {
+
+        using SearchAlgorithm = utils::SearchAlgorithm;
+
+    public:
+        // Cell coordinates
+        using Coordinates = std::array<std::uint32_t, D>;
+
+    private:
+        // Move to a neighboring cell
+        struct Move
+        {
+            std::array<int, D> delta; // Coordinate change
+            std::int64_t id_delta;    // Cell id change
+            double cost;              // Euclidean length
+        };
+
+        // Number of cells along every axis
+        Coordinates shape_;
+
+        // Cell id change of a unit step along every axis
+        std::array<std::uint64_t, D> strides_;
+
+        // Number of cells
+        std::size_t num_nodes_ = 1;
+
+        // Whether diagonal moves are allowed
+        bool allow_diagonal_;
+
+        // Blocked cells - one bit per cell id
+        std::vector<std::uint64_t> blocked_;
+
+        // Moves to the neighboring cells
+        std::vector<Move> moves_;
+
+        // Lazily materialized nodes
+        mutable NodePool<T, D> node_pool_;
+
+        // Function to create the moves to the neighboring cells
+        void _create_moves()
+        {
+            std::array<int, D> delta;
+            delta.fill(-1);
+            while (true)
+            {
+                std::size_t num_axes = 0;
+                std::int64_t id_delta = 0;
+                for (unsigned int d = 0; d < D; ++d)
+                {
+                    num_axes += delta[d] != 0;
+                    id_delta += delta[d] * static_cast<std::int64_t>(strides_[d]);
+                }
+                if (num_axes == 1 || (num_axes > 1 && allow_diagonal_))
+                {
+                    moves_.push_back({delta, id_delta, std::sqrt(static_cast<double>(num_axes))});
+                }
+                // Next delta in {-1, 0, 1}^D
+                unsigned int d = 0;
+                while (d < D && delta[d] == 1)
+                {
+                    delta[d++] = -1;
+                }
+                if (d == D)
+                {
+                    break;
+                }
+                ++delta[d];
+            }
+        }
+
+        // Check that a node id is part of the grid
+        void _check_node_id(const std::uint32_t id) const
+        {
+            if (id >= num_nodes_)
+            {
+                PLOGE << "Cell id " << id << " is out of range for " << num_nodes_ << " cells";
+                throw std::out_of_range("Cell id out of range");
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new GridEnvironment object with every cell free.
+         * @param shape number of cells along every axis.
+         * @param allow_diagonal whether diagonal moves are allowed - default is false (axis moves only).
+         */
+        GridEnvironment(const Coordinates &shape,
+                        const bool allow_diagonal = false)
+            : shape_(shape),
+              allow_diagonal_(allow_diagonal)
+        {
+            PLOGD << "Initializing GridEnvironment object with " << D << " dimensions.";
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                if (shape_[d] == 0)
+                {
+                    PLOGE << "Grid axis " << d << " has no cells";
+                    throw std::invalid_argument("Grid axes must have at least one cell");
+                }
+                strides_[d] = num_nodes_;
+                num_nodes_ *= shape_[d];
+                if (num_nodes_ > std::numeric_limits<std::uint32_t>::max())
+                {
+                    PLOGE << "Grid has more cells than the 32-bit node id range";
+                    throw std::invalid_argument("Number of cells exceeds the 32-bit node id range");
+                }
+            }
+            blocked_.assign((num_nodes_ + 63) / 64, 0);
+            this->_create_moves();
+        }
+
+        /**
+         * @brief Destructor for the GridEnvironment class.
+         */
+        ~GridEnvironment()
+        {
+            PLOGD << "Destroying GridEnvironment object.";
+        }
+
+        /**
+         * @brief Initialize the grid - the grid is usable right after construction, so this only drops the materialized nodes.
+         */
+        void initialize() override
+        {
+            PLOGD << "Initializing Grid based environment.";
+            node_pool_.clear();
+        }
+
+        /**
+         * @brief Get the number of cells along every axis.
+         * @return const Coordinates& shape of the grid.
+         */
+        const Coordinates &get_shape() const
+        {
+            return shape_;
+        }
+
+        /**
+         * @brief Check whether diagonal moves are allowed.
+         * @return true if diagonal moves are allowed, false otherwise.
+         */
+        bool allows_diagonal() const
+        {
+            return allow_diagonal_;
+        }
+
+        /**
+         * @brief Get the number of cells in the grid.
+         * @return std::size_t number of cells.
+         */
+        std::size_t get_num_nodes() const
+        {
+            return num_nodes_;
+        }
+
+        /**
+         * @brief Get the id of a cell.
+         * @param coordinates cell coordinates - must be inside the grid.
+         * @return std::uint32_t id of the cell.
+         */
+        std::uint32_t get_id(const Coordinates &coordinates) const
+        {
+            std::uint64_t id = 0;
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                id += coordinates[d] * strides_[d];
+            }
+            return static_cast<std::uint32_t>(id);
+        }
+
+        /**
+         * @brief Get the coordinates of a cell.
+         * @param id id of the cell.
+         * @return Coordinates cell coordinates.
+         */
+        Coordinates get_coordinates(std::uint32_t id) const
+        {
+            Coordinates coordinates;
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                coordinates[d] = id % shape_[d];
+                id /= shape_[d];
+            }
+            return coordinates;
+        }
+
+        /**
+         * @brief Check whether a cell is blocked.
+         * @param id id of the cell.
+         * @return true if the cell is blocked, false otherwise.
+         */
+        bool is_blocked(const std::uint32_t id) const
+        {
+            return (blocked_[id >> 6] >> (id & 63)) & 1ULL;
+        }
+
+        /**
+         * @brief Check whether signed coordinates are inside the grid and name a free cell.
+         * @param coordinates cell coordinates - may lie outside the grid.
+         * @return true if the cell exists and is free, false otherwise.
+         */
+        bool is_free(const std::array<std::int64_t, D> &coordinates) const
+        {
+            std::uint64_t id = 0;
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                if (coordinates[d] < 0 || coordinates[d] >= static_cast<std::int64_t>(shape_[d]))
+                {
+                    return false;
+                }
+                id += static_cast<std::uint64_t>(coordinates[d]) * strides_[d];
+            }
+            return !this->is_blocked(static_cast<std::uint32_t>(id));
+        }
+
+        /**
+         * @brief Block or free a cell.
+         * @param id id of the cell.
+         * @param blocked whether the cell is blocked - default is true.
+         */
+        void set_blocked(const std::uint32_t id, const bool blocked = true)
+        {
+            this->_check_node_id(id);
+            if (blocked)
+            {
+                blocked_[id >> 6] |= 1ULL << (id & 63);
+            }
+            else
+            {
+                blocked_[id >> 6] &= ~(1ULL << (id & 63));
+            }
+        }
+
+        /**
+         * @brief Block or free a cell.
+         * @param coordinates cell coordinates.
+         * @param blocked whether the cell is blocked - default is true.
+         */
+        void set_blocked(const Coordinates &coordinates, const bool blocked = true)
+        {
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                if (coordinates[d] >= shape_[d])
+                {
+                    PLOGE << "Cell coordinate " << coordinates[d] << " is out of range for axis " << d;
+                    throw std::out_of_range("Cell coordinates out of range");
+                }
+            }
+            this->set_blocked(this->get_id(coordinates), blocked);
+        }
+
+        /**
+         * @brief Get the node of a cell - materialized on first use.
+         * @param index Index (cell id) of the node to retrieve.
+         * @return const Node<T, D>* Pointer to the node of the cell.
+         */
+        const Node<T, D> *get_node(const std::size_t index) const
+        {
+            const std::uint32_t id = static_cast<std::uint32_t>(index);
+            this->_check_node_id(id);
+            return node_pool_.get(id, [&]()
+                                  { return std::make_unique<Node<T, D>>(this->get_node_value(id), "", utils::NodeIdentity::DENSE); });
+        }
+
+        /**
+         * @brief Get the cell id of a node - the node is either handed out by `get_node` or any node whose value holds the
+         * coordinates of a cell.
+         * @param node node.
+         * @return std::uint32_t id of the cell.
+         */
+        std::uint32_t get_node_id(const Node<T, D> &node) const
+        {
+            const std::optional<std::uint32_t> id = node_pool_.find_id(node);
+            if (id)
+            {
+                return *id;
+            }
+            Coordinates coordinates;
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                const T value = node.get_node_value().value(d);
+                if (!(value >= T(0) && value < static_cast<T>(shape_[d])) || value != std::floor(value))
+                {
+                    PLOGE << "Node " << node.get_name() << " does not name a cell of the grid";
+                    throw std::invalid_argument("Node is not part of the grid");
+                }
+                coordinates[d] = static_cast<std::uint32_t>(value);
+            }
+            return this->get_id(coordinates);
+        }
+
+        /**
+         * @brief Get the value of a node - its cell coordinates.
+         * @param id cell id.
+         * @return NodeValue<T, D> value of the node.
+         */
+        NodeValue<T, D> get_node_value(const std::uint32_t id) const
+        {
+            const Coordinates coordinates = this->get_coordinates(id);
+            NodeValue<T, D> node_value;
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                node_value.value(d) = static_cast<T>(coordinates[d]);
+            }
+            return node_value;
+        }
+
+        /**
+         * @brief Visit every move out of a cell. Blocked cells have no moves.
+         * @tparam F Visitor type - callable as `visit(neighbor_id, edge_cost)`.
+         * @param id cell id.
+         * @param visit visitor.
+         */
+        template <typename F>
+        void for_each_edge(const std::uint32_t id, F &&visit) const
+        {
+            if (this->is_blocked(id))
+            {
+                return;
+            }
+            const Coordinates coordinates = this->get_coordinates(id);
+            for (const Move &move : moves_)
+            {
+                bool valid = true;
+                for (unsigned int d = 0; d < D && valid; ++d)
+                {
+                    const std::int64_t coordinate = static_cast<std::int64_t>(coordinates[d]) + move.delta[d];
+                    valid = coordinate >= 0 && coordinate < static_cast<std::int64_t>(shape_[d]);
+                    // Every axis step of a diagonal move must be free
+                    valid = valid && (move.delta[d] == 0 || !this->is_blocked(static_cast<std::uint32_t>(id + move.delta[d] * static_cast<std::int64_t>(strides_[d]))));
+                }
+                const std::uint32_t neighbor_id = static_cast<std::uint32_t>(id + move.id_delta);
+                if (valid && !this->is_blocked(neighbor_id))
+                {
+                    visit(neighbor_id, move.cost);
+                }
+            }
+        }
+
+        /**
+         * @brief Get the cost of going from node A to node B (`from_node` to `to_node`) | A -> B - the Euclidean distance
+         * between their cells.
+         * @param from_node node A.
+         * @param to_node node B.
+         * @return const double cost of going `from_node` to `to_node`.
+         */
+        const double get_cost(const Node<T, D> &from_node,
+                              const Node<T, D> &to_node) const override
+        {
+            PLOGD << "Getting cost from node: " << from_node.get_name() << " to node: " << to_node.get_name();
+            return (from_node.get_node_value().value - to_node.get_node_value().value).template cast<double>().norm();
+        }
+
+        /**
+         * @brief Get the number of bytes held by the occupancy bitmap.
+         * @return std::size_t memory footprint in bytes.
+         */
+        std::size_t get_memory_usage() const
+        {
+            return blocked_.capacity() * sizeof(std::uint64_t);
+        }
+
+        /**
+         * @brief Perform space search and return paths from start to goal for a grid based environment.
+         * A* uses the Euclidean distance heuristic, which never overestimates the move lengths of the grid - use `AStar`
+         * directly for other heuristics or weighted A*.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, JPS, etc) - default is DFS.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm = SearchAlgorithm::DFS) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, search_algorithm, workspace);
+        }
+
+        /**
+         * @brief Perform space search reusing the scratch memory of `workspace` and return paths from start to goal.
+         * JPS is only available on 2D grids with diagonal moves.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, JPS, etc).
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            switch (search_algorithm)
+            {
+            case SearchAlgorithm::DFS:
+                PLOGD << "Using DFS search algorithm.";
+                return DFS<T, D, GridEnvironment<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::BFS:
+                PLOGD << "Using BFS search algorithm.";
+                return BFS<T, D, GridEnvironment<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::UCS:
+                PLOGD << "Using UCS search algorithm.";
+                return UCS<T, D, GridEnvironment<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::A_STAR:
+                PLOGD << "Using A* search algorithm.";
+                return AStar<T, D, GridEnvironment<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::IDA_STAR:
+                PLOGD << "Using IDA* search algorithm.";
+                return IdaStar<T, D, GridEnvironment<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::SMA_STAR:
+                PLOGD << "Using SMA* search algorithm.";
+                return SmaStar<T, D, GridEnvironment<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::ARA_STAR:
+                PLOGD << "Using ARA* search algorithm.";
+                return AraStar<T, D, GridEnvironment<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::JPS:
+                if constexpr (D == 2)
+                {
+                    PLOGD << "Using JPS search algorithm.";
+                    return JPS<T, D, GridEnvironment<T, D>>().search(start_node, goal_node, *this, workspace);
+                }
+                PLOGE << "JPS is only available on 2D grids.";
+                throw std::invalid_argument("JPS is only available on 2D grids.");
+            default:
+                PLOGE << "Unknown search algorithm.";
+                throw std::invalid_argument("Unknown search algorithm.");
+            }
+        }
+
+        /**
+         * @brief << operator - function for streaming the GridEnvironment to an output stream.
+         * @param os output stream.
+         * @param env environment to stream.
+         * @return std::ostream& output stream.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const GridEnvironment<T, D> &env)
+        {
+            os << "GridEnvironment[Shape: ";
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                os << (d > 0 ? " x " : "") << env.shape_[d];
+            }
+            os << " | Diagonal: " << (env.allow_diagonal_ ? "yes" : "no") << "]";
+            return os;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_ENVIRONMENT_GRID_ENVIRONMENT_H
@@ -0,0 +1,422 @@
+#ifndef SEARCH_ENVIRONMENT_IMPLICIT_ENVIRONMENT_H
+#define SEARCH_ENVIRONMENT_IMPLICIT_ENVIRONMENT_H
+
+/**
+ * @file implicit_environment.h
+ * @brief An environment whose states are generated on demand by a user supplied successor generator.
+ */
+
+#include <limits>
+#include <deque>
+#include <vector>
+#include <cstdint>
+#include <mutex>
+#include <memory>
+#include <future>
+#include <functional>
+#include <optional>
+#include <concepts>
+#include <stdexcept>
+#include <plog/Log.h>
+#include <math/types.h>
+#include <search/node/node_pool.h>
+#include <search/container/state_table.h>
+#include <search/environment/environment.h>
+#include <search/search/dfs.h>
+#include <search/search/bfs.h>
+#include <search/search/ucs.h>
+#include <search/search/a_star.h>
+#include <search/search/ida_star.h>
+#include <search/search/sma_star.h>
+#include <search/search/ara_star.h>
+#include <search/search/batch_search.h>
+#include <search/heuristic/heuristic.h>
+
+namespace search
+{
+
+    /**
+     * @concept SuccessorGenerator
+     * @brief A callable that enumerates the successors of a state: `generate(state, emit)` calls `emit(successor, edge_cost)`
+     * once per out edge of `state`. `emit` has an unspecified type, so the generator takes it as a template (`auto &&emit`).
+     * @tparam G Generator type.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename G, typename T, unsigned int D>
+    concept SuccessorGenerator = std::copy_constructible<G> &&
+                                 requires(const G &generate, const math::ColumnVector<T, D> &state) {
+                                     generate(state, [](const math::ColumnVector<T, D> &, const double) {});
+                                 };
+
+    /**
+     * @class ImplicitEnvironment
+     * @brief This class represents a search space that is never built: the successors of a state are produced by a
+     * `SuccessorGenerator` when the state is expanded, and every state seen is interned in a `StateTable` - inline, keyed by
+     * `math::ColumnVectorHasher` - which gives it the dense id the search algorithms run on. Memory grows with the states
+     * actually generated and no state takes an allocation of its own, so searches can reach hundreds of millions of states.
+     * The value of a node is its state, and `Node` objects are only materialized (with the `DENSE` identity) for the states
+     * handed out by `get_node`, typically the path. `get_num_nodes` is the number of states generated so far and grows during
+     * a search, which the `SearchWorkspace` follows. States persist across queries until `initialize` is called. Since
+     * expanding a state interns its successors, the environment is not thread safe - even through the const interface - and
+     * its asynchronous and batch queries run one at a time. The edge costs come from the generator and need not follow any
+     * distance, so the informed searches run with the heuristic `H` given at construction - no estimate unless one is given.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam G Successor generator type.
+     * @tparam H Heuristic of the informed searches - must never overestimate the generated costs.
+     */
+    template <typename T, unsigned int D, typename G, typename H = ZeroHeuristic<T, D>>
+        requires(SuccessorGenerator<G, T, D> && Heuristic<H, T, D>)
+    class ImplicitEnvironment : public BatchSearchEnvironment<T, D, ImplicitEnvironment<T, D, G, H>, false>
+    {
+
+        using SearchAlgorithm = utils::SearchAlgorithm;
+        using TaskPriority = utils::TaskPriority;
+
+    public:
+        // State of a node
+        using State = math::ColumnVector<T, D>;
+
+    private:
+        // Successor generator
+        G generator_;
+
+        // Heuristic of the informed searches
+        H heuristic_;
+
+        // Largest number of states to generate
+        std::size_t max_states_;
+
+        // Generated states by id
+        mutable StateTable<T, D> states_;
+
+        // Lazily materialized nodes
+        mutable NodePool<T, D> node_pool_;
+
+        // Asynchronous query waiting for the one ahead of it to finish
+        struct AsyncQuery
+        {
+            std::function<void()> run;      // Runs the search and fulfils its future
+            TaskPriority priority;          // Priority of the query on the executor
+            WorkStealingExecutor *executor; // Executor that runs the query
+        };
+
+        // Guards the queue of asynchronous queries
+        mutable std::mutex async_mutex_;
+
+        // Asynchronous queries waiting for the running one, oldest first
+        mutable std::deque<AsyncQuery> async_queries_;
+
+        // Whether an asynchronous query is on an executor
+        mutable bool async_running_ = false;
+
+        // Submit an asynchronous query, which submits the next waiting query once it has finished
+        void _submit_async(AsyncQuery query) const
+        {
+            query.executor->submit([this, run = std::move(query.run)]()
+                                   {
+                run();
+                std::optional<AsyncQuery> next;
+                {
+                    const std::lock_guard<std::mutex> lock(async_mutex_);
+                    if (async_queries_.empty())
+                    {
+                        async_running_ = false;
+                        return;
+                    }
+                    next = std::move(async_queries_.front());
+                    async_queries_.pop_front();
+                }
+                this->_submit_async(std::move(*next)); },
+                                   query.priority);
+        }
+
+        // Intern a state, enforcing the state limit
+        std::uint32_t _intern(const State &state) const
+        {
+            if (states_.size() >= max_states_)
+            {
+                const std::optional<std::uint32_t> id = states_.find(state);
+                if (!id)
+                {
+                    PLOGE << "ImplicitEnvironment reached its limit of " << max_states_ << " states";
+                    throw std::length_error("ImplicitEnvironment state limit reached");
+                }
+                return *id;
+            }
+            return states_.insert(state).first;
+        }
+
+    public:
+        /**
+         * @brief Construct a new ImplicitEnvironment object.
+         * @param generator successor generator.
+         * @param max_states largest number of states to generate before a search fails with `std::length_error` - default
+         * is the capacity of the state table.
+         * @param capacity number of states to make room for up front - default is 0.
+         * @param heuristic heuristic of the informed searches - default is `H()`.
+         */
+        explicit ImplicitEnvironment(const G &generator,
+                                     const std::size_t max_states = StateTable<T, D>::max_size(),
+                                     const std::size_t capacity = 0,
+                                     const H &heuristic = H())
+            : generator_(generator),
+              heuristic_(heuristic),
+              max_states_(std::min(max_states, StateTable<T, D>::max_size())),
+              states_(std::min(capacity, max_states_))
+        {
+            PLOGD << "Initializing ImplicitEnvironment object with a limit of " << max_states_ << " states.";
+        }
+
+        /**
+         * @brief Destructor for the ImplicitEnvironment class.
+         */
+        ~ImplicitEnvironment()
+        {
+            PLOGD << "Destroying ImplicitEnvironment object.";
+        }
+
+        /**
+         * @brief Initialize the environment - forgets every generated state and drops the materialized nodes.
+         */
+        void initialize() override
+        {
+            PLOGD << "Initializing Implicit environment.";
+            node_pool_.clear();
+            states_.clear();
+        }
+
+        /**
+         * @brief Get the number of states generated so far.
+         * @return std::size_t number of states.
+         */
+        std::size_t get_num_nodes() const
+        {
+            return states_.size();
+        }
+
+        /**
+         * @brief Get the node of a state - materialized on first use.
+         * @param index Index (state id) of the node to retrieve.
+         * @return const Node<T, D>* Pointer to the node of the state.
+         */
+        const Node<T, D> *get_node(const std::size_t index) const
+        {
+            const std::uint32_t id = static_cast<std::uint32_t>(index);
+            const NodeValue<T, D> node_value = this->get_node_value(id);
+            return node_pool_.get(id, [&]()
+                                  { return std::make_unique<Node<T, D>>(node_value, "", utils::NodeIdentity::DENSE); });
+        }
+
+        /**
+         * @brief Get the state id of a node - the node is either handed out by `get_node` or any node whose value is a state,
+         * which is interned if it was not generated yet.
+         * @param node node.
+         * @return std::uint32_t id of the state.
+         */
+        std::uint32_t get_node_id(const Node<T, D> &node) const
+        {
+            const std::optional<std::uint32_t> id = node_pool_.find_id(node);
+            if (id)
+            {
+                return *id;
+            }
+            return this->_intern(node.get_node_value().value);
+        }
+
+        /**
+         * @brief Get the value of a node - its state.
+         * @param id state id.
+         * @return NodeValue<T, D> value of the node.
+         */
+        NodeValue<T, D> get_node_value(const std::uint32_t id) const
+        {
+            return NodeValue<T, D>{states_.get_state(id)};
+        }
+
+        /**
+         * @brief Visit every successor of a state, interning the successors not generated yet.
+         * @tparam F Visitor type - callable as `visit(neighbor_id, edge_cost)`.
+         * @param id state id.
+         * @param visit visitor.
+         */
+        template <typename F>
+        void for_each_edge(const std::uint32_t id, F &&visit) const
+        {
+            // Copied out - interning a successor may move the stored states
+            const State state = states_.get_state(id);
+            generator_(state, [&](const State &successor, const double edge_cost)
+                       { visit(this->_intern(successor), edge_cost); });
+        }
+
+        /**
+         * @brief Get the cost of going from node A to node B (`from_node` to `to_node`) | A -> B - the cheapest cost the
+         * generator emits for the move.
+         * @param from_node node A.
+         * @param to_node node B.
+         * @return const double cost of going `from_node` to `to_node`.
+         */
+        const double get_cost(const Node<T, D> &from_node,
+                              const Node<T, D> &to_node) const override
+        {
+            PLOGD << "Getting cost from node: " << from_node.get_name() << " to node: " << to_node.get_name();
+            const State &to_state = to_node.get_node_value().value;
+            double cost = std::numeric_limits<double>::infinity();
+            generator_(from_node.get_node_value().value, [&](const State &successor, const double edge_cost)
+                       {
+                if (successor == to_state)
+                {
+                    cost = std::min(cost, edge_cost);
+                } });
+            if (cost == std::numeric_limits<double>::infinity())
+            {
+                PLOGE << "Node " << to_node.get_name() << " is not a successor of node " << from_node.get_name();
+                throw std::invalid_argument("Edge is not part of the environment");
+            }
+            return cost;
+        }
+
+        /**
+         * @brief Get the largest number of states the environment generates.
+         * @return std::size_t state limit.
+         */
+        std::size_t get_max_states() const
+        {
+            return max_states_;
+        }
+
+        /**
+         * @brief Get the number of bytes held by the generated states and their index.
+         * @return std::size_t memory footprint in bytes.
+         */
+        std::size_t get_memory_usage() const
+        {
+            return states_.get_memory_usage();
+        }
+
+        /**
+         * @brief Perform space search and return paths from start to goal for an implicit environment.
+         * The informed searches (A*, IDA*, SMA* and ARA*) use the heuristic of the environment. Use `AStar` directly for
+         * weighted A*.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc) - default is DFS.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm = SearchAlgorithm::DFS) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, search_algorithm, workspace);
+        }
+
+        /**
+         * @brief Perform space search reusing the scratch memory of `workspace` and return paths from start to goal.
+         * Searches that can not find the goal run until the state space or the state limit is exhausted.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc).
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            switch (search_algorithm)
+            {
+            case SearchAlgorithm::DFS:
+                PLOGD << "Using DFS search algorithm.";
+                return DFS<T, D, ImplicitEnvironment<T, D, G, H>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::BFS:
+                PLOGD << "Using BFS search algorithm.";
+                return BFS<T, D, ImplicitEnvironment<T, D, G, H>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::UCS:
+                PLOGD << "Using UCS search algorithm.";
+                return UCS<T, D, ImplicitEnvironment<T, D, G, H>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::A_STAR:
+                PLOGD << "Using A* search algorithm.";
+                return AStar<T, D, ImplicitEnvironment<T, D, G, H>, H>(heuristic_).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::IDA_STAR:
+                PLOGD << "Using IDA* search algorithm.";
+                return IdaStar<T, D, ImplicitEnvironment<T, D, G, H>, H>(heuristic_).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::SMA_STAR:
+                PLOGD << "Using SMA* search algorithm.";
+                return SmaStar<T, D, ImplicitEnvironment<T, D, G, H>, H>(heuristic_).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::ARA_STAR:
+                PLOGD << "Using ARA* search algorithm.";
+                return AraStar<T, D, ImplicitEnvironment<T, D, G, H>, H>(heuristic_).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::JPS:
+                PLOGE << "JPS is only available on grid environments.";
+                throw std::invalid_argument("JPS is only available on grid environments.");
+            default:
+                PLOGE << "Unknown search algorithm.";
+                throw std::invalid_argument("Unknown search algorithm.");
+            }
+        }
+
+        /**
+         * @brief Queue a space search on an executor and return its path through a future. Expanding a state interns its
+         * successors, so the queued queries run one at a time in the order they were queued: each is handed to its executor
+         * once the one ahead of it has finished, and no worker waits on another query. No synchronous search may run until
+         * their futures are ready. The environment, the nodes and the token must outlive the search.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc) - default is DFS.
+         * @param priority priority of the query on the executor - default is normal.
+         * @param token cancellation token polled by the search, nullptr to run it to completion - default is nullptr.
+         * @param executor executor that runs the search - default is the process wide executor.
+         * @return std::future of a vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        std::future<std::vector<std::pair<const Node<T, D> *, double>>> search_async(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm = SearchAlgorithm::DFS,
+            const TaskPriority priority = TaskPriority::NORMAL,
+            const CancellationToken *token = nullptr,
+            WorkStealingExecutor &executor = WorkStealingExecutor::get_default()) const override
+        {
+            using Path = std::vector<std::pair<const Node<T, D> *, double>>;
+            // std::function needs a copyable callable - share the packaged task
+            auto task = std::make_shared<std::packaged_task<Path()>>([this, start = &start_node, goal = &goal_node, search_algorithm, token]()
+                                                                     { return this->_search_on_thread(*start, *goal, search_algorithm, token); });
+            std::future<Path> result = task->get_future();
+            AsyncQuery query{[task]()
+                             { (*task)(); },
+                             priority,
+                             &executor};
+            {
+                const std::lock_guard<std::mutex> lock(async_mutex_);
+                if (async_running_)
+                {
+                    async_queries_.push_back(std::move(query));
+                    return result;
+                }
+                async_running_ = true;
+            }
+            this->_submit_async(std::move(query));
+            return result;
+        }
+
+        /**
+         * @brief << operator - function for streaming the ImplicitEnvironment to an output stream.
+         * @param os output stream.
+         * @param env environment to stream.
+         * @return std::ostream& output stream.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const ImplicitEnvironment<T, D, G, H> &env)
+        {
+            os << "ImplicitEnvironment[States: " << env.states_.size() << " | Limit: " << env.max_states_ << "]";
+            return os;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_ENVIRONMENT_IMPLICIT_ENVIRONMENT_H
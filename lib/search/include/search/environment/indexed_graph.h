@@ -0,0 +1,90 @@
+#ifndef SEARCH_ENVIRONMENT_INDEXED_GRAPH_H
+#define SEARCH_ENVIRONMENT_INDEXED_GRAPH_H
+
+/**
+ * @file indexed_graph.h
+ * @brief Building blocks shared by the graph environments that keep their nodes in a `CsrAdjacency`.
+ */
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <typeinfo>
+#include <plog/Log.h>
+#include <search/cost/cost.h>
+#include <search/cost/distance_cost.h>
+#include <search/node/node_store.h>
+#include <search/environment/csr_adjacency.h>
+
+namespace search
+{
+
+    /**
+     * @brief Fill the node to node id lookup of an indexed graph - the id of `nodes[i]` is `i`.
+     * @tparam Nodes Random access range of node pointers.
+     * @tparam NodeIds Map from node pointer to node id.
+     * @param nodes nodes of the graph, indexed by node id.
+     * @param node_ids output lookup - cleared first.
+     */
+    template <typename Nodes, typename NodeIds>
+    void index_nodes(const Nodes &nodes, NodeIds &node_ids)
+    {
+        node_ids.clear();
+        node_ids.reserve(nodes.size());
+        for (std::uint32_t id = 0; id < nodes.size(); ++id)
+        {
+            node_ids.emplace(nodes[id], id);
+        }
+    }
+
+    /**
+     * @brief Evaluate the cost function once per edge of `adjacency` and store the results as its edge weights. A plain
+     * `DistanceCost` - matched by exact type, since a derived cost may override `get_cost` - is evaluated by copying the node
+     * values into a temporary `NodeStore` (O(nodes) per call) and running one vectorized sweep over the out edges of each
+     * node, instead of once per edge through the `Node` objects. Any other cost function is evaluated per edge.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam Nodes Random access range of node pointers.
+     * @param adjacency adjacency of the graph - its weights are replaced.
+     * @param nodes nodes of the graph, indexed by node id.
+     * @param cost_function cost function of the graph.
+     */
+    template <typename T, unsigned int D, typename Nodes>
+    void evaluate_edge_costs(CsrAdjacency &adjacency, const Nodes &nodes, const Cost<T, D> &cost_function)
+    {
+        PLOGD << "Precomputing " << adjacency.get_num_edges() << " edge costs.";
+        std::vector<double> weights(adjacency.get_num_edges());
+        if (typeid(cost_function) == typeid(DistanceCost<T, D>))
+        {
+            const utils::DistanceMetric distance_metric = static_cast<const DistanceCost<T, D> &>(cost_function).get_distance_metric();
+            NodeStore<T, D> store(nodes.size());
+            for (std::uint32_t id = 0; id < nodes.size(); ++id)
+            {
+                store.add(nodes[id]->get_node_value());
+            }
+            for (std::uint32_t id = 0; id < nodes.size(); ++id)
+            {
+                const std::size_t begin = adjacency.get_offset(id);
+                store.get_distances(nodes[id]->get_node_value().value,
+                                    distance_metric,
+                                    adjacency.get_neighbors(id),
+                                    std::span<double>(weights.data() + begin, adjacency.get_offset(id + 1) - begin));
+            }
+            adjacency.set_weights(std::move(weights));
+            return;
+        }
+        for (std::uint32_t id = 0; id < nodes.size(); ++id)
+        {
+            const Node<T, D> &from_node = *nodes[id];
+            const std::size_t end = adjacency.get_offset(id + 1);
+            for (std::size_t edge = adjacency.get_offset(id); edge < end; ++edge)
+            {
+                weights[edge] = cost_function.get_cost(from_node, *nodes[adjacency.get_target(edge)]);
+            }
+        }
+        adjacency.set_weights(std::move(weights));
+    }
+
+} // namespace search
+
+#endif // SEARCH_ENVIRONMENT_INDEXED_GRAPH_H
@@ -0,0 +1,458 @@
+#ifndef SEARCH_ENVIRONMENT_MAPPED_GRAPH_H
+#define SEARCH_ENVIRONMENT_MAPPED_GRAPH_H
+
+/**
+ * @file mapped_graph.h
+ * @brief A graph based environment served directly from a memory mapped binary graph file.
+ */
+
+#include <new>
+#include <span>
+#include <limits>
+#include <cstring>
+#include <optional>
+#include <typeinfo>
+#include <algorithm>
+#include <string>
+#include <plog/Log.h>
+#include <search/cost/cost.h>
+#include <search/cost/distance_cost.h>
+#include <search/io/graph_file.h>
+#include <search/io/mapped_file.h>
+#include <search/node/node_pool.h>
+#include <search/environment/environment.h>
+#include <search/environment/csr_adjacency.h>
+#include <search/search/dfs.h>
+#include <search/search/bfs.h>
+#include <search/search/ucs.h>
+#include <search/search/a_star.h>
+#include <search/search/ida_star.h>
+#include <search/search/sma_star.h>
+#include <search/search/ara_star.h>
+#include <search/search/batch_search.h>
+
+namespace search
+{
+
+    /**
+     * @class MappedGraph
+     * @brief This class represents a graph based environment whose node values, CSR adjacency and edge costs are read in place
+     * from a memory mapped graph file written by `write_graph_file` - initialization validates the header and the offsets and
+     * targets in place, nothing is parsed or copied. `Node` objects are only materialized (with the `DENSE` identity) for the nodes handed out by
+     * `get_node`, i.e. the start, goal and path nodes. Edge costs come from the file when it stores them, otherwise from the
+     * cost function: a plain `DistanceCost` is evaluated on the mapped node values, any other cost function materializes
+     * every node it touches (through the locked node pool, which makes searches slower and contend across threads).
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class MappedGraph : public BatchSearchEnvironment<T, D, MappedGraph<T, D>>
+    {
+
+        using SearchAlgorithm = utils::SearchAlgorithm;
+
+        static_assert(sizeof(NodeValue<T, D>) == D * sizeof(T), "Node values must be laid out as D packed values");
+
+    private:
+        // Path of the graph file
+        std::string path_;
+
+        // Mapped graph file
+        MappedFile file_;
+
+        // Graph file header
+        GraphFileHeader header_{};
+
+        // Node values
+        const NodeValue<T, D> *values_ = nullptr;
+
+        // Out edges in CSR form
+        std::span<const std::uint64_t> offsets_;
+        std::span<const std::uint32_t> targets_;
+
+        // In edges in CSR form
+        std::span<const std::uint64_t> reverse_offsets_;
+        std::span<const std::uint32_t> reverse_targets_;
+
+        // Edge costs aligned with `targets_` - empty when the file does not store them
+        std::span<const double> weights_;
+
+        // Node names - empty when the file does not store them
+        std::span<const std::uint64_t> name_offsets_;
+        const char *names_ = nullptr;
+
+        // Cost functions - nullptr when the edge costs come from the file
+        const Cost<T, D> *cost_function_;
+
+        // Distance cost evaluated on the node values - empty unless the cost function is a plain `DistanceCost`
+        std::optional<DistanceCost<T, D>> distance_cost_;
+
+        // Lazily materialized nodes
+        mutable NodePool<T, D> node_pool_;
+
+        // Get a typed view of a section of the file
+        template <typename U>
+        std::span<const U> _get_section(const std::uint64_t offset, const std::uint64_t count) const
+        {
+            if (offset % alignof(U) != 0 || offset > file_.size() || count > (file_.size() - offset) / sizeof(U))
+            {
+                PLOGE << "Graph file " << path_ << " has a section out of bounds at offset " << offset;
+                throw std::invalid_argument("Graph file section out of bounds");
+            }
+            return std::span<const U>(std::launder(reinterpret_cast<const U *>(file_.data() + offset)), count);
+        }
+
+        // Check the header against the environment type
+        void _check_header() const
+        {
+            if (file_.size() < sizeof(GraphFileHeader) || header_.magic != graph_file_magic)
+            {
+                PLOGE << "File " << path_ << " is not a graph file";
+                throw std::invalid_argument("Not a graph file");
+            }
+            if (header_.version != graph_file_version)
+            {
+                PLOGE << "Graph file " << path_ << " has version " << header_.version << ", expected " << graph_file_version;
+                throw std::invalid_argument("Unsupported graph file version");
+            }
+            if (header_.dimension != D || header_.value_size != sizeof(T) ||
+                header_.value_kind != static_cast<std::uint32_t>(get_graph_file_value_kind<T>()))
+            {
+                PLOGE << "Graph file " << path_ << " holds node values of dimension " << header_.dimension << " and size " << header_.value_size;
+                throw std::invalid_argument("Graph file node values do not match the environment type");
+            }
+            if (header_.file_size != file_.size() || header_.num_nodes > std::numeric_limits<std::uint32_t>::max())
+            {
+                PLOGE << "Graph file " << path_ << " is truncated or corrupt";
+                throw std::invalid_argument("Graph file is truncated or corrupt");
+            }
+            if (cost_function_ == nullptr && !(header_.flags & HAS_WEIGHTS))
+            {
+                PLOGE << "Graph file " << path_ << " stores no edge costs and no cost function was given";
+                throw std::invalid_argument("Graph file stores no edge costs and no cost function was given");
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new MappedGraph object using the edge costs stored in the file.
+         * @param path path of the graph file.
+         */
+        explicit MappedGraph(const std::string &path)
+            : path_(path),
+              cost_function_(nullptr)
+        {
+            PLOGD << "Initializing MappedGraph object for file: " << path_;
+        }
+
+        /**
+         * @brief Construct a new MappedGraph object evaluating edge costs with a cost function.
+         * @param path path of the graph file.
+         * @param cost_function cost function for the graph.
+         */
+        MappedGraph(const std::string &path,
+                    const Cost<T, D> &cost_function)
+            : path_(path),
+              cost_function_(&cost_function)
+        {
+            if (typeid(cost_function) == typeid(DistanceCost<T, D>))
+            {
+                distance_cost_.emplace(static_cast<const DistanceCost<T, D> &>(cost_function).get_distance_metric());
+            }
+            PLOGD << "Initializing MappedGraph object with a cost function for file: " << path_;
+        }
+
+        /**
+         * @brief Destructor for the MappedGraph class.
+         */
+        ~MappedGraph()
+        {
+            PLOGD << "Destroying MappedGraph object.";
+        }
+
+        /**
+         * @brief Initialize the graph - maps the file and validates its header, CSR arrays and name offsets in O(nodes + edges).
+         * Invalidates every node handed out before.
+         */
+        void initialize() override
+        {
+            PLOGD << "Initializing MappedGraph based environment.";
+            node_pool_.clear();
+            file_ = MappedFile(path_);
+            header_ = GraphFileHeader{};
+            if (file_.size() >= sizeof(GraphFileHeader))
+            {
+                std::memcpy(&header_, file_.data(), sizeof(GraphFileHeader));
+            }
+            this->_check_header();
+            const std::uint64_t num_nodes = header_.num_nodes;
+            const std::uint64_t num_edges = header_.num_edges;
+            values_ = this->_get_section<NodeValue<T, D>>(header_.values_offset, num_nodes).data();
+            offsets_ = this->_get_section<std::uint64_t>(header_.offsets_offset, num_nodes + 1);
+            targets_ = this->_get_section<std::uint32_t>(header_.targets_offset, num_edges);
+            reverse_offsets_ = this->_get_section<std::uint64_t>(header_.reverse_offsets_offset, num_nodes + 1);
+            reverse_targets_ = this->_get_section<std::uint32_t>(header_.reverse_targets_offset, num_edges);
+            weights_ = (header_.flags & HAS_WEIGHTS) ? this->_get_section<double>(header_.weights_offset, num_edges) : std::span<const double>();
+            name_offsets_ = (header_.flags & HAS_NAMES) ? this->_get_section<std::uint64_t>(header_.name_offsets_offset, num_nodes + 1) : std::span<const std::uint64_t>();
+            // The file is untrusted - check every offset and target once here, so the accessors can index without checks
+            try
+            {
+                CsrAdjacency::validate(offsets_, targets_);
+                CsrAdjacency::validate(reverse_offsets_, reverse_targets_);
+                if (!name_offsets_.empty())
+                {
+                    CsrAdjacency::validate_offsets(name_offsets_, name_offsets_.back());
+                    names_ = this->_get_section<char>(header_.names_offset, name_offsets_.back()).data();
+                }
+            }
+            catch (const std::exception &e)
+            {
+                PLOGE << "Graph file " << path_ << " has inconsistent CSR offsets or targets: " << e.what();
+                throw std::invalid_argument("Graph file is truncated or corrupt");
+            }
+        }
+
+        /**
+         * @brief Check whether the edge costs are read from the file.
+         * @return true if the edge costs are stored in the file, false if they are evaluated by the cost function.
+         */
+        bool has_precomputed_edge_costs() const
+        {
+            return (header_.flags & HAS_WEIGHTS) != 0;
+        }
+
+        /**
+         * @brief Get the number of nodes materialized by `get_node` so far.
+         * @return std::size_t number of materialized nodes.
+         */
+        std::size_t get_num_materialized_nodes() const
+        {
+            return node_pool_.size();
+        }
+
+        /**
+         * @brief Get the number of nodes in the graph.
+         * @return std::size_t number of nodes.
+         */
+        std::size_t get_num_nodes() const
+        {
+            return header_.num_nodes;
+        }
+
+        /**
+         * @brief Get the number of edges in the graph.
+         * @return std::size_t number of edges.
+         */
+        std::size_t get_num_edges() const
+        {
+            return header_.num_edges;
+        }
+
+        /**
+         * @brief Get the node at a given index - materialized on first use.
+         * @param index Index (node id) of the node to retrieve.
+         * @return const Node<T, D>* Pointer to the node at the given index.
+         */
+        const Node<T, D> *get_node(const std::size_t index) const
+        {
+            const std::uint32_t id = static_cast<std::uint32_t>(index);
+            return node_pool_.get(id, [&]()
+                                  {
+                std::string name;
+                if (!name_offsets_.empty())
+                {
+                    name.assign(names_ + name_offsets_[id], names_ + name_offsets_[id + 1]);
+                }
+                return std::make_unique<Node<T, D>>(values_[id], name, utils::NodeIdentity::DENSE); });
+        }
+
+        /**
+         * @brief Get the dense id of a node.
+         * @param node node handed out by `get_node`.
+         * @return std::uint32_t id of the node.
+         */
+        std::uint32_t get_node_id(const Node<T, D> &node) const
+        {
+            const std::optional<std::uint32_t> id = node_pool_.find_id(node);
+            if (!id)
+            {
+                PLOGE << "Node " << node.get_name() << " is not part of the graph";
+                throw std::invalid_argument("Node is not part of the graph");
+            }
+            return *id;
+        }
+
+        /**
+         * @brief Get the value of a node - read in place from the file.
+         * @param id node id.
+         * @return const NodeValue<T, D>& value of the node.
+         */
+        const NodeValue<T, D> &get_node_value(const std::uint32_t id) const
+        {
+            return values_[id];
+        }
+
+        /**
+         * @brief Get the neighbor ids (out edge targets) of a node.
+         * @param id node id.
+         * @return std::span<const std::uint32_t> neighbor ids.
+         */
+        std::span<const std::uint32_t> get_neighbor_ids(const std::uint32_t id) const
+        {
+            return targets_.subspan(offsets_[id], offsets_[id + 1] - offsets_[id]);
+        }
+
+        /**
+         * @brief Get the predecessor ids (in edge sources) of a node.
+         * @param id node id.
+         * @return std::span<const std::uint32_t> predecessor ids.
+         */
+        std::span<const std::uint32_t> get_predecessor_ids(const std::uint32_t id) const
+        {
+            return reverse_targets_.subspan(reverse_offsets_[id], reverse_offsets_[id + 1] - reverse_offsets_[id]);
+        }
+
+        /**
+         * @brief Visit every out edge of a node.
+         * @tparam F Visitor type - callable as `visit(neighbor_id, edge_cost)`.
+         * @param id node id.
+         * @param visit visitor.
+         */
+        template <typename F>
+        void for_each_edge(const std::uint32_t id, F &&visit) const
+        {
+            const std::size_t begin = offsets_[id];
+            const std::size_t end = offsets_[id + 1];
+            if (!weights_.empty())
+            {
+                for (std::size_t edge = begin; edge < end; ++edge)
+                {
+                    visit(targets_[edge], weights_[edge]);
+                }
+                return;
+            }
+            if (distance_cost_)
+            {
+                for (std::size_t edge = begin; edge < end; ++edge)
+                {
+                    visit(targets_[edge], distance_cost_->get_distance(values_[id], values_[targets_[edge]]));
+                }
+                return;
+            }
+            const Node<T, D> &from_node = *this->get_node(id);
+            for (std::size_t edge = begin; edge < end; ++edge)
+            {
+                const std::uint32_t to_id = targets_[edge];
+                visit(to_id, cost_function_->get_cost(from_node, *this->get_node(to_id)));
+            }
+        }
+
+        /**
+         * @brief Get the cost of going from node A to node B (`from_node` to `to_node`) | A -> B. Without a cost function
+         * this is the cost of the cheapest stored edge from A to B.
+         * @param from_node node A.
+         * @param to_node node B.
+         * @return const double cost of going `from_node` to `to_node`.
+         */
+        const double get_cost(const Node<T, D> &from_node,
+                              const Node<T, D> &to_node) const override
+        {
+            PLOGD << "Getting cost from node: " << from_node.get_name() << " to node: " << to_node.get_name();
+            if (cost_function_ != nullptr)
+            {
+                return cost_function_->get_cost(from_node, to_node);
+            }
+            const std::uint32_t to_id = this->get_node_id(to_node);
+            double cost = std::numeric_limits<double>::infinity();
+            this->for_each_edge(this->get_node_id(from_node), [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                {
+                if (neighbor_id == to_id)
+                {
+                    cost = std::min(cost, edge_cost);
+                } });
+            if (cost == std::numeric_limits<double>::infinity())
+            {
+                PLOGE << "No edge from node " << from_node.get_name() << " to node " << to_node.get_name();
+                throw std::invalid_argument("No edge between the nodes");
+            }
+            return cost;
+        }
+
+        /**
+         * @brief Perform space search and return paths from start to goal for a mapped graph based environment.
+         * The informed searches (A*, IDA*, SMA* and ARA*) use the `CostHeuristic` of the cost function - the distance of a
+         * `DistanceCost` and no estimate otherwise. Use `AStar` directly for other heuristics or weighted A*.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc) - default is DFS.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm = SearchAlgorithm::DFS) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, search_algorithm, workspace);
+        }
+
+        /**
+         * @brief Perform space search reusing the scratch memory of `workspace` and return paths from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc).
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            SearchAlgorithm search_algorithm,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            switch (search_algorithm)
+            {
+            case SearchAlgorithm::DFS:
+                PLOGD << "Using DFS search algorithm.";
+                return DFS<T, D, MappedGraph<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::BFS:
+                PLOGD << "Using BFS search algorithm.";
+                return BFS<T, D, MappedGraph<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::UCS:
+                PLOGD << "Using UCS search algorithm.";
+                return UCS<T, D, MappedGraph<T, D>>().search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::A_STAR:
+                PLOGD << "Using A* search algorithm.";
+                return AStar<T, D, MappedGraph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(weights_.empty() ? cost_function_ : nullptr)).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::IDA_STAR:
+                PLOGD << "Using IDA* search algorithm.";
+                return IdaStar<T, D, MappedGraph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(weights_.empty() ? cost_function_ : nullptr)).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::SMA_STAR:
+                PLOGD << "Using SMA* search algorithm.";
+                return SmaStar<T, D, MappedGraph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(weights_.empty() ? cost_function_ : nullptr)).search(start_node, goal_node, *this, workspace);
+            case SearchAlgorithm::ARA_STAR:
+                PLOGD << "Using ARA* search algorithm.";
+                return AraStar<T, D, MappedGraph<T, D>, CostHeuristic<T, D>>(CostHeuristic<T, D>(weights_.empty() ? cost_function_ : nullptr)).search(start_node, goal_node, *this, workspace);
+            default:
+                PLOGE << "Unknown search algorithm.";
+                throw std::invalid_argument("Unknown search algorithm.");
+            }
+        }
+
+        /**
+         * @brief << operator - function for streaming the MappedGraph to an output stream.
+         * @param os output stream.
+         * @param env environment to stream.
+         * @return std::ostream& output stream.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const MappedGraph<T, D> &env)
+        {
+            os << "MappedGraph[File: " << env.path_ << " | Nodes: " << env.header_.num_nodes << " | Edges: " << env.header_.num_edges << "]";
+            return os;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_ENVIRONMENT_MAPPED_GRAPH_H
@@ -0,0 +1,153 @@
+#ifndef SEARCH_HEURISTIC_DISTANCE_HEURISTIC_H
+#define SEARCH_HEURISTIC_DISTANCE_HEURISTIC_H
+
+/**
+ * @file distance_heuristic.h
+ * @brief Distance based heuristics backed by `DistanceCost`.
+ */
+
+#include <optional>
+#include <typeinfo>
+#include <plog/Log.h>
+#include <utils/constants.h>
+#include <search/cost/cost.h>
+#include <search/cost/distance_cost.h>
+#include <search/node/node_store.h>
+#include <search/heuristic/heuristic.h>
+
+namespace search
+{
+
+    /**
+     * @class DistanceHeuristic
+     * @brief This class represents a heuristic that estimates the cost to the goal as the distance between node values,
+     * computed by a `DistanceCost` with metric `M` and multiplied by `scale`. It is admissible when every edge costs at
+     * least `scale` times the distance it spans under `M` - e.g. a `DistanceCost` with the same metric and a scale of 1.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam M Distance metric.
+     */
+    template <typename T, unsigned int D, utils::DistanceMetric M>
+    class DistanceHeuristic
+    {
+
+    private:
+        // Distance cost used to measure node values
+        DistanceCost<T, D> distance_cost_;
+
+        // Scale applied to the distance
+        double scale_;
+
+    public:
+        /**
+         * @brief Construct a new DistanceHeuristic object.
+         * @param scale scale applied to the distance - default is 1.
+         */
+        DistanceHeuristic(const double scale = 1.0)
+            : distance_cost_(M),
+              scale_(scale)
+        {
+            PLOGD << "Initializing DistanceHeuristic with distance metric: " << static_cast<int>(M) << " and scale: " << scale_;
+        }
+
+        /**
+         * @brief Get the estimated cost of going from a node value to the goal node value.
+         * @param from_value value of the node.
+         * @param goal_value value of the goal node.
+         * @return double estimated cost to the goal.
+         */
+        double get_heuristic(const NodeValue<T, D> &from_value,
+                             const NodeValue<T, D> &goal_value) const
+        {
+            return scale_ * distance_cost_.get_distance(from_value, goal_value);
+        }
+
+        /**
+         * @brief Get the estimated cost to the goal of every node value in a store in one vectorized sweep - for callers that
+         * keep their node values in a `NodeStore`. The search algorithms estimate one node at a time through `get_heuristic`.
+         * @param store node values.
+         * @param goal_value value of the goal node.
+         * @param heuristics output - `heuristics[i]` is the estimate for the node value with handle `i` (size must be `store.size()`).
+         */
+        void get_heuristics(const NodeStore<T, D> &store,
+                            const NodeValue<T, D> &goal_value,
+                            std::span<double> heuristics) const
+        {
+            store.get_distances(goal_value.value, M, heuristics);
+            for (double &heuristic : heuristics)
+            {
+                heuristic *= scale_;
+            }
+        }
+    };
+
+    /**
+     * @class CostHeuristic
+     * @brief This class represents the heuristic matched to the cost function of an environment at run time: the distance
+     * under the metric of a plain `DistanceCost`, which a path made of its edges can never beat, and zero for every other
+     * cost function, whose edge costs need not follow any distance. The environments run their informed searches with it,
+     * so those stay optimal (or within their bound) whatever the cost function.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class CostHeuristic
+    {
+    private:
+        // Distance cost of the environment - empty when the edge costs are not distances
+        std::optional<DistanceCost<T, D>> distance_cost_;
+
+    public:
+        /**
+         * @brief Construct a new CostHeuristic object.
+         * @param cost_function cost function of the edges, nullptr when the edge costs come from elsewhere - default is nullptr.
+         */
+        explicit CostHeuristic(const Cost<T, D> *cost_function = nullptr)
+        {
+            if (cost_function != nullptr && typeid(*cost_function) == typeid(DistanceCost<T, D>))
+            {
+                distance_cost_.emplace(static_cast<const DistanceCost<T, D> *>(cost_function)->get_distance_metric());
+            }
+        }
+
+        /**
+         * @brief Check whether the heuristic estimates anything - false when it always returns zero.
+         * @return true if the edge costs are distances, false otherwise.
+         */
+        bool is_informed() const
+        {
+            return distance_cost_.has_value();
+        }
+
+        /**
+         * @brief Get the estimated cost of going from a node value to the goal node value.
+         * @param from_value value of the node.
+         * @param goal_value value of the goal node.
+         * @return double estimated cost to the goal.
+         */
+        double get_heuristic(const NodeValue<T, D> &from_value,
+                             const NodeValue<T, D> &goal_value) const
+        {
+            return distance_cost_ ? distance_cost_->get_distance(from_value, goal_value) : 0.0;
+        }
+    };
+
+    /**
+     * @brief Euclidean (straight line) distance heuristic.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    using EuclideanHeuristic = DistanceHeuristic<T, D, utils::DistanceMetric::EUCLIDEAN>;
+
+    /**
+     * @brief Manhattan (L1) distance heuristic.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    using ManhattanHeuristic = DistanceHeuristic<T, D, utils::DistanceMetric::MANHATTAN>;
+
+} // namespace search
+
+#endif // SEARCH_HEURISTIC_DISTANCE_HEURISTIC_H
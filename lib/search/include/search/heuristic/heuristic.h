@@ -0,0 +1,55 @@
+#ifndef SEARCH_HEURISTIC_HEURISTIC_H
+#define SEARCH_HEURISTIC_HEURISTIC_H
+
+/**
+ * @file heuristic.h
+ * @brief Heuristic policy interface for informed search algorithms along with the trivial zero heuristic.
+ */
+
+#include <concepts>
+#include <search/node/node.h>
+
+namespace search
+{
+
+    /**
+     * @concept Heuristic
+     * @brief A heuristic policy estimates the cost of going from a node value to the goal node value through
+     * `get_heuristic(from_value, goal_value)`. Informed searches return optimal paths when the estimate never exceeds the
+     * true cost (admissible).
+     * @tparam H Heuristic type.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename H, typename T, unsigned int D>
+    concept Heuristic = requires(const H &heuristic, const NodeValue<T, D> &value) {
+        { heuristic.get_heuristic(value, value) } -> std::convertible_to<double>;
+    };
+
+    /**
+     * @class ZeroHeuristic
+     * @brief This class represents the heuristic that always returns zero - informed searches behave like UCS with it.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class ZeroHeuristic
+    {
+
+    public:
+        /**
+         * @brief Get the estimated cost of going from a node value to the goal node value.
+         * @param from_value value of the node.
+         * @param goal_value value of the goal node.
+         * @return double always zero.
+         */
+        double get_heuristic(const NodeValue<T, D> &,
+                             const NodeValue<T, D> &) const
+        {
+            return 0.0;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_HEURISTIC_HEURISTIC_H
@@ -0,0 +1,268 @@
+#ifndef SEARCH_IO_GRAPH_FILE_H
+#define SEARCH_IO_GRAPH_FILE_H
+
+/**
+ * @file graph_file.h
+ * @brief Versioned binary graph file format and its writer.
+ */
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <plog/Log.h>
+#include <search/environment/environment.h>
+
+namespace search
+{
+
+    /**
+     * @brief Binary graph file layout. A file starts with a `GraphFileHeader` followed by sections, each starting at a
+     * multiple of `graph_file_alignment` bytes so they can be used in place once the file is memory mapped:
+     * - values: `num_nodes` node values, column major (`dimension` values of type T per node)
+     * - offsets / targets: out edges in CSR form (`num_nodes + 1` uint64 offsets, `num_edges` uint32 targets)
+     * - reverse offsets / reverse targets: in edges in CSR form
+     * - weights (optional): `num_edges` doubles aligned with the targets
+     * - name offsets / names (optional): `num_nodes + 1` uint64 offsets into a blob of concatenated node names
+     * Integers are stored in the native byte order; files are not portable across endianness.
+     */
+    struct GraphFileHeader
+    {
+        // File magic
+        std::array<char, 8> magic;
+
+        // Format version
+        std::uint32_t version;
+
+        // Section flags (`GraphFileFlags`)
+        std::uint32_t flags;
+
+        // Node value dimension
+        std::uint32_t dimension;
+
+        // Size of the node value type in bytes
+        std::uint32_t value_size;
+
+        // Kind of the node value type (`GraphFileValueKind`)
+        std::uint32_t value_kind;
+
+        // Padding
+        std::uint32_t reserved;
+
+        // Number of nodes
+        std::uint64_t num_nodes;
+
+        // Number of edges
+        std::uint64_t num_edges;
+
+        // Byte offsets of the sections from the start of the file (0 when absent)
+        std::uint64_t values_offset;
+        std::uint64_t offsets_offset;
+        std::uint64_t targets_offset;
+        std::uint64_t reverse_offsets_offset;
+        std::uint64_t reverse_targets_offset;
+        std::uint64_t weights_offset;
+        std::uint64_t name_offsets_offset;
+        std::uint64_t names_offset;
+
+        // Total size of the file in bytes
+        std::uint64_t file_size;
+    };
+
+    // Magic at the start of every graph file
+    inline constexpr std::array<char, 8> graph_file_magic = {'S', 'R', 'C', 'H', 'G', 'R', 'P', 'H'};
+
+    // Current graph file version
+    inline constexpr std::uint32_t graph_file_version = 1;
+
+    // Alignment of every section
+    inline constexpr std::uint64_t graph_file_alignment = 64;
+
+    // Optional sections
+    enum GraphFileFlags : std::uint32_t
+    {
+        HAS_WEIGHTS = 1U << 0,
+        HAS_NAMES = 1U << 1
+    };
+
+    // Kinds of node value types
+    enum class GraphFileValueKind : std::uint32_t
+    {
+        SIGNED_INTEGER,
+        UNSIGNED_INTEGER,
+        FLOATING_POINT
+    };
+
+    /**
+     * @brief Get the kind of a node value type.
+     * @tparam T Type.
+     * @return GraphFileValueKind kind of `T`.
+     */
+    template <typename T>
+    constexpr GraphFileValueKind get_graph_file_value_kind()
+    {
+        static_assert(std::is_arithmetic_v<T>, "Graph files only hold arithmetic node values");
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            return GraphFileValueKind::FLOATING_POINT;
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            return GraphFileValueKind::SIGNED_INTEGER;
+        }
+        else
+        {
+            return GraphFileValueKind::UNSIGNED_INTEGER;
+        }
+    }
+
+    namespace detail
+    {
+        // Round `offset` up to the section alignment
+        constexpr std::uint64_t align_graph_file_offset(const std::uint64_t offset)
+        {
+            return (offset + graph_file_alignment - 1) / graph_file_alignment * graph_file_alignment;
+        }
+
+        // Write `bytes` bytes at `offset`, zero padding from the current end of the file
+        inline void write_graph_file_section(std::ofstream &file, const std::uint64_t offset, const void *data, const std::size_t bytes)
+        {
+            static constexpr std::array<char, graph_file_alignment> padding = {};
+            const std::uint64_t position = static_cast<std::uint64_t>(file.tellp());
+            file.write(padding.data(), static_cast<std::streamsize>(offset - position));
+            file.write(static_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+        }
+    }
+
+    /**
+     * @brief Write an environment to a binary graph file (see `GraphFileHeader`) that `MappedGraph` can map.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     * @param path path of the file - overwritten if it exists.
+     * @param env initialized environment to write.
+     * @param write_edge_costs store the cost of every edge - default is true.
+     * @param write_names store the name of every node - default is true.
+     */
+    template <typename T, unsigned int D, typename E>
+        requires(AdjacencyEnvironment<E, T, D>)
+    void write_graph_file(const std::string &path,
+                          const E &env,
+                          const bool write_edge_costs = true,
+                          const bool write_names = true)
+    {
+        PLOGD << "Writing graph file: " << path;
+        const std::size_t num_nodes = env.get_num_nodes();
+        // Gather the out edges (and their costs) in the order the environment visits them
+        std::vector<std::uint64_t> offsets(num_nodes + 1, 0);
+        std::vector<std::uint32_t> targets;
+        std::vector<double> weights;
+        targets.reserve(env.get_num_edges());
+        weights.reserve(write_edge_costs ? env.get_num_edges() : 0);
+        for (std::uint32_t id = 0; id < num_nodes; ++id)
+        {
+            env.for_each_edge(id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                              {
+                targets.push_back(neighbor_id);
+                if (write_edge_costs)
+                {
+                    weights.push_back(edge_cost);
+                } });
+            offsets[id + 1] = targets.size();
+        }
+        // Gather the in edges
+        std::vector<std::uint64_t> reverse_offsets(num_nodes + 1, 0);
+        std::vector<std::uint32_t> reverse_targets;
+        reverse_targets.reserve(targets.size());
+        for (std::uint32_t id = 0; id < num_nodes; ++id)
+        {
+            for (const std::uint32_t predecessor_id : env.get_predecessor_ids(id))
+            {
+                reverse_targets.push_back(predecessor_id);
+            }
+            reverse_offsets[id + 1] = reverse_targets.size();
+        }
+        if (reverse_targets.size() != targets.size())
+        {
+            PLOGE << "Environment has " << targets.size() << " out edges but " << reverse_targets.size() << " in edges";
+            throw std::invalid_argument("Environment in edges do not match its out edges");
+        }
+        // Gather the node values and names
+        std::vector<T> values(num_nodes * D);
+        std::vector<std::uint64_t> name_offsets(write_names ? num_nodes + 1 : 0, 0);
+        std::string names;
+        for (std::uint32_t id = 0; id < num_nodes; ++id)
+        {
+            const NodeValue<T, D> &node_value = env.get_node_value(id);
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                values[id * D + d] = node_value.value(d);
+            }
+            if (write_names)
+            {
+                names += env.get_node(id)->get_name();
+                name_offsets[id + 1] = names.size();
+            }
+        }
+        // Lay the sections out
+        GraphFileHeader header{};
+        header.magic = graph_file_magic;
+        header.version = graph_file_version;
+        header.flags = (write_edge_costs ? HAS_WEIGHTS : 0U) | (write_names ? HAS_NAMES : 0U);
+        header.dimension = D;
+        header.value_size = sizeof(T);
+        header.value_kind = static_cast<std::uint32_t>(get_graph_file_value_kind<T>());
+        header.num_nodes = num_nodes;
+        header.num_edges = targets.size();
+        std::uint64_t offset = sizeof(GraphFileHeader);
+        const auto place = [&offset](const std::size_t bytes)
+        {
+            const std::uint64_t section_offset = detail::align_graph_file_offset(offset);
+            offset = section_offset + bytes;
+            return section_offset;
+        };
+        header.values_offset = place(values.size() * sizeof(T));
+        header.offsets_offset = place(offsets.size() * sizeof(std::uint64_t));
+        header.targets_offset = place(targets.size() * sizeof(std::uint32_t));
+        header.reverse_offsets_offset = place(reverse_offsets.size() * sizeof(std::uint64_t));
+        header.reverse_targets_offset = place(reverse_targets.size() * sizeof(std::uint32_t));
+        header.weights_offset = write_edge_costs ? place(weights.size() * sizeof(double)) : 0;
+        header.name_offsets_offset = write_names ? place(name_offsets.size() * sizeof(std::uint64_t)) : 0;
+        header.names_offset = write_names ? place(names.size()) : 0;
+        header.file_size = offset;
+        // Write everything out
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            PLOGE << "Could not open file for writing: " << path;
+            throw std::runtime_error("Could not open file for writing: " + path);
+        }
+        detail::write_graph_file_section(file, 0, &header, sizeof(GraphFileHeader));
+        detail::write_graph_file_section(file, header.values_offset, values.data(), values.size() * sizeof(T));
+        detail::write_graph_file_section(file, header.offsets_offset, offsets.data(), offsets.size() * sizeof(std::uint64_t));
+        detail::write_graph_file_section(file, header.targets_offset, targets.data(), targets.size() * sizeof(std::uint32_t));
+        detail::write_graph_file_section(file, header.reverse_offsets_offset, reverse_offsets.data(), reverse_offsets.size() * sizeof(std::uint64_t));
+        detail::write_graph_file_section(file, header.reverse_targets_offset, reverse_targets.data(), reverse_targets.size() * sizeof(std::uint32_t));
+        if (write_edge_costs)
+        {
+            detail::write_graph_file_section(file, header.weights_offset, weights.data(), weights.size() * sizeof(double));
+        }
+        if (write_names)
+        {
+            detail::write_graph_file_section(file, header.name_offsets_offset, name_offsets.data(), name_offsets.size() * sizeof(std::uint64_t));
+            detail::write_graph_file_section(file, header.names_offset, names.data(), names.size());
+        }
+        if (!file.flush())
+        {
+            PLOGE << "Could not write file: " << path;
+            throw std::runtime_error("Could not write file: " + path);
+        }
+    }
+
+} // namespace search
+
+#endif // SEARCH_IO_GRAPH_FILE_H
@@ -0,0 +1,148 @@
+#ifndef SEARCH_IO_MAPPED_FILE_H
+#define SEARCH_IO_MAPPED_FILE_H
+
+/**
+ * @file mapped_file.h
+ * @brief Read only memory mapped file.
+ */
+
+#include <string>
+#include <utility>
+#include <cstddef>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <plog/Log.h>
+
+namespace search
+{
+
+    /**
+     * @class MappedFile
+     * @brief This class maps a whole file read only into memory and unmaps it on destruction. Pages are loaded by the
+     * operating system on first access and shared between processes mapping the same file. Move only.
+     */
+    class MappedFile
+    {
+
+    private:
+        // Start of the mapping - nullptr when nothing is mapped
+        const std::byte *data_ = nullptr;
+
+        // Size of the mapping in bytes
+        std::size_t size_ = 0;
+
+        // Release the mapping
+        void _unmap()
+        {
+            if (data_ != nullptr)
+            {
+                ::munmap(const_cast<std::byte *>(data_), size_);
+                data_ = nullptr;
+                size_ = 0;
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct an empty MappedFile object.
+         */
+        MappedFile() = default;
+
+        /**
+         * @brief Construct a new MappedFile object mapping the file at `path`.
+         * @param path path of the file.
+         */
+        explicit MappedFile(const std::string &path)
+        {
+            PLOGD << "Mapping file: " << path;
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                PLOGE << "Could not open file: " << path;
+                throw std::runtime_error("Could not open file: " + path);
+            }
+            struct stat file_stat;
+            if (::fstat(fd, &file_stat) != 0)
+            {
+                ::close(fd);
+                PLOGE << "Could not stat file: " << path;
+                throw std::runtime_error("Could not stat file: " + path);
+            }
+            size_ = static_cast<std::size_t>(file_stat.st_size);
+            if (size_ > 0)
+            {
+                void *data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+                if (data == MAP_FAILED)
+                {
+                    ::close(fd);
+                    size_ = 0;
+                    PLOGE << "Could not map file: " << path;
+                    throw std::runtime_error("Could not map file: " + path);
+                }
+                data_ = static_cast<const std::byte *>(data);
+            }
+            ::close(fd); // The mapping keeps its own reference to the file
+        }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        /**
+         * @brief Move construct a MappedFile object.
+         * @param other mapping to take over.
+         */
+        MappedFile(MappedFile &&other) noexcept
+            : data_(std::exchange(other.data_, nullptr)),
+              size_(std::exchange(other.size_, 0))
+        {
+        }
+
+        /**
+         * @brief Move assign a MappedFile object.
+         * @param other mapping to take over.
+         * @return MappedFile& this mapping.
+         */
+        MappedFile &operator=(MappedFile &&other) noexcept
+        {
+            if (this != &other)
+            {
+                _unmap();
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destroy the MappedFile object - unmaps the file.
+         */
+        ~MappedFile()
+        {
+            _unmap();
+        }
+
+        /**
+         * @brief Get the start of the mapping.
+         * @return const std::byte* start of the mapping (page aligned).
+         */
+        const std::byte *data() const
+        {
+            return data_;
+        }
+
+        /**
+         * @brief Get the size of the mapping.
+         * @return std::size_t size in bytes.
+         */
+        std::size_t size() const
+        {
+            return size_;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_IO_MAPPED_FILE_H
@@ -0,0 +1,269 @@
+#ifndef SEARCH_IO_TEXT_GRAPH_READER_H
+#define SEARCH_IO_TEXT_GRAPH_READER_H
+
+/**
+ * @file text_graph_reader.h
+ * @brief Parallel readers for text / CSV edge lists and node value files.
+ */
+
+#include <atomic>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <plog/Log.h>
+#include <search/io/mapped_file.h>
+#include <search/node/node.h>
+#include <search/parallel/parallel_for.h>
+#include <search/environment/csr_adjacency.h>
+
+namespace search
+{
+
+    namespace detail
+    {
+        // A chunk of a text file - `[begin, end)` byte range covering whole lines
+        using TextChunk = std::pair<std::size_t, std::size_t>;
+
+        // Split a text into at most `num_chunks` chunks that start and end on line boundaries
+        inline std::vector<TextChunk> split_text(const char *data, const std::size_t size, const std::size_t num_chunks)
+        {
+            std::vector<TextChunk> chunks;
+            std::size_t begin = 0;
+            for (std::size_t chunk = 1; chunk <= num_chunks && begin < size; ++chunk)
+            {
+                std::size_t end = size * chunk / num_chunks;
+                if (end <= begin)
+                {
+                    continue;
+                }
+                // Extend the chunk to the end of its last line
+                const void *newline = std::memchr(data + end - 1, '\n', size - end + 1);
+                end = newline == nullptr ? size : static_cast<std::size_t>(static_cast<const char *>(newline) - data) + 1;
+                chunks.emplace_back(begin, end);
+                begin = end;
+            }
+            return chunks;
+        }
+
+        // Visit every data line of a chunk as `fn(line_begin, line_end, first_line)` - blank and comment (# or %) lines are skipped
+        template <typename F>
+        void for_each_text_line(const char *data, const TextChunk &chunk, F &&fn)
+        {
+            std::size_t position = chunk.first;
+            while (position < chunk.second)
+            {
+                const char *line_begin = data + position;
+                const char *line_end = std::find(line_begin, data + chunk.second, '\n');
+                position = static_cast<std::size_t>(line_end - data) + 1;
+                const bool first_line = line_begin == data;
+                while (line_begin < line_end && (*line_begin == ' ' || *line_begin == '\t'))
+                {
+                    ++line_begin;
+                }
+                if (line_end > line_begin && line_end[-1] == '\r')
+                {
+                    --line_end;
+                }
+                if (line_begin == line_end || *line_begin == '#' || *line_begin == '%')
+                {
+                    continue;
+                }
+                fn(line_begin, line_end, first_line);
+            }
+        }
+
+        // Parse the next separator (comma, semicolon, space or tab) delimited field of a line
+        template <typename U>
+        bool parse_text_field(const char *&cursor, const char *end, U &value)
+        {
+            while (cursor < end && (*cursor == ',' || *cursor == ';' || *cursor == ' ' || *cursor == '\t'))
+            {
+                ++cursor;
+            }
+            const std::from_chars_result result = std::from_chars(cursor, end, value);
+            if (result.ec != std::errc() || (result.ptr < end && *result.ptr != ',' && *result.ptr != ';' && *result.ptr != ' ' && *result.ptr != '\t'))
+            {
+                return false;
+            }
+            cursor = result.ptr;
+            return true;
+        }
+
+        // Parse the first two fields of an edge line - false for a header (first line of the file), throws for other bad lines
+        inline bool parse_edge_line(const char *line_begin, const char *line_end, const bool first_line, std::uint64_t &from, std::uint64_t &to)
+        {
+            const char *cursor = line_begin;
+            if (parse_text_field(cursor, line_end, from) && parse_text_field(cursor, line_end, to))
+            {
+                return true;
+            }
+            if (first_line)
+            {
+                return false;
+            }
+            PLOGE << "Malformed edge line: " << std::string(line_begin, line_end);
+            throw std::invalid_argument("Malformed edge line: " + std::string(line_begin, line_end));
+        }
+    }
+
+    /**
+     * @brief Read a text / CSV edge list into a CSR adjacency in parallel. Every data line holds `from` and `to` node ids as
+     * its first two fields (separated by commas, semicolons, spaces or tabs) - further fields are ignored, blank lines and
+     * lines starting with `#` or `%` are skipped, and a non numeric first line is taken as a header. The file is memory
+     * mapped and parsed twice by `num_threads` threads: once to count the out degrees, once to place the targets, so apart
+     * from the page cache the only memory used is the final CSR arrays. Parallel placement does not preserve the input order,
+     * so the out edges of every node are sorted by target id to keep the result deterministic.
+     * @param path path of the edge list.
+     * @param num_nodes number of nodes - default is 0, which takes the largest node id + 1 (an extra pass).
+     * @param num_threads number of threads - default is the hardware concurrency.
+     * @return CsrAdjacency out edges in CSR form.
+     */
+    inline CsrAdjacency read_edge_list(const std::string &path,
+                                       std::size_t num_nodes = 0,
+                                       const std::size_t num_threads = std::thread::hardware_concurrency())
+    {
+        PLOGD << "Reading edge list: " << path;
+        const MappedFile file(path);
+        const char *data = reinterpret_cast<const char *>(file.data());
+        const std::vector<detail::TextChunk> chunks = detail::split_text(data, file.size(), std::max<std::size_t>(num_threads, 1));
+        const auto for_each_chunk = [&](auto &&fn)
+        {
+            parallel_for(chunks.size(), chunks.size(), [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                         {
+                for (std::size_t chunk = begin; chunk < end; ++chunk)
+                {
+                    detail::for_each_text_line(data, chunks[chunk], [&](const char *line_begin, const char *line_end, const bool first_line)
+                                               {
+                        std::uint64_t from = 0;
+                        std::uint64_t to = 0;
+                        if (detail::parse_edge_line(line_begin, line_end, first_line, from, to))
+                        {
+                            fn(chunk, from, to);
+                        } });
+                } }, 1);
+        };
+        // Pass 0 (optional) - find the number of nodes as the largest node id + 1 of every chunk
+        if (num_nodes == 0)
+        {
+            std::vector<std::uint64_t> chunk_num_nodes(chunks.size(), 0);
+            for_each_chunk([&](const std::size_t chunk, const std::uint64_t from, const std::uint64_t to)
+                           { chunk_num_nodes[chunk] = std::max(chunk_num_nodes[chunk], std::max(from, to) + 1); });
+            num_nodes = chunk_num_nodes.empty() ? 0 : static_cast<std::size_t>(*std::max_element(chunk_num_nodes.begin(), chunk_num_nodes.end()));
+        }
+        if (num_nodes > std::numeric_limits<std::uint32_t>::max())
+        {
+            PLOGE << "Number of nodes " << num_nodes << " exceeds the 32-bit node id range";
+            throw std::invalid_argument("Number of nodes exceeds the 32-bit node id range");
+        }
+        // Pass 1 - count the out degrees
+        std::vector<std::size_t> offsets(num_nodes + 1, 0);
+        for_each_chunk([&](const std::size_t, const std::uint64_t from, const std::uint64_t to)
+                       {
+            if (from >= num_nodes || to >= num_nodes)
+            {
+                PLOGE << "Edge (" << from << ", " << to << ") is out of range for " << num_nodes << " nodes";
+                throw std::out_of_range("Edge index out of range");
+            }
+            std::atomic_ref<std::size_t>(offsets[from + 1]).fetch_add(1, std::memory_order_relaxed); });
+        for (std::size_t idx = 0; idx < num_nodes; ++idx)
+        {
+            offsets[idx + 1] += offsets[idx];
+        }
+        // Pass 2 - place the targets, using the offsets as cursors (they end up shifted by one node)
+        std::vector<std::uint32_t> targets(offsets.back());
+        for_each_chunk([&](const std::size_t, const std::uint64_t from, const std::uint64_t to)
+                       { targets[std::atomic_ref<std::size_t>(offsets[from]).fetch_add(1, std::memory_order_relaxed)] = static_cast<std::uint32_t>(to); });
+        for (std::size_t idx = num_nodes; idx > 0; --idx)
+        {
+            offsets[idx] = offsets[idx - 1];
+        }
+        offsets[0] = 0;
+        // Sort the out edges of every node
+        parallel_for(num_nodes, num_threads, [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                     {
+            for (std::size_t idx = begin; idx < end; ++idx)
+            {
+                std::sort(targets.begin() + offsets[idx], targets.begin() + offsets[idx + 1]);
+            } });
+        PLOGD << "Read " << targets.size() << " edges between " << num_nodes << " nodes from: " << path;
+        return CsrAdjacency(std::move(offsets), std::move(targets));
+    }
+
+    /**
+     * @brief Read a text / CSV file of node values in parallel - data line `i` holds the `D` coordinates of node `i` as its
+     * first fields, with the same line rules as `read_edge_list`.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @param path path of the node value file.
+     * @param num_threads number of threads - default is the hardware concurrency.
+     * @return std::vector<NodeValue<T, D>> node values in file order.
+     */
+    template <typename T, unsigned int D>
+    std::vector<NodeValue<T, D>> read_node_values(const std::string &path,
+                                                  const std::size_t num_threads = std::thread::hardware_concurrency())
+    {
+        PLOGD << "Reading node values: " << path;
+        const MappedFile file(path);
+        const char *data = reinterpret_cast<const char *>(file.data());
+        const std::vector<detail::TextChunk> chunks = detail::split_text(data, file.size(), std::max<std::size_t>(num_threads, 1));
+        // Parse a line into `node_value` - false for a header (first line of the file), throws for other bad lines
+        const auto parse_line = [](const char *line_begin, const char *line_end, const bool first_line, NodeValue<T, D> &node_value)
+        {
+            const char *cursor = line_begin;
+            for (unsigned int d = 0; d < D; ++d)
+            {
+                if (!detail::parse_text_field(cursor, line_end, node_value.value(d)))
+                {
+                    if (first_line && d == 0)
+                    {
+                        return false;
+                    }
+                    PLOGE << "Malformed node value line: " << std::string(line_begin, line_end);
+                    throw std::invalid_argument("Malformed node value line: " + std::string(line_begin, line_end));
+                }
+            }
+            return true;
+        };
+        // Pass 1 - count the data lines of every chunk
+        std::vector<std::size_t> chunk_offsets(chunks.size() + 1, 0);
+        parallel_for(chunks.size(), chunks.size(), [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                     {
+            NodeValue<T, D> node_value;
+            for (std::size_t chunk = begin; chunk < end; ++chunk)
+            {
+                detail::for_each_text_line(data, chunks[chunk], [&](const char *line_begin, const char *line_end, const bool first_line)
+                                           { chunk_offsets[chunk + 1] += (!first_line || parse_line(line_begin, line_end, first_line, node_value)); });
+            } }, 1);
+        for (std::size_t chunk = 0; chunk < chunks.size(); ++chunk)
+        {
+            chunk_offsets[chunk + 1] += chunk_offsets[chunk];
+        }
+        // Pass 2 - parse every chunk into its slice of the result
+        std::vector<NodeValue<T, D>> node_values(chunk_offsets.back());
+        parallel_for(chunks.size(), chunks.size(), [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                     {
+            for (std::size_t chunk = begin; chunk < end; ++chunk)
+            {
+                std::size_t idx = chunk_offsets[chunk];
+                NodeValue<T, D> node_value;
+                detail::for_each_text_line(data, chunks[chunk], [&](const char *line_begin, const char *line_end, const bool first_line)
+                                           {
+                    if (parse_line(line_begin, line_end, first_line, node_value))
+                    {
+                        node_values[idx++] = node_value;
+                    } });
+            } }, 1);
+        PLOGD << "Read " << node_values.size() << " node values from: " << path;
+        return node_values;
+    }
+
+} // namespace search
+
+#endif // SEARCH_IO_TEXT_GRAPH_READER_H
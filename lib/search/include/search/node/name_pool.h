@@ -0,0 +1,63 @@
+#ifndef SEARCH_NODE_NAME_POOL_H
+#define SEARCH_NODE_NAME_POOL_H
+
+/**
+ * @file name_pool.h
+ * @brief A thread safe pool of interned strings used for node names.
+ */
+
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <plog/Log.h>
+
+namespace search
+{
+
+    /**
+     * @class NamePool
+     * @brief This class interns strings - every distinct string is stored once and handed out by reference. References stay
+     * valid for the lifetime of the pool; strings are never removed.
+     */
+    class NamePool
+    {
+
+    private:
+        // Guards `names_`
+        mutable std::mutex mutex_;
+
+        // Interned strings - node based, so references survive rehashing
+        std::unordered_set<std::string> names_;
+
+    public:
+        /**
+         * @brief Construct a new NamePool object.
+         */
+        NamePool() = default;
+
+        /**
+         * @brief Get the interned copy of a string, adding it to the pool if needed.
+         * @param name string to intern.
+         * @return const std::string& interned string.
+         */
+        const std::string &intern(const std::string_view name)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return *names_.emplace(name).first;
+        }
+
+        /**
+         * @brief Get the number of interned strings.
+         * @return std::size_t number of strings.
+         */
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return names_.size();
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_NODE_NAME_POOL_H
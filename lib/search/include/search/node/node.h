@@ -6,11 +6,19 @@
  * @brief Contains the base node class entity in the state space search.
  */
 
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <memory_resource>
 #include <plog/Log.h>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 #include <math/types.h>
+#include <utils/constants.h>
+#include <search/node/name_pool.h>
 
 namespace search
 {
@@ -46,6 +54,11 @@ namespace search
     /**
      * @class Node
      * @brief This class represents a node in a graph / search space (a basic node). Inherit from this class to create a custom node.
+     * Every node gets a process wide unique integer id, which is what equality compares. Nodes can be constructed from many
+     * threads at once: ids come from per thread blocks and UUIDs from per thread generators. With the `UUID` identity (default)
+     * a random UUID is also generated and used as the name when none is given; with the `DENSE` identity no UUID is made and
+     * a missing name is only created - and interned in a shared pool - the first time `get_name` is called. The neighbor list
+     * is allocated from a `std::pmr::memory_resource` (the default resource unless given, see `NodeArena`).
      * @tparam T Type.
      * @tparam D Dimension.
      */
@@ -53,42 +66,79 @@ namespace search
     class Node
     {
 
+        using NodeIdentity = utils::NodeIdentity;
+
     private:
-        // Node uuid
+        // Node id - unique within the process
+        std::uint64_t id_;
+
+        // Node uuid - nil with the `DENSE` identity
         boost::uuids::uuid uuid_;
 
-        // Node name
+        // Node identity policy
+        NodeIdentity identity_;
+
+        // Node name - empty until set with the `DENSE` identity
         std::string name_;
 
+        // Interned default name - only used with the `DENSE` identity
+        mutable const std::string *interned_name_ = nullptr;
+
         // Node value
         NodeValue<T, D> node_value_;
 
         // Node neighbors
-        std::vector<const Node<T, D> *> neighbors_;
+        std::pmr::vector<const Node<T, D> *> neighbors_;
+
+        // UUID generator - one per thread, the generator is not thread safe
+        inline static thread_local boost::uuids::random_generator uuid_generator_;
+
+        // Next unallocated block of node ids
+        inline static std::atomic<std::uint64_t> next_id_block_ = 0;
 
-        // UUID generator
-        inline static boost::uuids::random_generator uuid_generator_;
+        // Number of node ids a thread takes from `next_id_block_` at once
+        static constexpr std::uint64_t id_block_size_ = 1024;
+
+        // Allocate a node id from the current thread's block, taking a new block when it runs out
+        static std::uint64_t _allocate_id()
+        {
+            thread_local std::uint64_t next_id = 0;
+            thread_local std::uint64_t end_id = 0;
+            if (next_id == end_id)
+            {
+                next_id = next_id_block_.fetch_add(id_block_size_, std::memory_order_relaxed);
+                end_id = next_id + id_block_size_;
+            }
+            return next_id++;
+        }
+
+        // Pool of interned default names
+        inline static NamePool name_pool_;
 
     public:
         /**
          * @brief Construct a new Node object.
          * @param value value of the node.
          * @param name name of the node - default is an empty string.
+         * @param identity identity policy of the node - default is `UUID`.
+         * @param resource memory resource of the neighbor list - default is the default memory resource.
          */
         Node(const NodeValue<T, D> &node_value,
-             const std::string &name = "")
-            : uuid_(uuid_generator_()),
-              node_value_(node_value)
+             const std::string &name = "",
+             const NodeIdentity identity = NodeIdentity::UUID,
+             std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+            : id_(_allocate_id()),
+              uuid_(identity == NodeIdentity::UUID ? uuid_generator_() : boost::uuids::uuid{}),
+              identity_(identity),
+              name_(name),
+              node_value_(node_value),
+              neighbors_(resource)
         {
-            if (name.empty())
+            if (name_.empty() && identity_ == NodeIdentity::UUID)
             {
                 name_ = boost::uuids::to_string(uuid_);
             }
-            else
-            {
-                name_ = name;
-            }
-            PLOGD << "Initializing Node object with name: " << name_;
+            PLOGD << "Initializing Node object with id: " << id_ << " and name: " << name_;
         }
 
         /**
@@ -96,7 +146,25 @@ namespace search
          */
         ~Node()
         {
-            PLOGD << "Destroying Node object: " << name_;
+            PLOGD << "Destroying Node object: " << id_;
+        }
+
+        /**
+         * @brief Get the id of the node.
+         * @return std::uint64_t id of the node.
+         */
+        std::uint64_t get_id() const
+        {
+            return id_;
+        }
+
+        /**
+         * @brief Get the identity policy of the node.
+         * @return NodeIdentity identity policy.
+         */
+        NodeIdentity get_identity() const
+        {
+            return identity_;
         }
 
         /**
@@ -105,14 +173,25 @@ namespace search
          */
         const std::string &get_name() const
         {
-            return name_;
+            if (!name_.empty() || identity_ == NodeIdentity::UUID)
+            {
+                return name_;
+            }
+            std::atomic_ref<const std::string *> interned_name(interned_name_);
+            const std::string *name = interned_name.load(std::memory_order_acquire);
+            if (name == nullptr)
+            {
+                name = &name_pool_.intern(std::to_string(id_));
+                interned_name.store(name, std::memory_order_release);
+            }
+            return *name;
         }
 
         /**
          * @brief Get neighbors of the node.
-         * @return const std::vector<Node<T, D>*>& neighbors of the node.
+         * @return const std::pmr::vector<const Node<T, D> *>& neighbors of the node.
          */
-        const std::vector<const Node<T, D> *> &get_neighbors() const
+        const std::pmr::vector<const Node<T, D> *> &get_neighbors() const
         {
             return neighbors_;
         }
@@ -126,6 +205,15 @@ namespace search
             return node_value_;
         }
 
+        /**
+         * @brief Reserve room for `count` more neighbors, so adding them allocates the neighbor list once.
+         * @param count number of neighbors about to be added.
+         */
+        void reserve_neighbors(const std::size_t count)
+        {
+            neighbors_.reserve(neighbors_.size() + count);
+        }
+
         /**
          * @brief Add a neighbor to the node.
          * @param neighbor neighbor to add - a reference to a Node object.
@@ -147,8 +235,24 @@ namespace search
             }
             else
             {
-                PLOGW << "Attempted to add a null neighbor to node: " << name_ << " - skipping";
+                PLOGW << "Attempted to add a null neighbor to node: " << get_name() << " - skipping";
+            }
+        }
+
+        /**
+         * @brief Remove the first occurrence of a neighbor from the node.
+         * @param neighbor neighbor to remove.
+         * @return true if the neighbor was removed, false if it is not a neighbor of the node.
+         */
+        bool remove_neighbor(const Node<T, D> *neighbor)
+        {
+            const auto it = std::find(neighbors_.begin(), neighbors_.end(), neighbor);
+            if (it == neighbors_.end())
+            {
+                return false;
             }
+            neighbors_.erase(it);
+            return true;
         }
 
         /**
@@ -168,12 +272,12 @@ namespace search
          */
         friend std::ostream &operator<<(std::ostream &os, const Node<T, D> &node)
         {
-            os << "Node[" << node.name_ << "]: ";
+            os << "Node[" << node.get_name() << "]: ";
             os << node.node_value_ << std::endl;
             os << "Neighbors[";
             for (const Node<T, D> *neighbor : node.neighbors_)
             {
-                os << neighbor->name_ << ", ";
+                os << neighbor->get_name() << ", ";
             }
             os << "]" << std::endl;
             return os;
@@ -187,7 +291,7 @@ namespace search
          */
         friend const bool operator==(const Node<T, D> &lhs, const Node<T, D> &rhs)
         {
-            return lhs.uuid_ == rhs.uuid_;
+            return lhs.id_ == rhs.id_;
         }
 
         /**
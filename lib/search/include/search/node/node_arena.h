@@ -0,0 +1,167 @@
+#ifndef SEARCH_NODE_NODE_ARENA_H
+#define SEARCH_NODE_NODE_ARENA_H
+
+/**
+ * @file node_arena.h
+ * @brief Arena that allocates nodes and their neighbor lists from one monotonic buffer.
+ */
+
+#include <string>
+#include <vector>
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <memory_resource>
+#include <plog/Log.h>
+#include <search/node/node.h>
+
+namespace search
+{
+
+    /**
+     * @class NodeArena
+     * @brief This class allocates nodes - and, through `connect`, their neighbor lists - back to back from a monotonic
+     * buffer, so a graph takes a handful of large allocations instead of one per node and one per neighbor list, and is
+     * released at once when the arena is destroyed. Nodes keep their address for the lifetime of the arena. Use the `DENSE`
+     * identity to also keep the node names off the heap. Not thread safe, not copyable and not movable.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class NodeArena
+    {
+
+        using NodeIdentity = utils::NodeIdentity;
+
+    private:
+        // Buffer the nodes and neighbor lists are carved from
+        std::pmr::monotonic_buffer_resource resource_;
+
+        // Nodes in creation order
+        std::pmr::vector<Node<T, D> *> nodes_;
+
+    public:
+        /**
+         * @brief Construct a new NodeArena object.
+         * @param initial_size size in bytes of the first buffer taken from `upstream` - default is 64 KiB.
+         * @param upstream memory resource the buffers are taken from - default is the default memory resource.
+         */
+        explicit NodeArena(const std::size_t initial_size = 64 * 1024,
+                           std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+            : resource_(initial_size, upstream),
+              nodes_(&resource_)
+        {
+            PLOGD << "Initializing NodeArena object with an initial buffer of " << initial_size << " bytes.";
+        }
+
+        NodeArena(const NodeArena &) = delete;
+        NodeArena &operator=(const NodeArena &) = delete;
+
+        /**
+         * @brief Destroy the NodeArena object and every node it holds.
+         */
+        ~NodeArena()
+        {
+            PLOGD << "Destroying NodeArena object with " << nodes_.size() << " nodes.";
+            for (auto it = nodes_.rbegin(); it != nodes_.rend(); ++it)
+            {
+                (*it)->~Node();
+            }
+        }
+
+        /**
+         * @brief Reserve room for `count` more nodes, so their pointers are stored in one allocation.
+         * @param count number of nodes about to be created.
+         */
+        void reserve(const std::size_t count)
+        {
+            nodes_.reserve(nodes_.size() + count);
+        }
+
+        /**
+         * @brief Create a node in the arena. Its neighbor list is allocated from the arena too.
+         * @param node_value value of the node.
+         * @param name name of the node - default is an empty string.
+         * @param identity identity policy of the node - default is `UUID`.
+         * @return Node<T, D>* node, owned by the arena.
+         */
+        Node<T, D> *create(const NodeValue<T, D> &node_value,
+                           const std::string &name = "",
+                           const NodeIdentity identity = NodeIdentity::UUID)
+        {
+            std::pmr::polymorphic_allocator<Node<T, D>> allocator(&resource_);
+            Node<T, D> *node = allocator.allocate(1);
+            ::new (static_cast<void *>(node)) Node<T, D>(node_value, name, identity, &resource_);
+            nodes_.push_back(node);
+            return node;
+        }
+
+        /**
+         * @brief Connect the nodes of the arena, sizing every neighbor list once so it takes a single arena allocation.
+         * @param edges list of edges as indices of the nodes in creation order.
+         */
+        void connect(const std::vector<std::pair<std::size_t, std::size_t>> &edges)
+        {
+            PLOGD << "Connecting " << nodes_.size() << " arena nodes with " << edges.size() << " edges.";
+            std::vector<std::size_t> degrees(nodes_.size(), 0);
+            for (const std::pair<std::size_t, std::size_t> &edge : edges)
+            {
+                if (edge.first >= nodes_.size() || edge.second >= nodes_.size())
+                {
+                    PLOGE << "Edge (" << edge.first << ", " << edge.second << ") is out of range for " << nodes_.size() << " nodes";
+                    throw std::out_of_range("Edge index out of range");
+                }
+                ++degrees[edge.first];
+            }
+            for (std::size_t idx = 0; idx < nodes_.size(); ++idx)
+            {
+                nodes_[idx]->reserve_neighbors(degrees[idx]);
+            }
+            for (const std::pair<std::size_t, std::size_t> &edge : edges)
+            {
+                nodes_[edge.first]->add_neighbor(nodes_[edge.second]);
+            }
+        }
+
+        /**
+         * @brief Get the number of nodes.
+         * @return std::size_t number of nodes.
+         */
+        std::size_t size() const
+        {
+            return nodes_.size();
+        }
+
+        /**
+         * @brief Get a node.
+         * @param index index of the node in creation order.
+         * @return Node<T, D>* node.
+         */
+        Node<T, D> *operator[](const std::size_t index) const
+        {
+            return nodes_[index];
+        }
+
+        /**
+         * @brief Get pointers to every node, in creation order - the form taken by the graph constructors.
+         * @return std::vector<Node<T, D> *> node pointers.
+         */
+        std::vector<Node<T, D> *> get_pointers() const
+        {
+            return std::vector<Node<T, D> *>(nodes_.begin(), nodes_.end());
+        }
+
+        /**
+         * @brief Get the memory resource of the arena, e.g. to allocate other per graph data next to the nodes.
+         * @return std::pmr::memory_resource* memory resource, valid for the lifetime of the arena.
+         */
+        std::pmr::memory_resource *get_memory_resource()
+        {
+            return &resource_;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_NODE_NODE_ARENA_H
@@ -0,0 +1,255 @@
+#ifndef SEARCH_NODE_NODE_FACTORY_H
+#define SEARCH_NODE_NODE_FACTORY_H
+
+/**
+ * @file node_factory.h
+ * @brief Bulk, parallel construction of nodes into one contiguous block.
+ */
+
+#include <new>
+#include <span>
+#include <memory>
+#include <type_traits>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <exception>
+#include <algorithm>
+#include <plog/Log.h>
+#include <search/node/node.h>
+#include <search/parallel/parallel_for.h>
+
+namespace search
+{
+
+    /**
+     * @class NodeBlock
+     * @brief This class owns a fixed number of nodes constructed in place in one contiguous allocation (see `make_nodes`).
+     * Nodes keep their address for the lifetime of the block. Move only.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class NodeBlock
+    {
+
+    private:
+        // Storage of the nodes
+        Node<T, D> *nodes_ = nullptr;
+
+        // Number of nodes
+        std::size_t size_ = 0;
+
+        // Destroy the nodes and release the storage
+        void _release()
+        {
+            if (nodes_ != nullptr)
+            {
+                std::destroy_n(nodes_, size_);
+                ::operator delete(static_cast<void *>(nodes_), std::align_val_t(alignof(Node<T, D>)));
+                nodes_ = nullptr;
+                size_ = 0;
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct an empty NodeBlock object.
+         */
+        NodeBlock() = default;
+
+        /**
+         * @brief Construct a new NodeBlock object taking over `size` nodes constructed in storage from `allocate`.
+         * @param nodes storage holding `size` constructed nodes.
+         * @param size number of nodes.
+         */
+        NodeBlock(Node<T, D> *nodes, const std::size_t size)
+            : nodes_(nodes),
+              size_(size)
+        {
+        }
+
+        /**
+         * @brief Allocate uninitialized, suitably aligned storage for `size` nodes.
+         * @param size number of nodes.
+         * @return Node<T, D>* storage - release with `deallocate` unless handed to a NodeBlock.
+         */
+        static Node<T, D> *allocate(const std::size_t size)
+        {
+            return static_cast<Node<T, D> *>(::operator new(size * sizeof(Node<T, D>), std::align_val_t(alignof(Node<T, D>))));
+        }
+
+        /**
+         * @brief Release storage from `allocate` that holds no constructed node.
+         * @param nodes storage.
+         */
+        static void deallocate(Node<T, D> *nodes)
+        {
+            ::operator delete(static_cast<void *>(nodes), std::align_val_t(alignof(Node<T, D>)));
+        }
+
+        NodeBlock(const NodeBlock &) = delete;
+        NodeBlock &operator=(const NodeBlock &) = delete;
+
+        /**
+         * @brief Move construct a NodeBlock object.
+         * @param other block to take over.
+         */
+        NodeBlock(NodeBlock &&other) noexcept
+            : nodes_(std::exchange(other.nodes_, nullptr)),
+              size_(std::exchange(other.size_, 0))
+        {
+        }
+
+        /**
+         * @brief Move assign a NodeBlock object.
+         * @param other block to take over.
+         * @return NodeBlock& this block.
+         */
+        NodeBlock &operator=(NodeBlock &&other) noexcept
+        {
+            if (this != &other)
+            {
+                _release();
+                nodes_ = std::exchange(other.nodes_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destroy the NodeBlock object and every node it holds.
+         */
+        ~NodeBlock()
+        {
+            _release();
+        }
+
+        /**
+         * @brief Get the number of nodes.
+         * @return std::size_t number of nodes.
+         */
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Get a node.
+         * @param index index of the node.
+         * @return Node<T, D>& node.
+         */
+        Node<T, D> &operator[](const std::size_t index)
+        {
+            return nodes_[index];
+        }
+
+        /**
+         * @brief Get a node.
+         * @param index index of the node.
+         * @return const Node<T, D>& node.
+         */
+        const Node<T, D> &operator[](const std::size_t index) const
+        {
+            return nodes_[index];
+        }
+
+        /**
+         * @brief Get the nodes as a span.
+         * @return std::span<Node<T, D>> nodes.
+         */
+        std::span<Node<T, D>> get_nodes()
+        {
+            return std::span<Node<T, D>>(nodes_, size_);
+        }
+
+        /**
+         * @brief Get pointers to every node, in order - the form taken by the graph constructors.
+         * @return std::vector<Node<T, D> *> node pointers.
+         */
+        std::vector<Node<T, D> *> get_pointers()
+        {
+            std::vector<Node<T, D> *> pointers(size_);
+            for (std::size_t idx = 0; idx < size_; ++idx)
+            {
+                pointers[idx] = nodes_ + idx;
+            }
+            return pointers;
+        }
+    };
+
+    /**
+     * @brief Construct `count` nodes in one contiguous block in parallel - node `i` gets the value `make_value(i)`.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam F Value factory type - callable as `make_value(i)` returning a `NodeValue<T, D>`, from many threads at once.
+     * @param count number of nodes.
+     * @param make_value value factory.
+     * @param identity identity policy of the nodes - default is `UUID`.
+     * @param num_threads number of threads - default is the hardware concurrency.
+     * @return NodeBlock<T, D> block holding the nodes.
+     */
+    template <typename T, unsigned int D, typename F>
+        requires(std::is_invocable_r_v<NodeValue<T, D>, F &, std::size_t>)
+    NodeBlock<T, D> make_nodes(const std::size_t count,
+                               F &&make_value,
+                               const utils::NodeIdentity identity = utils::NodeIdentity::UUID,
+                               const std::size_t num_threads = std::thread::hardware_concurrency())
+    {
+        PLOGD << "Making " << count << " nodes on " << num_threads << " threads.";
+        Node<T, D> *nodes = NodeBlock<T, D>::allocate(count);
+        // Chunks are constructed all or nothing, so a failure only has to unwind the chunks that completed
+        std::vector<std::pair<std::size_t, std::size_t>> constructed(std::max<std::size_t>(num_threads, 1), {0, 0});
+        try
+        {
+            parallel_for(count, num_threads, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end)
+                         {
+                std::size_t idx = begin;
+                try
+                {
+                    for (; idx < end; ++idx)
+                    {
+                        ::new (static_cast<void *>(nodes + idx)) Node<T, D>(make_value(idx), "", identity);
+                    }
+                }
+                catch (...)
+                {
+                    std::destroy(nodes + begin, nodes + idx);
+                    throw;
+                }
+                constructed[chunk] = {begin, end}; });
+        }
+        catch (...)
+        {
+            for (const std::pair<std::size_t, std::size_t> &range : constructed)
+            {
+                std::destroy(nodes + range.first, nodes + range.second);
+            }
+            NodeBlock<T, D>::deallocate(nodes);
+            throw;
+        }
+        return NodeBlock<T, D>(nodes, count);
+    }
+
+    /**
+     * @brief Construct one node per value in one contiguous block in parallel - node `i` gets `values[i]`.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @param values node values.
+     * @param identity identity policy of the nodes - default is `UUID`.
+     * @param num_threads number of threads - default is the hardware concurrency.
+     * @return NodeBlock<T, D> block holding the nodes.
+     */
+    template <typename T, unsigned int D>
+    NodeBlock<T, D> make_nodes(std::span<const NodeValue<T, D>> values,
+                               const utils::NodeIdentity identity = utils::NodeIdentity::UUID,
+                               const std::size_t num_threads = std::thread::hardware_concurrency())
+    {
+        return make_nodes<T, D>(values.size(), [values](const std::size_t idx)
+                                { return values[idx]; }, identity, num_threads);
+    }
+
+} // namespace search
+
+#endif // SEARCH_NODE_NODE_FACTORY_H
@@ -0,0 +1,106 @@
+#ifndef SEARCH_NODE_NODE_POOL_H
+#define SEARCH_NODE_NODE_POOL_H
+
+/**
+ * @file node_pool.h
+ * @brief Lazily materialized nodes for environments that do not keep a `Node` per state.
+ */
+
+#include <mutex>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <plog/Log.h>
+#include <search/node/node.h>
+
+namespace search
+{
+
+    /**
+     * @class NodePool
+     * @brief This class owns `Node` objects that are created on demand from a dense node id - typically only the start, goal
+     * and path nodes of a query. A node is created once per id and keeps its address for the lifetime of the pool, so it can
+     * be handed back to the environment to look its id up again. Thread safe.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class NodePool
+    {
+
+    private:
+        // Guards the maps below
+        mutable std::mutex mutex_;
+
+        // Materialized nodes by id
+        std::unordered_map<std::uint32_t, std::unique_ptr<Node<T, D>>> nodes_;
+
+        // Ids of the materialized nodes
+        std::unordered_map<const Node<T, D> *, std::uint32_t> ids_;
+
+    public:
+        /**
+         * @brief Construct a new NodePool object.
+         */
+        NodePool() = default;
+
+        /**
+         * @brief Get the node with a given id, creating it with `make()` on first use.
+         * @tparam F Factory type - callable as `make()` returning a `std::unique_ptr<Node<T, D>>`.
+         * @param id node id.
+         * @param make node factory.
+         * @return const Node<T, D>* node with the given id.
+         */
+        template <typename F>
+        const Node<T, D> *get(const std::uint32_t id, F &&make)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = nodes_.find(id);
+            if (it == nodes_.end())
+            {
+                it = nodes_.emplace(id, make()).first;
+                ids_.emplace(it->second.get(), id);
+            }
+            return it->second.get();
+        }
+
+        /**
+         * @brief Find the id of a node handed out by this pool.
+         * @param node node.
+         * @return std::optional<std::uint32_t> id of the node, empty if the node does not come from this pool.
+         */
+        std::optional<std::uint32_t> find_id(const Node<T, D> &node) const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto it = ids_.find(&node);
+            if (it == ids_.end())
+            {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
+        /**
+         * @brief Get the number of materialized nodes.
+         * @return std::size_t number of nodes.
+         */
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return nodes_.size();
+        }
+
+        /**
+         * @brief Destroy every materialized node - invalidates every pointer handed out.
+         */
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ids_.clear();
+            nodes_.clear();
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_NODE_NODE_POOL_H
@@ -0,0 +1,257 @@
+#ifndef SEARCH_NODE_NODE_STORE_H
+#define SEARCH_NODE_NODE_STORE_H
+
+/**
+ * @file node_store.h
+ * @brief Contiguous structure of arrays storage for node values with bulk distance kernels.
+ */
+
+#include <span>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <compare>
+#include <stdexcept>
+#include <plog/Log.h>
+#include <math/types.h>
+#include <utils/constants.h>
+#include <search/node/node.h>
+
+namespace search
+{
+
+    /**
+     * @struct NodeHandle
+     * @brief Lightweight handle to a node value held by a `NodeStore` - the column index of the value.
+     */
+    struct NodeHandle
+    {
+        // Column index of the node value
+        std::uint32_t index;
+
+        /**
+         * @brief Comparison operators for NodeHandle.
+         */
+        friend auto operator<=>(const NodeHandle &, const NodeHandle &) = default;
+    };
+
+    /**
+     * @class NodeStore
+     * @brief This class keeps the values of many nodes in one contiguous column major matrix (one column per node), so
+     * distance computations over many nodes run as vectorized sweeps over Eigen blocks instead of per node scalar math. The
+     * graph environments use it to precompute distance edge costs (see `evaluate_edge_costs`).
+     * Values are addressed through `NodeHandle`s, which stay valid as the store grows.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class NodeStore
+    {
+
+        using ColumnVector = math::ColumnVector<T, D>;
+        using ColumnVectors = math::ColumnVectors<T, D>;
+        using DistanceMetric = utils::DistanceMetric;
+
+    private:
+        // Node values - one column per node, the columns past `size_` are spare capacity
+        ColumnVectors values_;
+
+        // Number of node values held
+        std::size_t size_ = 0;
+
+        // Check the size of an output buffer
+        void _check(const std::size_t count, const std::size_t output_size) const
+        {
+            if (count != output_size)
+            {
+                PLOGE << "NodeStore got an output of size " << output_size << " for " << count << " distances";
+                throw std::invalid_argument("NodeStore output size must match the number of distances");
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new NodeStore object.
+         * @param capacity number of node values to reserve space for - default is 0.
+         */
+        explicit NodeStore(const std::size_t capacity = 0)
+            : values_(D, capacity)
+        {
+            PLOGD << "Initializing NodeStore object with capacity " << capacity;
+        }
+
+        /**
+         * @brief Construct a new NodeStore object holding the given node values in order (handle `i` is `values[i]`).
+         * @param values node values.
+         */
+        explicit NodeStore(const std::vector<NodeValue<T, D>> &values)
+            : values_(D, values.size()),
+              size_(values.size())
+        {
+            PLOGD << "Initializing NodeStore object with " << size_ << " node values";
+            for (std::size_t idx = 0; idx < size_; ++idx)
+            {
+                values_.col(idx) = values[idx].value;
+            }
+        }
+
+        /**
+         * @brief Destroy the NodeStore object.
+         */
+        ~NodeStore()
+        {
+            PLOGD << "Destroying NodeStore object";
+        }
+
+        /**
+         * @brief Get the number of node values held.
+         * @return std::size_t number of node values.
+         */
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Reserve space for `capacity` node values.
+         * @param capacity number of node values.
+         */
+        void reserve(const std::size_t capacity)
+        {
+            if (capacity > static_cast<std::size_t>(values_.cols()))
+            {
+                values_.conservativeResize(Eigen::NoChange, capacity);
+            }
+        }
+
+        /**
+         * @brief Add a node value to the store.
+         * @param value node value.
+         * @return NodeHandle handle to the stored value.
+         */
+        NodeHandle add(const ColumnVector &value)
+        {
+            if (size_ == static_cast<std::size_t>(values_.cols()))
+            {
+                this->reserve(std::max<std::size_t>(2 * size_, 16));
+            }
+            values_.col(size_) = value;
+            return NodeHandle{static_cast<std::uint32_t>(size_++)};
+        }
+
+        /**
+         * @brief Add a node value to the store.
+         * @param node_value node value.
+         * @return NodeHandle handle to the stored value.
+         */
+        NodeHandle add(const NodeValue<T, D> &node_value)
+        {
+            return this->add(node_value.value);
+        }
+
+        /**
+         * @brief Get a node value.
+         * @param handle handle of the node value.
+         * @return Read only view of the node value column.
+         */
+        auto get_value(const NodeHandle handle) const
+        {
+            return values_.col(handle.index);
+        }
+
+        /**
+         * @brief Set a node value.
+         * @param handle handle of the node value.
+         * @param value new node value.
+         */
+        void set_value(const NodeHandle handle, const ColumnVector &value)
+        {
+            values_.col(handle.index) = value;
+        }
+
+        /**
+         * @brief Get every node value as one `D x size()` block.
+         * @return Read only view of the node values.
+         */
+        auto get_values() const
+        {
+            return values_.leftCols(size_);
+        }
+
+        /**
+         * @brief Compute the distance from `from_value` to every node value in one sweep.
+         * @param from_value value to measure from.
+         * @param distance_metric distance metric.
+         * @param distances output - `distances[i]` is the distance to the node value with handle `i` (size must be `size()`).
+         */
+        void get_distances(const ColumnVector &from_value,
+                           const DistanceMetric distance_metric,
+                           std::span<double> distances) const
+        {
+            this->_check(size_, distances.size());
+            Eigen::Map<Eigen::RowVectorXd> output(distances.data(), static_cast<Eigen::Index>(distances.size()));
+            const auto differences = (values_.leftCols(size_).template cast<double>().colwise() - from_value.template cast<double>());
+            switch (distance_metric)
+            {
+            case DistanceMetric::EUCLIDEAN:
+                output = differences.colwise().norm();
+                break;
+            case DistanceMetric::MANHATTAN:
+                output = differences.cwiseAbs().colwise().sum();
+                break;
+            default:
+                PLOGE << "Unknown distance metric: " << static_cast<int>(distance_metric);
+                throw std::invalid_argument("Unknown distance metric");
+            }
+        }
+
+        /**
+         * @brief Compute the distance from `from_value` to a subset of the node values (e.g. the neighbors of a node).
+         * @param from_value value to measure from.
+         * @param distance_metric distance metric.
+         * @param indices handle indices of the node values to measure to.
+         * @param distances output - `distances[i]` is the distance to the node value `indices[i]` (size must match).
+         */
+        void get_distances(const ColumnVector &from_value,
+                           const DistanceMetric distance_metric,
+                           std::span<const std::uint32_t> indices,
+                           std::span<double> distances) const
+        {
+            this->_check(indices.size(), distances.size());
+            const math::ColumnVector<double, D> from = from_value.template cast<double>();
+            switch (distance_metric)
+            {
+            case DistanceMetric::EUCLIDEAN:
+                for (std::size_t idx = 0; idx < indices.size(); ++idx)
+                {
+                    distances[idx] = (values_.col(indices[idx]).template cast<double>() - from).norm();
+                }
+                break;
+            case DistanceMetric::MANHATTAN:
+                for (std::size_t idx = 0; idx < indices.size(); ++idx)
+                {
+                    distances[idx] = (values_.col(indices[idx]).template cast<double>() - from).template lpNorm<1>();
+                }
+                break;
+            default:
+                PLOGE << "Unknown distance metric: " << static_cast<int>(distance_metric);
+                throw std::invalid_argument("Unknown distance metric");
+            }
+        }
+
+        /**
+         * @brief << operator - function for streaming the NodeStore to an output stream.
+         * @param os output stream.
+         * @param store store to stream.
+         * @return std::ostream& output stream.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const NodeStore<T, D> &store)
+        {
+            os << "NodeStore[Size: " << store.size_ << " | Capacity: " << store.values_.cols() << "]";
+            return os;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_NODE_NODE_STORE_H
@@ -0,0 +1,258 @@
+#ifndef SEARCH_PARALLEL_EXECUTOR_H
+#define SEARCH_PARALLEL_EXECUTOR_H
+
+/**
+ * @file executor.h
+ * @brief Work-stealing thread pool with per task priorities.
+ */
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <condition_variable>
+#include <plog/Log.h>
+#include <utils/constants.h>
+#include <search/parallel/parallel_for.h>
+
+namespace search
+{
+
+    /**
+     * @class WorkStealingExecutor
+     * @brief This class runs submitted tasks on a fixed set of worker threads. Every worker owns one task deque per priority:
+     * it takes its own tasks newest first and, once its deque of a priority is empty, steals the oldest task of that priority
+     * from the other workers before it looks at a lower priority. Tasks submitted from outside the pool are dealt round-robin
+     * over the workers, tasks submitted from a worker go to its own deque. Destroying the executor runs every queued task
+     * before the workers are joined. Tasks must not block on the futures of other tasks of the same executor. Every worker
+     * runs inside a `ParallelRegion`, so the `parallel_for` loops of a task stay on its worker.
+     */
+    class WorkStealingExecutor
+    {
+
+        using TaskPriority = utils::TaskPriority;
+
+    private:
+        // Number of priority levels
+        static constexpr std::size_t num_priorities_ = 3;
+
+        // Queued task
+        using Task = std::function<void()>;
+
+        // Task deques of a worker - one per priority
+        struct Worker
+        {
+            std::mutex mutex;
+            std::array<std::deque<Task>, num_priorities_> queues;
+        };
+
+        // Executor whose worker is running on this thread - none outside the pools
+        static inline thread_local const WorkStealingExecutor *current_executor_ = nullptr;
+
+        // Index of the worker running on this thread
+        static inline thread_local std::size_t current_worker_ = 0;
+
+        // Workers
+        std::vector<std::unique_ptr<Worker>> workers_;
+
+        // Worker threads
+        std::vector<std::thread> threads_;
+
+        // Guards sleeping and stopping
+        std::mutex sleep_mutex_;
+
+        // Signalled when a task is queued or the executor stops
+        std::condition_variable wake_;
+
+        // Number of queued tasks not yet taken by a worker
+        std::atomic<std::size_t> num_queued_ = 0;
+
+        // Worker the next outside submission goes to
+        std::atomic<std::size_t> next_worker_ = 0;
+
+        // Whether the executor is being destroyed
+        bool stopping_ = false;
+
+        // Function to take the next task of a worker: own deque newest first, then the oldest task of the others
+        bool _try_pop(const std::size_t index, Task &task)
+        {
+            for (std::size_t priority = 0; priority < num_priorities_; ++priority)
+            {
+                {
+                    Worker &worker = *workers_[index];
+                    std::lock_guard<std::mutex> lock(worker.mutex);
+                    std::deque<Task> &queue = worker.queues[priority];
+                    if (!queue.empty())
+                    {
+                        task = std::move(queue.back());
+                        queue.pop_back();
+                        return true;
+                    }
+                }
+                for (std::size_t offset = 1; offset < workers_.size(); ++offset)
+                {
+                    Worker &victim = *workers_[(index + offset) % workers_.size()];
+                    std::lock_guard<std::mutex> lock(victim.mutex);
+                    std::deque<Task> &queue = victim.queues[priority];
+                    if (!queue.empty())
+                    {
+                        task = std::move(queue.front());
+                        queue.pop_front();
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        // Function run by every worker thread
+        void _run(const std::size_t index)
+        {
+            current_executor_ = this;
+            current_worker_ = index;
+            // Tasks share the workers, so the loops they run stay on their worker
+            const ParallelRegion region;
+            Task task;
+            while (true)
+            {
+                if (this->_try_pop(index, task))
+                {
+                    num_queued_.fetch_sub(1, std::memory_order_relaxed);
+                    task();
+                    task = nullptr;
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(sleep_mutex_);
+                if (num_queued_.load(std::memory_order_relaxed) > 0)
+                {
+                    // A task is queued but another worker is taking it or it is being pushed - look again
+                    lock.unlock();
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (stopping_)
+                {
+                    return;
+                }
+                wake_.wait(lock);
+            }
+        }
+
+        // Function to queue a task
+        void _push(Task task, const TaskPriority priority)
+        {
+            const std::size_t index = current_executor_ == this
+                                          ? current_worker_
+                                          : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+            {
+                Worker &worker = *workers_[index];
+                std::lock_guard<std::mutex> lock(worker.mutex);
+                worker.queues[static_cast<std::size_t>(priority)].push_back(std::move(task));
+            }
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex_);
+                num_queued_.fetch_add(1, std::memory_order_relaxed);
+            }
+            wake_.notify_one();
+        }
+
+    public:
+        /**
+         * @brief Construct a new WorkStealingExecutor object.
+         * @param num_threads number of worker threads - default is the number of hardware threads.
+         */
+        explicit WorkStealingExecutor(const std::size_t num_threads = std::thread::hardware_concurrency())
+        {
+            const std::size_t num_workers = std::max<std::size_t>(num_threads, 1);
+            PLOGD << "Initializing WorkStealingExecutor object with " << num_workers << " threads.";
+            workers_.reserve(num_workers);
+            for (std::size_t index = 0; index < num_workers; ++index)
+            {
+                workers_.emplace_back(std::make_unique<Worker>());
+            }
+            threads_.reserve(num_workers);
+            for (std::size_t index = 0; index < num_workers; ++index)
+            {
+                threads_.emplace_back(&WorkStealingExecutor::_run, this, index);
+            }
+        }
+
+        WorkStealingExecutor(const WorkStealingExecutor &) = delete;
+        WorkStealingExecutor &operator=(const WorkStealingExecutor &) = delete;
+
+        /**
+         * @brief Destroy the WorkStealingExecutor object - runs every queued task, then joins the workers.
+         */
+        ~WorkStealingExecutor()
+        {
+            PLOGD << "Destroying WorkStealingExecutor object.";
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex_);
+                stopping_ = true;
+            }
+            wake_.notify_all();
+            for (std::thread &thread : threads_)
+            {
+                thread.join();
+            }
+        }
+
+        /**
+         * @brief Get the process wide executor sized to the number of hardware threads - created on first use.
+         * @return WorkStealingExecutor& executor.
+         */
+        static WorkStealingExecutor &get_default()
+        {
+            static WorkStealingExecutor executor;
+            return executor;
+        }
+
+        /**
+         * @brief Get the number of worker threads.
+         * @return std::size_t number of threads.
+         */
+        std::size_t get_num_threads() const
+        {
+            return threads_.size();
+        }
+
+        /**
+         * @brief Check whether the calling thread is one of the workers of this executor.
+         * @return true if called from a task of this executor, false otherwise.
+         */
+        bool is_worker_thread() const
+        {
+            return current_executor_ == this;
+        }
+
+        /**
+         * @brief Queue `fn()` to run on a worker. An exception thrown by `fn` is stored in the returned future.
+         * @tparam F Function type - callable as `fn()`.
+         * @param fn function to run.
+         * @param priority priority of the task - default is normal.
+         * @return std::future<std::invoke_result_t<F>> result of `fn`.
+         */
+        template <typename F>
+        std::future<std::invoke_result_t<std::decay_t<F>>> submit(F &&fn, const TaskPriority priority = TaskPriority::NORMAL)
+        {
+            using R = std::invoke_result_t<std::decay_t<F>>;
+            // std::function needs a copyable callable - share the packaged task
+            auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+            std::future<R> result = task->get_future();
+            this->_push([task]()
+                        { (*task)(); },
+                        priority);
+            return result;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_PARALLEL_EXECUTOR_H
@@ -0,0 +1,123 @@
+#ifndef SEARCH_PARALLEL_PARALLEL_FOR_H
+#define SEARCH_PARALLEL_PARALLEL_FOR_H
+
+/**
+ * @file parallel_for.h
+ * @brief Minimal fork-join loop splitting a range across threads, run serially when nested in another parallel region.
+ */
+
+#include <thread>
+#include <exception>
+#include <vector>
+#include <algorithm>
+
+namespace search
+{
+
+    /**
+     * @class ParallelRegion
+     * @brief This class marks the calling thread as running inside a parallel region - a chunk of `parallel_for` or a worker
+     * of an executor - for as long as it lives. Every core is then already busy, so `parallel_for` runs nested loops on the
+     * calling thread instead of spawning threads of its own (e.g. a multi-threaded BFS inside a batch or asynchronous query).
+     */
+    class ParallelRegion
+    {
+    private:
+        // Whether the calling thread runs inside a parallel region
+        static inline thread_local bool active_ = false;
+
+        // State of the calling thread before the region started
+        bool was_active_;
+
+    public:
+        /**
+         * @brief Construct a new ParallelRegion object and enter the region.
+         */
+        ParallelRegion()
+            : was_active_(active_)
+        {
+            active_ = true;
+        }
+
+        /**
+         * @brief Destructor for the ParallelRegion class - leaves the region.
+         */
+        ~ParallelRegion()
+        {
+            active_ = was_active_;
+        }
+
+        ParallelRegion(const ParallelRegion &) = delete;
+        ParallelRegion &operator=(const ParallelRegion &) = delete;
+
+        /**
+         * @brief Check whether the calling thread runs inside a parallel region.
+         * @return true if it does, false otherwise.
+         */
+        static bool is_active()
+        {
+            return active_;
+        }
+    };
+
+    /**
+     * @brief Run `fn(chunk, begin, end)` over `[0, count)` split into at most `num_threads` contiguous chunks of at least
+     * `grain_size` items and wait for all of them. The calling thread runs the first chunk. Inside a `ParallelRegion` the
+     * whole range is one chunk run on the calling thread. An exception thrown by any chunk is rethrown once every chunk has
+     * finished.
+     * @tparam F Function type - callable as `fn(chunk, begin, end)`.
+     * @param count number of items.
+     * @param num_threads maximum number of chunks (threads).
+     * @param fn function run on every chunk.
+     * @param grain_size minimum number of items handed to a thread - default is 4096.
+     * @return std::size_t number of chunks.
+     */
+    template <typename F>
+    std::size_t parallel_for(const std::size_t count,
+                             const std::size_t num_threads,
+                             F &&fn,
+                             const std::size_t grain_size = 4096)
+    {
+        const std::size_t max_chunks = ParallelRegion::is_active() ? 1 : std::max<std::size_t>(num_threads, 1);
+        const std::size_t num_chunks = std::clamp<std::size_t>(count / std::max<std::size_t>(grain_size, 1), 1, max_chunks);
+        if (num_chunks == 1)
+        {
+            fn(0, 0, count);
+            return num_chunks;
+        }
+        const std::size_t chunk_size = (count + num_chunks - 1) / num_chunks;
+        std::vector<std::exception_ptr> errors(num_chunks);
+        const auto run = [&](const std::size_t chunk)
+        {
+            const ParallelRegion region;
+            try
+            {
+                fn(chunk, std::min(count, chunk * chunk_size), std::min(count, (chunk + 1) * chunk_size));
+            }
+            catch (...)
+            {
+                errors[chunk] = std::current_exception();
+            }
+        };
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(num_chunks - 1);
+            for (std::size_t chunk = 1; chunk < num_chunks; ++chunk)
+            {
+                workers.emplace_back(run, chunk);
+            }
+            run(0);
+        } // Join the workers
+        for (const std::exception_ptr &error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+        return num_chunks;
+    }
+
+} // namespace search
+
+#endif // SEARCH_PARALLEL_PARALLEL_FOR_H
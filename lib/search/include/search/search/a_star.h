@@ -0,0 +1,145 @@
+#ifndef SEARCH_A_STAR_H
+#define SEARCH_A_STAR_H
+
+/**
+ * @file a_star.h
+ * @brief A* search algorithm implementation for graph-based environments.
+ */
+
+#include <limits>
+#include <search/search/search.h>
+#include <search/heuristic/distance_heuristic.h>
+
+namespace search
+{
+    /**
+     * @class AStar
+     * @brief This class represents the A* search algorithm for searching in an environment. Nodes are expanded in order of
+     * `g + epsilon * h` where `h` is supplied by the heuristic policy `H`. With an admissible heuristic and `epsilon = 1` the
+     * path is optimal; with `epsilon > 1` (weighted A*) it costs at most `epsilon` times the optimum and usually far fewer
+     * nodes are expanded. Edge costs must be non negative.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     * @tparam H Heuristic type - default is the Euclidean distance heuristic.
+     */
+    template <typename T, unsigned int D, typename E, typename H = EuclideanHeuristic<T, D>>
+        requires(IndexedEnvironment<E, T, D> && Heuristic<H, T, D>)
+    class AStar : protected Search<T, D, E>
+    {
+    private:
+        // Heuristic policy
+        H heuristic_;
+
+        // Heuristic inflation factor
+        double epsilon_;
+
+    public:
+        /**
+         * @brief Construct a new AStar object.
+         * @param heuristic heuristic policy - default constructed by default.
+         * @param epsilon heuristic inflation factor (>= 1) - default is 1 (plain A*).
+         */
+        AStar(const H &heuristic = H(),
+              const double epsilon = 1.0)
+            : heuristic_(heuristic),
+              epsilon_(epsilon)
+        {
+            PLOGD << "Initializing AStar object with epsilon: " << epsilon_;
+            if (epsilon_ < 1.0)
+            {
+                PLOGE << "AStar epsilon must be at least 1, got: " << epsilon_;
+                throw std::invalid_argument("AStar epsilon must be at least 1");
+            }
+        }
+
+        /**
+         * @brief Destructor for the AStar class.
+         */
+        ~AStar()
+        {
+            PLOGD << "Destroying AStar object.";
+        }
+
+        /**
+         * @brief Get the heuristic inflation factor.
+         * @return double epsilon.
+         */
+        double get_epsilon() const
+        {
+            return epsilon_;
+        }
+
+        /**
+         * @brief Perform A* search on graph based environment and return a path from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, env, workspace);
+        }
+
+        /**
+         * @brief Perform A* search on graph based environment reusing the scratch memory of `workspace`.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing A* search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            const std::uint32_t start_id = env.get_node_id(start_node);
+            const std::uint32_t goal_id = env.get_node_id(goal_node);
+            const NodeValue<T, D> &goal_value = env.get_node_value(goal_id);
+            workspace.begin(env.get_num_nodes());
+            IndexedDaryHeap<double> &frontier = workspace.get_heap();
+            workspace.reach(start_id, start_id, 0.0);
+            frontier.push(start_id, epsilon_ * heuristic_.get_heuristic(env.get_node_value(start_id), goal_value));
+            while (!frontier.empty())
+            {
+                if (workspace.is_cancelled())
+                {
+                    PLOGD << "A* search cancelled.";
+                    return {};
+                }
+                const std::uint32_t current_id = frontier.pop().second;
+                if (current_id == goal_id)
+                {
+                    return this->get_path(start_id, goal_id, workspace, env);
+                }
+                const double cost = workspace.get_cost(current_id);
+                env.for_each_edge(current_id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                  {
+                    if (edge_cost < 0.0)
+                    {
+                        PLOGE << "A* found a negative edge cost: " << edge_cost;
+                        throw std::invalid_argument("A* requires non negative edge costs");
+                    }
+                    const double new_cost = cost + edge_cost;
+                    if (new_cost < workspace.get_cost(neighbor_id))
+                    {
+                        // Closed nodes are reopened when a cheaper path shows up (inconsistent heuristics)
+                        workspace.reach(neighbor_id, current_id, new_cost);
+                        frontier.push_or_decrease(neighbor_id, new_cost + epsilon_ * heuristic_.get_heuristic(env.get_node_value(neighbor_id), goal_value));
+                    } });
+            }
+            return {};
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_A_STAR_H
@@ -0,0 +1,257 @@
+#ifndef SEARCH_ARA_STAR_H
+#define SEARCH_ARA_STAR_H
+
+/**
+ * @file ara_star.h
+ * @brief Anytime Repairing A* (ARA*) search algorithm implementation for graph-based environments.
+ */
+
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <memory_resource>
+#include <search/search/search.h>
+#include <search/heuristic/distance_heuristic.h>
+
+namespace search
+{
+    /**
+     * @class AraStar
+     * @brief This class represents the Anytime Repairing A* (ARA*) algorithm: a series of weighted A* searches, ordered by
+     * `g + epsilon * h`, whose inflation factor starts at `initial_epsilon` and drops by `epsilon_step` after every solution
+     * until it reaches 1. Every search reuses the costs of the previous ones - nodes whose cost improved after they were
+     * expanded are kept aside and put back in the frontier for the next search instead of being expanded twice in the same
+     * one - so a first, bounded suboptimal, path comes quickly and is then improved at little extra cost. With an admissible
+     * heuristic every path costs at most `epsilon` times the optimum and the last one is optimal. When the cancellation token
+     * of the workspace stops the search, the best path found so far is returned (empty if none was found yet), and
+     * `get_solution_epsilon` tells how far from optimal it can be. Edge costs must be non negative. The statistics describe
+     * the last search, so an object must not run searches from several threads at once.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     * @tparam H Heuristic type - default is the Euclidean distance heuristic.
+     */
+    template <typename T, unsigned int D, typename E, typename H = EuclideanHeuristic<T, D>>
+        requires(IndexedEnvironment<E, T, D> && Heuristic<H, T, D>)
+    class AraStar : protected Search<T, D, E>
+    {
+    private:
+        // Heuristic policy
+        H heuristic_;
+
+        // Inflation factor of the first search
+        double initial_epsilon_;
+
+        // Decrease of the inflation factor after every solution
+        double epsilon_step_;
+
+        // Inflation factor of the path returned by the last search - infinity when none was found
+        mutable double solution_epsilon_ = std::numeric_limits<double>::infinity();
+
+        // Number of weighted A* searches run by the last search
+        mutable std::size_t num_iterations_ = 0;
+
+        // Number of nodes expanded by the last search, over every iteration
+        mutable std::size_t num_expansions_ = 0;
+
+    public:
+        /**
+         * @brief Construct a new AraStar object.
+         * @param heuristic heuristic policy - default constructed by default.
+         * @param initial_epsilon inflation factor of the first search (>= 1) - default is 3.
+         * @param epsilon_step decrease of the inflation factor after every solution (> 0) - default is 0.5.
+         */
+        AraStar(const H &heuristic = H(),
+                const double initial_epsilon = 3.0,
+                const double epsilon_step = 0.5)
+            : heuristic_(heuristic),
+              initial_epsilon_(initial_epsilon),
+              epsilon_step_(epsilon_step)
+        {
+            PLOGD << "Initializing AraStar object with epsilon: " << initial_epsilon_ << " and step: " << epsilon_step_;
+            if (initial_epsilon_ < 1.0)
+            {
+                PLOGE << "AraStar epsilon must be at least 1, got: " << initial_epsilon_;
+                throw std::invalid_argument("AraStar epsilon must be at least 1");
+            }
+            if (epsilon_step_ <= 0.0)
+            {
+                PLOGE << "AraStar epsilon step must be positive, got: " << epsilon_step_;
+                throw std::invalid_argument("AraStar epsilon step must be positive");
+            }
+        }
+
+        /**
+         * @brief Destructor for the AraStar class.
+         */
+        ~AraStar()
+        {
+            PLOGD << "Destroying AraStar object.";
+        }
+
+        /**
+         * @brief Perform ARA* search on graph based environment and return the best path from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, env, workspace);
+        }
+
+        /**
+         * @brief Perform ARA* search on graph based environment reusing the scratch memory of `workspace`, and return the
+         * best path found before the search ends or the cancellation token of the workspace stops it.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing ARA* search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            const std::uint32_t start_id = env.get_node_id(start_node);
+            const std::uint32_t goal_id = env.get_node_id(goal_node);
+            const NodeValue<T, D> goal_value = env.get_node_value(goal_id);
+            solution_epsilon_ = std::numeric_limits<double>::infinity();
+            num_iterations_ = 0;
+            num_expansions_ = 0;
+            workspace.begin(env.get_num_nodes());
+            IndexedDaryHeap<double> &frontier = workspace.get_heap();
+            // Nodes whose cost improved after their expansion in the current iteration
+            std::pmr::vector<std::uint32_t> &inconsistent = workspace.get_stack();
+            const auto get_heuristic = [&](const std::uint32_t id)
+            {
+                return heuristic_.get_heuristic(env.get_node_value(id), goal_value);
+            };
+            std::vector<std::pair<const Node<T, D> *, double>> path;
+            double epsilon = initial_epsilon_;
+            workspace.reach(start_id, start_id, 0.0);
+            frontier.push(start_id, epsilon * get_heuristic(start_id));
+            while (true)
+            {
+                // Nodes expanded in this iteration are marked in its pass
+                workspace.begin_pass();
+                ++num_iterations_;
+                PLOGD << "ARA* iteration " << num_iterations_ << " with epsilon " << epsilon;
+                // Weighted A* until no frontier node can improve the path to the goal
+                while (!frontier.empty() && frontier.top().first < workspace.get_cost(goal_id))
+                {
+                    if (workspace.is_cancelled())
+                    {
+                        PLOGD << "ARA* search cancelled with epsilon " << solution_epsilon_ << " after " << num_expansions_ << " expansions.";
+                        return path;
+                    }
+                    const std::uint32_t current_id = frontier.pop().second;
+                    workspace.mark_in_pass(current_id);
+                    ++num_expansions_;
+                    const double cost = workspace.get_cost(current_id);
+                    env.for_each_edge(current_id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                      {
+                        if (edge_cost < 0.0)
+                        {
+                            PLOGE << "ARA* found a negative edge cost: " << edge_cost;
+                            throw std::invalid_argument("ARA* requires non negative edge costs");
+                        }
+                        const double new_cost = cost + edge_cost;
+                        if (new_cost < workspace.get_cost(neighbor_id))
+                        {
+                            workspace.reach(neighbor_id, current_id, new_cost);
+                            if (workspace.is_marked_in_pass(neighbor_id))
+                            {
+                                inconsistent.push_back(neighbor_id);
+                            }
+                            else
+                            {
+                                frontier.push_or_decrease(neighbor_id, new_cost + epsilon * get_heuristic(neighbor_id));
+                            }
+                        } });
+                }
+                if (!workspace.is_reached(goal_id))
+                {
+                    PLOGD << "ARA* found no path after " << num_expansions_ << " expansions.";
+                    return path;
+                }
+                path = this->get_path(start_id, goal_id, workspace, env);
+                solution_epsilon_ = epsilon;
+                PLOGD << "ARA* found a path of cost " << path.back().second << " with epsilon " << epsilon;
+                if (epsilon == 1.0)
+                {
+                    return path;
+                }
+                // Put the inconsistent nodes back and order the frontier by the lower inflation factor
+                epsilon = std::max(1.0, epsilon - epsilon_step_);
+                while (!frontier.empty())
+                {
+                    inconsistent.push_back(frontier.pop().second);
+                }
+                for (const std::uint32_t id : inconsistent)
+                {
+                    frontier.push_or_decrease(id, workspace.get_cost(id) + epsilon * get_heuristic(id));
+                }
+                inconsistent.clear();
+            }
+        }
+
+        /**
+         * @brief Get the inflation factor of the first search.
+         * @return double initial epsilon.
+         */
+        double get_initial_epsilon() const
+        {
+            return initial_epsilon_;
+        }
+
+        /**
+         * @brief Get the decrease of the inflation factor after every solution.
+         * @return double epsilon step.
+         */
+        double get_epsilon_step() const
+        {
+            return epsilon_step_;
+        }
+
+        /**
+         * @brief Get the inflation factor the path returned by the last search was found with - with an admissible heuristic
+         * it costs at most this many times the optimum. 1 when the search ran to completion, infinity when no path was found.
+         * @return double suboptimality bound of the last path.
+         */
+        double get_solution_epsilon() const
+        {
+            return solution_epsilon_;
+        }
+
+        /**
+         * @brief Get the number of weighted A* searches run by the last search.
+         * @return std::size_t number of iterations.
+         */
+        std::size_t get_num_iterations() const
+        {
+            return num_iterations_;
+        }
+
+        /**
+         * @brief Get the number of nodes expanded by the last search, over every iteration.
+         * @return std::size_t number of expansions.
+         */
+        std::size_t get_num_expansions() const
+        {
+            return num_expansions_;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_ARA_STAR_H
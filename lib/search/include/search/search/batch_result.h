@@ -0,0 +1,266 @@
+#ifndef SEARCH_SEARCH_BATCH_RESULT_H
+#define SEARCH_SEARCH_BATCH_RESULT_H
+
+/**
+ * @file batch_result.h
+ * @brief Queries and columnar results of batched searches.
+ */
+
+#include <span>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <plog/Log.h>
+#include <search/node/node.h>
+#include <search/search/workspace.h>
+
+namespace search
+{
+
+    /**
+     * @struct SearchQuery
+     * @brief A start to goal query of a batched search.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    struct SearchQuery
+    {
+        const Node<T, D> *start_node; // The starting node
+        const Node<T, D> *goal_node;  // The goal node
+    };
+
+    /**
+     * @class SearchBatchResult
+     * @brief This class holds the paths of a batch of queries in columnar form: the nodes and step costs of every path are
+     * stored back to back in two flat arrays, and path `q` spans `[offsets[q], offsets[q + 1])` of them. A query without a
+     * path has an empty span and an infinite cost.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class SearchBatchResult
+    {
+
+    public:
+        /**
+         * @class Buffer
+         * @brief Paths collected by one thread of a batched search, in the order the thread found them.
+         */
+        class Buffer
+        {
+
+            friend class SearchBatchResult<T, D>;
+
+        private:
+            // Query index and start (in `nodes_` / `step_costs_`) of every path
+            std::vector<std::pair<std::size_t, std::size_t>> paths_;
+
+            // Nodes of the paths
+            std::vector<const Node<T, D> *> nodes_;
+
+            // Step costs of the paths
+            std::vector<double> step_costs_;
+
+        public:
+            /**
+             * @brief Add the path of a query.
+             * @param query index of the query.
+             * @param path path from start to goal along with its step costs - empty when there is none.
+             */
+            void add(const std::size_t query, const std::vector<std::pair<const Node<T, D> *, double>> &path)
+            {
+                paths_.emplace_back(query, nodes_.size());
+                for (const std::pair<const Node<T, D> *, double> &step : path)
+                {
+                    nodes_.push_back(step.first);
+                    step_costs_.push_back(step.second);
+                }
+            }
+
+            /**
+             * @brief Add the path of a query from the parents and costs held by a workspace - an empty path when the goal
+             * was not closed.
+             * @tparam E Environment type.
+             * @param query index of the query.
+             * @param from_id id of the starting node.
+             * @param to_id id of the goal node.
+             * @param workspace workspace holding the parent and cost of every reached node.
+             * @param env The environment in which the search was performed.
+             */
+            template <typename E>
+            void add(const std::size_t query,
+                     const std::uint32_t from_id,
+                     const std::uint32_t to_id,
+                     const SearchWorkspace &workspace,
+                     const E &env)
+            {
+                paths_.emplace_back(query, nodes_.size());
+                if (!workspace.is_closed(to_id))
+                {
+                    return;
+                }
+                const std::size_t begin = nodes_.size();
+                for (std::uint32_t id = to_id; id != from_id; id = workspace.get_parent(id))
+                {
+                    nodes_.push_back(env.get_node(id));
+                    step_costs_.push_back(workspace.get_cost(id));
+                }
+                nodes_.push_back(env.get_node(from_id));
+                step_costs_.push_back(0.0);
+                std::reverse(nodes_.begin() + begin, nodes_.end());
+                std::reverse(step_costs_.begin() + begin, step_costs_.end());
+            }
+        };
+
+    private:
+        // Start of every path in `nodes_` / `step_costs_`, followed by the total length
+        std::vector<std::size_t> offsets_;
+
+        // Nodes of the paths
+        std::vector<const Node<T, D> *> nodes_;
+
+        // Step costs of the paths
+        std::vector<double> step_costs_;
+
+    public:
+        /**
+         * @brief Construct an empty SearchBatchResult object.
+         */
+        SearchBatchResult()
+            : offsets_(1, 0)
+        {
+        }
+
+        /**
+         * @brief Construct a new SearchBatchResult object by gathering the paths collected by the threads of a batched search.
+         * @param num_queries number of queries - every query must have been added to exactly one buffer.
+         * @param buffers per thread paths.
+         */
+        SearchBatchResult(const std::size_t num_queries, const std::span<const Buffer> buffers)
+            : offsets_(num_queries + 1, 0)
+        {
+            PLOGD << "Gathering the paths of " << num_queries << " queries from " << buffers.size() << " buffers.";
+            for (const Buffer &buffer : buffers)
+            {
+                for (std::size_t idx = 0; idx < buffer.paths_.size(); ++idx)
+                {
+                    const std::size_t end = idx + 1 < buffer.paths_.size() ? buffer.paths_[idx + 1].second : buffer.nodes_.size();
+                    offsets_[buffer.paths_[idx].first + 1] = end - buffer.paths_[idx].second;
+                }
+            }
+            for (std::size_t query = 0; query < num_queries; ++query)
+            {
+                offsets_[query + 1] += offsets_[query];
+            }
+            nodes_.resize(offsets_.back());
+            step_costs_.resize(offsets_.back());
+            for (const Buffer &buffer : buffers)
+            {
+                for (std::size_t idx = 0; idx < buffer.paths_.size(); ++idx)
+                {
+                    const auto [query, begin] = buffer.paths_[idx];
+                    const std::size_t end = idx + 1 < buffer.paths_.size() ? buffer.paths_[idx + 1].second : buffer.nodes_.size();
+                    std::copy(buffer.nodes_.begin() + begin, buffer.nodes_.begin() + end, nodes_.begin() + offsets_[query]);
+                    std::copy(buffer.step_costs_.begin() + begin, buffer.step_costs_.begin() + end, step_costs_.begin() + offsets_[query]);
+                }
+            }
+        }
+
+        /**
+         * @brief Get the number of queries.
+         * @return std::size_t number of queries.
+         */
+        std::size_t size() const
+        {
+            return offsets_.size() - 1;
+        }
+
+        /**
+         * @brief Check whether a path was found for a query.
+         * @param query index of the query.
+         * @return true if the query has a path, false otherwise.
+         */
+        bool has_path(const std::size_t query) const
+        {
+            return offsets_[query + 1] > offsets_[query];
+        }
+
+        /**
+         * @brief Get the cost of the path of a query.
+         * @param query index of the query.
+         * @return double cost of the path, infinity when there is none.
+         */
+        double get_cost(const std::size_t query) const
+        {
+            return this->has_path(query) ? step_costs_[offsets_[query + 1] - 1] : std::numeric_limits<double>::infinity();
+        }
+
+        /**
+         * @brief Get the nodes of the path of a query.
+         * @param query index of the query.
+         * @return std::span<const Node<T, D> *const> nodes from start to goal.
+         */
+        std::span<const Node<T, D> *const> get_path_nodes(const std::size_t query) const
+        {
+            return {nodes_.data() + offsets_[query], offsets_[query + 1] - offsets_[query]};
+        }
+
+        /**
+         * @brief Get the step costs of the path of a query.
+         * @param query index of the query.
+         * @return std::span<const double> cost to reach every node of the path.
+         */
+        std::span<const double> get_path_costs(const std::size_t query) const
+        {
+            return {step_costs_.data() + offsets_[query], offsets_[query + 1] - offsets_[query]};
+        }
+
+        /**
+         * @brief Get the path of a query in the form returned by `Environment::search`.
+         * @param query index of the query.
+         * @return A vectors of pairs representing the path from start to goal along with its step costs.
+         */
+        std::vector<std::pair<const Node<T, D> *, double>> get_path(const std::size_t query) const
+        {
+            std::vector<std::pair<const Node<T, D> *, double>> path;
+            path.reserve(offsets_[query + 1] - offsets_[query]);
+            for (std::size_t idx = offsets_[query]; idx < offsets_[query + 1]; ++idx)
+            {
+                path.emplace_back(nodes_[idx], step_costs_[idx]);
+            }
+            return path;
+        }
+
+        /**
+         * @brief Get the path offsets column - path `q` spans `[offsets[q], offsets[q + 1])` of the node and step cost columns.
+         * @return std::span<const std::size_t> `size() + 1` offsets.
+         */
+        std::span<const std::size_t> get_offsets() const
+        {
+            return offsets_;
+        }
+
+        /**
+         * @brief Get the node column.
+         * @return std::span<const Node<T, D> *const> nodes of every path.
+         */
+        std::span<const Node<T, D> *const> get_nodes() const
+        {
+            return nodes_;
+        }
+
+        /**
+         * @brief Get the step cost column.
+         * @return std::span<const double> step costs of every path.
+         */
+        std::span<const double> get_step_costs() const
+        {
+            return step_costs_;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_SEARCH_BATCH_RESULT_H
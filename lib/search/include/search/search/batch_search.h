@@ -0,0 +1,182 @@
+#ifndef SEARCH_SEARCH_BATCH_SEARCH_H
+#define SEARCH_SEARCH_BATCH_SEARCH_H
+
+/**
+ * @file batch_search.h
+ * @brief Batched multi-query search over indexed environments.
+ */
+
+#include <span>
+#include <atomic>
+#include <thread>
+#include <numeric>
+#include <utils/constants.h>
+#include <search/parallel/parallel_for.h>
+#include <search/search/batch_result.h>
+#include <search/search/ucs.h>
+
+namespace search
+{
+
+    /**
+     * @class BatchSearch
+     * @brief This class answers a batch of start to goal queries at once. Queries are grouped by start node and the groups
+     * are handed out one at a time to `num_threads` threads, each with its own `SearchWorkspace`. For the cost optimal
+     * algorithms (UCS and A*) a group of queries sharing a start runs as a single one-to-many UCS that stops once all of
+     * its goals are settled - paths of equal cost may then differ from the ones found by `Environment::search`. Every other
+     * query runs on its own through `Environment::search`. The environment must not be modified while the batch runs.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     */
+    template <typename T, unsigned int D, typename E>
+        requires(IndexedEnvironment<E, T, D>)
+    class BatchSearch
+    {
+
+        using SearchAlgorithm = utils::SearchAlgorithm;
+
+    private:
+        // Number of threads answering the queries
+        std::size_t num_threads_;
+
+    public:
+        /**
+         * @brief Construct a new BatchSearch object.
+         * @param num_threads number of threads answering the queries - default is the number of hardware threads.
+         */
+        explicit BatchSearch(const std::size_t num_threads = std::thread::hardware_concurrency())
+            : num_threads_(std::max<std::size_t>(num_threads, 1))
+        {
+            PLOGD << "Initializing BatchSearch object with " << num_threads_ << " threads.";
+        }
+
+        /**
+         * @brief Destructor for the BatchSearch class.
+         */
+        ~BatchSearch()
+        {
+            PLOGD << "Destroying BatchSearch object.";
+        }
+
+        /**
+         * @brief Answer a batch of queries.
+         * @param queries start and goal of every query - the nodes must be part of the environment.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc).
+         * @param env The environment in which the search is performed.
+         * @return SearchBatchResult<T, D> path of every query, in query order.
+         */
+        SearchBatchResult<T, D> search(const std::span<const SearchQuery<T, D>> queries,
+                                       const SearchAlgorithm search_algorithm,
+                                       const E &env) const
+        {
+            PLOGD << "Performing batched search of " << queries.size() << " queries.";
+            const bool group_by_start = search_algorithm == SearchAlgorithm::UCS || search_algorithm == SearchAlgorithm::A_STAR;
+            // Resolve the node ids once and sort the queries by start
+            std::vector<std::uint32_t> start_ids(queries.size());
+            std::vector<std::uint32_t> goal_ids(queries.size());
+            for (std::size_t query = 0; query < queries.size(); ++query)
+            {
+                start_ids[query] = env.get_node_id(*queries[query].start_node);
+                goal_ids[query] = env.get_node_id(*queries[query].goal_node);
+            }
+            std::vector<std::size_t> order(queries.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::vector<std::size_t> group_offsets;
+            if (group_by_start)
+            {
+                std::stable_sort(order.begin(), order.end(), [&](const std::size_t a, const std::size_t b)
+                                 { return start_ids[a] < start_ids[b]; });
+                for (std::size_t idx = 0; idx < order.size(); ++idx)
+                {
+                    if (idx == 0 || start_ids[order[idx]] != start_ids[order[idx - 1]])
+                    {
+                        group_offsets.push_back(idx);
+                    }
+                }
+            }
+            else
+            {
+                group_offsets.resize(order.size());
+                std::iota(group_offsets.begin(), group_offsets.end(), 0);
+            }
+            const std::size_t num_groups = group_offsets.size();
+            group_offsets.push_back(order.size());
+            // Hand the groups out one at a time so large groups do not hold up a thread's share
+            std::vector<typename SearchBatchResult<T, D>::Buffer> buffers(std::min(num_threads_, std::max<std::size_t>(num_groups, 1)));
+            std::atomic<std::size_t> next_group = 0;
+            const UCS<T, D, E> ucs;
+            const std::size_t num_chunks = parallel_for(buffers.size(), num_threads_, [&](const std::size_t chunk, const std::size_t, const std::size_t)
+                                                        {
+                typename SearchBatchResult<T, D>::Buffer &buffer = buffers[chunk];
+                SearchWorkspace workspace;
+                std::vector<std::uint32_t> group_goal_ids;
+                for (std::size_t group = next_group.fetch_add(1, std::memory_order_relaxed); group < num_groups;
+                     group = next_group.fetch_add(1, std::memory_order_relaxed))
+                {
+                    const std::size_t begin = group_offsets[group];
+                    const std::size_t end = group_offsets[group + 1];
+                    if (end - begin == 1)
+                    {
+                        const SearchQuery<T, D> &query = queries[order[begin]];
+                        buffer.add(order[begin], env.search(*query.start_node, *query.goal_node, search_algorithm, workspace));
+                        continue;
+                    }
+                    const std::uint32_t start_id = start_ids[order[begin]];
+                    group_goal_ids.clear();
+                    for (std::size_t idx = begin; idx < end; ++idx)
+                    {
+                        group_goal_ids.push_back(goal_ids[order[idx]]);
+                    }
+                    ucs.search_many(start_id, group_goal_ids, env, workspace);
+                    for (std::size_t idx = begin; idx < end; ++idx)
+                    {
+                        buffer.add(order[idx], start_id, goal_ids[order[idx]], workspace, env);
+                    }
+                } },
+                                                        1);
+            return SearchBatchResult<T, D>(queries.size(), std::span<const typename SearchBatchResult<T, D>::Buffer>(buffers.data(), num_chunks));
+        }
+    };
+
+    /**
+     * @class BatchSearchEnvironment
+     * @brief Base class of the indexed environments - it answers `search_batch` with a `BatchSearch` over the derived
+     * environment, so the queries sharing a start run as one one-to-many search.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Derived environment type.
+     * @tparam Concurrent whether the queries may run on several threads - false for the environments whose searches write
+     * to them (see `ImplicitEnvironment`), whose batches run on the calling thread.
+     */
+    template <typename T, unsigned int D, typename E, bool Concurrent = true>
+    class BatchSearchEnvironment : public Environment<T, D>
+    {
+
+        using SearchAlgorithm = utils::SearchAlgorithm;
+
+    public:
+        // Whether several searches may run on the environment at once (see `ConcurrentEnvironment`)
+        static constexpr bool is_concurrent = Concurrent;
+
+        /**
+         * @brief Answer a batch of start to goal queries across `num_threads` threads - the queries sharing a start run as
+         * one one-to-many search (see `BatchSearch`).
+         * @param queries start and goal of every query.
+         * @param search_algorithm The search algorithm to use (DFS, BFS, UCS, A_STAR, etc).
+         * @param num_threads number of threads answering the queries, ignored by non concurrent environments - default is
+         * the number of hardware threads.
+         * @return SearchBatchResult<T, D> path of every query in columnar form, in query order.
+         */
+        SearchBatchResult<T, D> search_batch(
+            const std::span<const SearchQuery<T, D>> queries,
+            SearchAlgorithm search_algorithm,
+            const std::size_t num_threads = std::thread::hardware_concurrency()) const override
+        {
+            return BatchSearch<T, D, E>(ConcurrentEnvironment<E, T, D> ? num_threads : 1).search(queries, search_algorithm, static_cast<const E &>(*this));
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_SEARCH_BATCH_SEARCH_H
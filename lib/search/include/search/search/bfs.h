@@ -0,0 +1,295 @@
+#ifndef SEARCH_BFS_H
+#define SEARCH_BFS_H
+
+/**
+ * @file bfs.h
+ * @brief Breadth-First Search (BFS) algorithm implementation for graph-based environments.
+ */
+
+#include <atomic>
+#include <thread>
+#include <limits>
+#include <algorithm>
+#include <search/search/search.h>
+#include <search/parallel/parallel_for.h>
+
+namespace search
+{
+    /**
+     * @class BFS
+     * @brief This class represents a level synchronous, direction optimizing Breadth-First Search (BFS) algorithm.
+     * Each level is expanded either top-down (frontier nodes claim their unvisited neighbors) or bottom-up (unvisited nodes
+     * look for a parent in the frontier), switching on frontier size as described by Beamer et al. Large levels are split
+     * across threads, except inside a `ParallelRegion` (a batch or asynchronous query) where the cores are already busy;
+     * nodes are claimed atomically through the reached marks of the `SearchWorkspace`. Environments that do
+     * not expose their adjacency as id spans (e.g. implicit grids) are searched with a serial FIFO expansion instead.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     */
+    template <typename T, unsigned int D, typename E>
+        requires(IndexedEnvironment<E, T, D>)
+    class BFS : protected Search<T, D, E>
+    {
+    private:
+        // Sentinel for nodes that have not been reached yet
+        static constexpr std::uint32_t npos_ = std::numeric_limits<std::uint32_t>::max();
+
+        // Number of threads used per level
+        std::size_t num_threads_;
+
+        // Top-down to bottom-up switch factor - switch when frontier edges > unexplored edges / alpha
+        double alpha_;
+
+        // Bottom-up to top-down switch factor - switch back when frontier nodes < nodes / beta
+        double beta_;
+
+        // Cost of the cheapest edge between two adjacent nodes
+        double _get_edge_cost(const std::uint32_t from_id, const std::uint32_t to_id, const E &env) const
+        {
+            double edge_cost = std::numeric_limits<double>::infinity();
+            env.for_each_edge(from_id, [&](const std::uint32_t neighbor_id, const double cost)
+                              {
+                if (neighbor_id == to_id)
+                {
+                    edge_cost = std::min(edge_cost, cost);
+                } });
+            return edge_cost;
+        }
+
+        // Direction optimizing, level synchronous expansion from `start_id` until `goal_id` is reached
+        void _expand_levels(const std::uint32_t start_id,
+                            const std::uint32_t goal_id,
+                            const E &env,
+                            SearchWorkspace &workspace) const
+            requires(AdjacencyEnvironment<E, T, D>)
+        {
+            const std::size_t num_nodes = env.get_num_nodes();
+            std::pmr::vector<std::uint32_t> &frontier = workspace.get_stack();
+            std::vector<std::vector<std::uint32_t>> &next_frontiers = workspace.get_thread_buffers(num_threads_);
+            std::size_t frontier_bitmap_idx = 0;
+            bool bottom_up = false;
+            std::size_t frontier_size = 1;
+            std::size_t frontier_edges = env.get_neighbor_ids(start_id).size();
+            std::size_t unexplored_edges = env.get_num_edges() - frontier_edges;
+            // Levels can be large, so the token is read once per level rather than polled
+            const CancellationToken *token = workspace.get_cancellation_token();
+            frontier.push_back(start_id);
+            workspace.reach(start_id, start_id, 0.0);
+            while (frontier_size > 0 && !workspace.is_reached(goal_id))
+            {
+                if (token != nullptr && token->is_cancelled())
+                {
+                    PLOGD << "BFS search cancelled.";
+                    return;
+                }
+                // Pick the direction for this level
+                if (!bottom_up && frontier_edges > unexplored_edges / alpha_)
+                {
+                    PLOGD << "BFS switching to bottom-up with " << frontier_size << " frontier nodes.";
+                    bottom_up = true;
+                    AtomicBitmap &frontier_bitmap = workspace.get_bitmap(frontier_bitmap_idx);
+                    frontier_bitmap.clear();
+                    for (const std::uint32_t id : frontier)
+                    {
+                        frontier_bitmap.set(id);
+                    }
+                }
+                else if (bottom_up && frontier_size < num_nodes / beta_)
+                {
+                    PLOGD << "BFS switching to top-down with " << frontier_size << " frontier nodes.";
+                    bottom_up = false;
+                    const AtomicBitmap &frontier_bitmap = workspace.get_bitmap(frontier_bitmap_idx);
+                    frontier.clear();
+                    for (std::uint32_t id = 0; id < num_nodes; ++id)
+                    {
+                        if (frontier_bitmap.test(id))
+                        {
+                            frontier.push_back(id);
+                        }
+                    }
+                }
+                std::atomic<std::size_t> next_size = 0;
+                std::atomic<std::size_t> next_edges = 0;
+                if (bottom_up)
+                {
+                    const AtomicBitmap &frontier_bitmap = workspace.get_bitmap(frontier_bitmap_idx);
+                    AtomicBitmap &next_bitmap = workspace.get_bitmap(1 - frontier_bitmap_idx);
+                    next_bitmap.clear();
+                    parallel_for(num_nodes, num_threads_, [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                                        {
+                        std::size_t chunk_size = 0;
+                        std::size_t chunk_edges = 0;
+                        for (std::size_t idx = begin; idx < end; ++idx)
+                        {
+                            const std::uint32_t id = static_cast<std::uint32_t>(idx);
+                            if (workspace.is_reached_atomic(id))
+                            {
+                                continue;
+                            }
+                            for (const std::uint32_t parent_id : env.get_predecessor_ids(id))
+                            {
+                                if (frontier_bitmap.test(parent_id))
+                                {
+                                    workspace.try_reach(id, parent_id);
+                                    next_bitmap.set(id);
+                                    chunk_edges += env.get_neighbor_ids(id).size();
+                                    ++chunk_size;
+                                    break;
+                                }
+                            }
+                        }
+                        next_size += chunk_size;
+                        next_edges += chunk_edges; });
+                    frontier_bitmap_idx = 1 - frontier_bitmap_idx;
+                }
+                else
+                {
+                    const std::size_t num_chunks = parallel_for(frontier.size(), num_threads_, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end)
+                                        {
+                        std::vector<std::uint32_t> &next_frontier = next_frontiers[chunk];
+                        std::size_t chunk_edges = 0;
+                        next_frontier.clear();
+                        for (std::size_t idx = begin; idx < end; ++idx)
+                        {
+                            const std::uint32_t current_id = frontier[idx];
+                            for (const std::uint32_t neighbor_id : env.get_neighbor_ids(current_id))
+                            {
+                                if (workspace.try_reach(neighbor_id, current_id))
+                                {
+                                    next_frontier.push_back(neighbor_id);
+                                    chunk_edges += env.get_neighbor_ids(neighbor_id).size();
+                                }
+                            }
+                        }
+                        next_size += next_frontier.size();
+                        next_edges += chunk_edges; });
+                    frontier.clear();
+                    for (std::size_t chunk = 0; chunk < num_chunks; ++chunk)
+                    {
+                        frontier.insert(frontier.end(), next_frontiers[chunk].begin(), next_frontiers[chunk].end());
+                    }
+                }
+                frontier_size = next_size;
+                frontier_edges = next_edges;
+                unexplored_edges -= std::min(unexplored_edges, frontier_edges);
+            }
+        }
+
+        // Serial FIFO expansion for environments that only expose their edges through `for_each_edge`
+        void _expand_serial(const std::uint32_t start_id,
+                            const std::uint32_t goal_id,
+                            const E &env,
+                            SearchWorkspace &workspace) const
+        {
+            std::pmr::vector<std::uint32_t> &queue = workspace.get_stack();
+            queue.push_back(start_id);
+            workspace.reach(start_id, start_id, 0.0);
+            for (std::size_t head = 0; head < queue.size() && !workspace.is_reached(goal_id); ++head)
+            {
+                if (workspace.is_cancelled())
+                {
+                    PLOGD << "BFS search cancelled.";
+                    return;
+                }
+                const std::uint32_t current_id = queue[head];
+                env.for_each_edge(current_id, [&](const std::uint32_t neighbor_id, const double)
+                                  {
+                    if (!workspace.is_reached(neighbor_id))
+                    {
+                        workspace.reach(neighbor_id, current_id, 0.0);
+                        queue.push_back(neighbor_id);
+                    } });
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new BFS object.
+         * @param num_threads number of threads used to expand large levels - default is the hardware concurrency.
+         * @param alpha top-down to bottom-up switch factor - default is 15.
+         * @param beta bottom-up to top-down switch factor - default is 18.
+         */
+        BFS(const std::size_t num_threads = std::thread::hardware_concurrency(),
+            const double alpha = 15.0,
+            const double beta = 18.0)
+            : num_threads_(std::max<std::size_t>(num_threads, 1)),
+              alpha_(alpha),
+              beta_(beta)
+        {
+            PLOGD << "Initializing BFS object with " << num_threads_ << " threads.";
+        }
+
+        /**
+         * @brief Destructor for the BFS class.
+         */
+        ~BFS()
+        {
+            PLOGD << "Destroying BFS object.";
+        }
+
+        /**
+         * @brief Perform BFS search on graph based environment and return the path with the fewest edges from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, env, workspace);
+        }
+
+        /**
+         * @brief Perform BFS search on graph based environment reusing the scratch memory of `workspace`.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing BFS search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            const std::uint32_t start_id = env.get_node_id(start_node);
+            const std::uint32_t goal_id = env.get_node_id(goal_node);
+            workspace.begin(env.get_num_nodes());
+            if constexpr (AdjacencyEnvironment<E, T, D>)
+            {
+                this->_expand_levels(start_id, goal_id, env, workspace);
+            }
+            else
+            {
+                this->_expand_serial(start_id, goal_id, env, workspace);
+            }
+            if (!workspace.is_reached(goal_id))
+            {
+                return {};
+            }
+            // Walk the parents back from the goal and accumulate the step costs on the way out
+            std::pmr::vector<std::uint32_t> &path_ids = workspace.get_stack();
+            path_ids.clear();
+            for (std::uint32_t id = goal_id; id != start_id; id = workspace.get_parent(id))
+            {
+                path_ids.push_back(id);
+            }
+            for (std::size_t idx = path_ids.size(); idx-- > 0;)
+            {
+                const std::uint32_t parent_id = workspace.get_parent(path_ids[idx]);
+                workspace.set_cost(path_ids[idx], workspace.get_cost(parent_id) + this->_get_edge_cost(parent_id, path_ids[idx], env));
+            }
+            return this->get_path(start_id, goal_id, workspace, env);
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_BFS_H
@@ -0,0 +1,141 @@
+#ifndef SEARCH_SEARCH_CANCELLATION_H
+#define SEARCH_SEARCH_CANCELLATION_H
+
+/**
+ * @file cancellation.h
+ * @brief Cooperative cancellation token with an optional deadline for the search algorithms.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace search
+{
+
+    /**
+     * @class CancellationToken
+     * @brief This class tells running searches to stop: a search polls the token handed to it (through its `SearchWorkspace`)
+     * while it expands nodes and gives up once the token is cancelled or its deadline has passed. Cancellation is cooperative
+     * - a search stops at its next poll and not at once - and the token can be cancelled from any thread. Plain searches
+     * return an empty path when they give up, anytime searches (see `AraStar`) the best path found so far. A token stays
+     * cancelled until `reset` is called.
+     */
+    class CancellationToken
+    {
+
+    public:
+        // Clock of the deadlines
+        using Clock = std::chrono::steady_clock;
+
+    private:
+        // Deadline value of tokens without a deadline
+        static constexpr Clock::rep no_deadline_ = std::numeric_limits<Clock::rep>::max();
+
+        // Whether `cancel` was called
+        std::atomic<bool> cancelled_ = false;
+
+        // Deadline as a number of clock ticks since the clock epoch
+        std::atomic<Clock::rep> deadline_ = no_deadline_;
+
+    public:
+        /**
+         * @brief Construct a new CancellationToken object without a deadline.
+         */
+        CancellationToken() = default;
+
+        /**
+         * @brief Construct a new CancellationToken object that expires at `deadline`.
+         * @param deadline point in time after which searches stop.
+         */
+        explicit CancellationToken(const Clock::time_point deadline)
+            : deadline_(deadline.time_since_epoch().count())
+        {
+        }
+
+        /**
+         * @brief Construct a new CancellationToken object that expires `timeout` from now.
+         * @param timeout time budget of the searches.
+         */
+        template <typename R, typename P>
+        explicit CancellationToken(const std::chrono::duration<R, P> timeout)
+            : CancellationToken(Clock::now() + std::chrono::duration_cast<Clock::duration>(timeout))
+        {
+        }
+
+        CancellationToken(const CancellationToken &) = delete;
+        CancellationToken &operator=(const CancellationToken &) = delete;
+
+        /**
+         * @brief Cancel the searches polling the token.
+         */
+        void cancel()
+        {
+            cancelled_.store(true, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Set the point in time after which searches stop.
+         * @param deadline deadline.
+         */
+        void set_deadline(const Clock::time_point deadline)
+        {
+            deadline_.store(deadline.time_since_epoch().count(), std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Set the deadline `timeout` from now.
+         * @param timeout time budget of the searches.
+         */
+        template <typename R, typename P>
+        void set_timeout(const std::chrono::duration<R, P> timeout)
+        {
+            this->set_deadline(Clock::now() + std::chrono::duration_cast<Clock::duration>(timeout));
+        }
+
+        /**
+         * @brief Clear the cancellation and the deadline so the token can be reused.
+         */
+        void reset()
+        {
+            cancelled_.store(false, std::memory_order_relaxed);
+            deadline_.store(no_deadline_, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Check whether the token has a deadline.
+         * @return true if a deadline is set, false otherwise.
+         */
+        bool has_deadline() const
+        {
+            return deadline_.load(std::memory_order_relaxed) != no_deadline_;
+        }
+
+        /**
+         * @brief Get the deadline - the largest time point when none is set.
+         * @return Clock::time_point deadline.
+         */
+        Clock::time_point get_deadline() const
+        {
+            return Clock::time_point(Clock::duration(deadline_.load(std::memory_order_relaxed)));
+        }
+
+        /**
+         * @brief Check whether searches should stop - the token was cancelled or its deadline has passed. Only reads the
+         * clock when a deadline is set.
+         * @return true if the token is cancelled or expired, false otherwise.
+         */
+        bool is_cancelled() const
+        {
+            if (cancelled_.load(std::memory_order_relaxed))
+            {
+                return true;
+            }
+            const Clock::rep deadline = deadline_.load(std::memory_order_relaxed);
+            return deadline != no_deadline_ && Clock::now().time_since_epoch().count() >= deadline;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_SEARCH_CANCELLATION_H
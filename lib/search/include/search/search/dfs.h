@@ -6,8 +6,10 @@
  * @brief Depth-First Search (DFS) algorithm implementation for graph-based environments.
  */
 
-#include <queue>
+#include <vector>
 #include <unordered_set>
+#include <unordered_map>
+#include <memory_resource>
 #include <search/search/search.h>
 
 namespace search
@@ -52,36 +54,104 @@ namespace search
             const Node<T, D> &goal_node,
             const E &env) const override
         {
-            PLOGD << "Performing DFS search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
-            std::unordered_set<const Node<T, D> *> visited_nodes;
-            std::unordered_map<const Node<T, D> *, std::pair<const Node<T, D> *, double>> parent_cost_map;
-            std::deque<const Node<T, D> *> stack = {&start_node};
-            while (!stack.empty())
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, env, workspace);
+        }
+
+        /**
+         * @brief Perform DFS search on graph based environment reusing the scratch memory of `workspace`. Environments without
+         * node ids are searched over the node neighbor lists with containers allocated from the workspace memory resource.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env,
+            SearchWorkspace &workspace) const override
+        {
+            if constexpr (!IndexedEnvironment<E, T, D>)
             {
-                const Node<T, D> *current_node = stack.back();
-                double cost = parent_cost_map[current_node].second;
-                if (*current_node == goal_node)
+                PLOGD << "Performing DFS search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+                std::pmr::memory_resource *resource = workspace.get_memory_resource();
+                std::pmr::unordered_set<const Node<T, D> *> visited_nodes(resource);
+                std::pmr::unordered_map<const Node<T, D> *, std::pair<const Node<T, D> *, double>> parent_cost_map(resource);
+                std::pmr::vector<const Node<T, D> *> stack({&start_node}, resource);
+                while (!stack.empty())
                 {
-                    return this->get_path(start_node, goal_node, parent_cost_map);
-                }
-                stack.pop_back();
-                if (visited_nodes.find(current_node) == visited_nodes.end())
-                {
-                    visited_nodes.insert(current_node);
-                    for (const Node<T, D> *neighbor : current_node->get_neighbors())
+                    if (workspace.is_cancelled())
                     {
-                        if (visited_nodes.find(neighbor) == visited_nodes.end())
+                        PLOGD << "DFS search cancelled.";
+                        return {};
+                    }
+                    const Node<T, D> *current_node = stack.back();
+                    double cost = parent_cost_map[current_node].second;
+                    if (*current_node == goal_node)
+                    {
+                        return this->get_path(start_node, goal_node, parent_cost_map);
+                    }
+                    stack.pop_back();
+                    if (visited_nodes.find(current_node) == visited_nodes.end())
+                    {
+                        visited_nodes.insert(current_node);
+                        for (const Node<T, D> *neighbor : current_node->get_neighbors())
                         {
-                            stack.push_back(neighbor);
-                            if (parent_cost_map.find(neighbor) == parent_cost_map.end())
+                            if (visited_nodes.find(neighbor) == visited_nodes.end())
                             {
-                                parent_cost_map[neighbor] = std::make_pair(current_node, cost + env.get_cost(*current_node, *neighbor));
+                                stack.push_back(neighbor);
+                                if (parent_cost_map.find(neighbor) == parent_cost_map.end())
+                                {
+                                    parent_cost_map[neighbor] = std::make_pair(current_node, cost + env.get_cost(*current_node, *neighbor));
+                                }
                             }
                         }
                     }
                 }
+                return {};
+            }
+            else
+            {
+                PLOGD << "Performing DFS search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+                const std::uint32_t start_id = env.get_node_id(start_node);
+                const std::uint32_t goal_id = env.get_node_id(goal_node);
+                workspace.begin(env.get_num_nodes());
+                std::pmr::vector<std::uint32_t> &stack = workspace.get_stack();
+                stack.push_back(start_id);
+                workspace.reach(start_id, start_id, 0.0);
+                while (!stack.empty())
+                {
+                    if (workspace.is_cancelled())
+                    {
+                        PLOGD << "DFS search cancelled.";
+                        return {};
+                    }
+                    const std::uint32_t current_id = stack.back();
+                    if (current_id == goal_id)
+                    {
+                        return this->get_path(start_id, goal_id, workspace, env);
+                    }
+                    stack.pop_back();
+                    if (!workspace.is_closed(current_id))
+                    {
+                        workspace.close(current_id);
+                        const double cost = workspace.get_cost(current_id);
+                        env.for_each_edge(current_id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                          {
+                            if (!workspace.is_closed(neighbor_id))
+                            {
+                                stack.push_back(neighbor_id);
+                                if (!workspace.is_reached(neighbor_id))
+                                {
+                                    workspace.reach(neighbor_id, current_id, cost + edge_cost);
+                                }
+                            } });
+                    }
+                }
+                return {};
             }
-            return {};
         }
     };
 
@@ -0,0 +1,291 @@
+#ifndef SEARCH_IDA_STAR_H
+#define SEARCH_IDA_STAR_H
+
+/**
+ * @file ida_star.h
+ * @brief Iterative Deepening A* (IDA*) memory-bounded search algorithm implementation for graph-based environments.
+ */
+
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <search/search/search.h>
+#include <search/heuristic/distance_heuristic.h>
+
+namespace search
+{
+    /**
+     * @class IdaStar
+     * @brief This class represents the Iterative Deepening A* (IDA*) algorithm: a series of depth-first searches, each cut
+     * off at nodes whose `g + h` exceeds a bound that starts at `h(start)` and rises to the smallest cut off value after
+     * every iteration. Only the current path and the successors of its nodes are held, so memory grows with the path length
+     * rather than with the number of nodes reached - nodes are expanded again instead, by every iteration and every path
+     * that reaches them. Successors already on the current path are skipped. The memory limit caps the bytes held by the
+     * path and its successors: nodes that would exceed it are not expanded, and an empty path is returned when no path fits.
+     * With an admissible heuristic the path is optimal, unless the memory limit cut off nodes in an iteration before the one
+     * that found it - a cheaper path may run through them, so `is_memory_limited` reports it. Edge costs must be non negative. The statistics describe the last
+     * search, so an object must not run searches from several threads at once.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     * @tparam H Heuristic type - default is the Euclidean distance heuristic.
+     */
+    template <typename T, unsigned int D, typename E, typename H = EuclideanHeuristic<T, D>>
+        requires(IndexedEnvironment<E, T, D> && Heuristic<H, T, D>)
+    class IdaStar : protected Search<T, D, E>
+    {
+    private:
+        // Successor of a node of the current path
+        struct Successor
+        {
+            std::uint32_t id; // Node id
+            double cost;      // Cost to reach the node
+            double f;         // Cost plus heuristic
+        };
+
+        // Node of the current path
+        struct Frame
+        {
+            std::uint32_t id;  // Node id
+            double cost;       // Cost to reach the node
+            std::size_t begin; // First of its successors
+            std::size_t next;  // Next successor to visit
+        };
+
+        // Heuristic policy
+        H heuristic_;
+
+        // Largest number of bytes held by the path and its successors
+        std::size_t memory_limit_;
+
+        // Number of iterations of the last search
+        mutable std::size_t num_iterations_ = 0;
+
+        // Number of nodes expanded by the last search
+        mutable std::size_t num_expansions_ = 0;
+
+        // Number of expansions of the last search that an earlier iteration had already done
+        mutable std::size_t num_reexpansions_ = 0;
+
+        // Whether the memory limit cut off nodes in an iteration of the last search that did not find the goal
+        mutable bool memory_limited_ = false;
+
+    public:
+        /**
+         * @brief Construct a new IdaStar object.
+         * @param heuristic heuristic policy - default constructed by default.
+         * @param memory_limit largest number of bytes held by the path and its successors - default is 64 MiB.
+         */
+        IdaStar(const H &heuristic = H(),
+                const std::size_t memory_limit = 64 * 1024 * 1024)
+            : heuristic_(heuristic),
+              memory_limit_(memory_limit)
+        {
+            PLOGD << "Initializing IdaStar object with a memory limit of " << memory_limit_ << " bytes.";
+            if (memory_limit_ < sizeof(Frame))
+            {
+                PLOGE << "IdaStar memory limit of " << memory_limit_ << " bytes can not hold a single node";
+                throw std::invalid_argument("IdaStar memory limit must hold at least one node");
+            }
+        }
+
+        /**
+         * @brief Destructor for the IdaStar class.
+         */
+        ~IdaStar()
+        {
+            PLOGD << "Destroying IdaStar object.";
+        }
+
+        /**
+         * @brief Perform IDA* search on graph based environment and return a path from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, env, workspace);
+        }
+
+        /**
+         * @brief Perform IDA* search on graph based environment and poll the cancellation token of `workspace`. The search
+         * keeps no per node state, so the workspace is not sized to the graph.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @param workspace Workspace whose cancellation token is polled (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing IDA* search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            const std::uint32_t start_id = env.get_node_id(start_node);
+            const std::uint32_t goal_id = env.get_node_id(goal_node);
+            const NodeValue<T, D> goal_value = env.get_node_value(goal_id);
+            num_iterations_ = 0;
+            num_expansions_ = 0;
+            num_reexpansions_ = 0;
+            memory_limited_ = false;
+            std::vector<Frame> frames;
+            std::vector<Successor> successors;
+            const double start_f = heuristic_.get_heuristic(env.get_node_value(start_id), goal_value);
+            double previous_bound = -std::numeric_limits<double>::infinity();
+            double bound = start_f;
+            double next_bound = std::numeric_limits<double>::infinity();
+            bool cut_off = false;
+
+            // Put a node on the path and generate its successors - true when the node is the goal
+            const auto enter = [&](const std::uint32_t id, const double cost, const double f)
+            {
+                if (f > bound)
+                {
+                    next_bound = std::min(next_bound, f);
+                    return false;
+                }
+                if (id == goal_id)
+                {
+                    frames.push_back({id, cost, successors.size(), successors.size()});
+                    return true;
+                }
+                const std::size_t begin = successors.size();
+                env.for_each_edge(id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                  {
+                    if (edge_cost < 0.0)
+                    {
+                        PLOGE << "IDA* found a negative edge cost: " << edge_cost;
+                        throw std::invalid_argument("IDA* requires non negative edge costs");
+                    }
+                    if (neighbor_id == id || std::any_of(frames.begin(), frames.end(), [&](const Frame &frame)
+                                                         { return frame.id == neighbor_id; }))
+                    {
+                        return;
+                    }
+                    const double neighbor_cost = cost + edge_cost;
+                    successors.push_back({neighbor_id, neighbor_cost, neighbor_cost + heuristic_.get_heuristic(env.get_node_value(neighbor_id), goal_value)}); });
+                if ((frames.size() + 1) * sizeof(Frame) + successors.size() * sizeof(Successor) > memory_limit_)
+                {
+                    // Cut off by the memory limit - not part of any bound, so later iterations may miss cheaper paths
+                    successors.resize(begin);
+                    cut_off = true;
+                    return false;
+                }
+                ++num_expansions_;
+                num_reexpansions_ += f <= previous_bound;
+                // Most promising successors first, so the last iteration finds the goal early
+                std::sort(successors.begin() + static_cast<std::ptrdiff_t>(begin), successors.end(), [](const Successor &a, const Successor &b)
+                          { return a.f < b.f; });
+                frames.push_back({id, cost, begin, begin});
+                return false;
+            };
+
+            while (bound != std::numeric_limits<double>::infinity())
+            {
+                ++num_iterations_;
+                PLOGD << "IDA* iteration " << num_iterations_ << " with bound " << bound;
+                frames.clear();
+                successors.clear();
+                next_bound = std::numeric_limits<double>::infinity();
+                cut_off = false;
+                bool found = enter(start_id, 0.0, start_f);
+                while (!found && !frames.empty())
+                {
+                    if (workspace.is_cancelled())
+                    {
+                        PLOGD << "IDA* search cancelled.";
+                        return {};
+                    }
+                    Frame &top = frames.back();
+                    if (top.next == successors.size())
+                    {
+                        successors.resize(top.begin);
+                        frames.pop_back();
+                        continue;
+                    }
+                    const Successor successor = successors[top.next++];
+                    found = enter(successor.id, successor.cost, successor.f);
+                }
+                if (found)
+                {
+                    PLOGD << "IDA* expanded " << num_expansions_ << " nodes, " << num_reexpansions_ << " of them again, in " << num_iterations_ << " iterations.";
+                    if (memory_limited_)
+                    {
+                        PLOGW << "IDA* path may not be optimal - the memory limit cut off nodes in an earlier iteration";
+                    }
+                    std::vector<std::pair<const Node<T, D> *, double>> path;
+                    path.reserve(frames.size());
+                    for (const Frame &frame : frames)
+                    {
+                        path.emplace_back(env.get_node(frame.id), frame.cost);
+                    }
+                    return path;
+                }
+                memory_limited_ = memory_limited_ || cut_off;
+                previous_bound = bound;
+                bound = next_bound;
+            }
+            PLOGD << "IDA* found no path after " << num_iterations_ << " iterations.";
+            return {};
+        }
+
+        /**
+         * @brief Get the memory limit.
+         * @return std::size_t largest number of bytes held by the path and its successors.
+         */
+        std::size_t get_memory_limit() const
+        {
+            return memory_limit_;
+        }
+
+        /**
+         * @brief Check whether the memory limit cut off nodes in an iteration of the last search that did not find the goal.
+         * The path of the last search is then not guaranteed optimal, and an empty path does not prove the goal unreachable.
+         * @return true if the last search was limited by memory, false otherwise.
+         */
+        bool is_memory_limited() const
+        {
+            return memory_limited_;
+        }
+
+        /**
+         * @brief Get the number of iterations of the last search.
+         * @return std::size_t number of iterations.
+         */
+        std::size_t get_num_iterations() const
+        {
+            return num_iterations_;
+        }
+
+        /**
+         * @brief Get the number of nodes expanded by the last search, counting every expansion.
+         * @return std::size_t number of expansions.
+         */
+        std::size_t get_num_expansions() const
+        {
+            return num_expansions_;
+        }
+
+        /**
+         * @brief Get the number of expansions of the last search that repeat an expansion of an earlier iteration - the
+         * nodes within the previous bound.
+         * @return std::size_t number of re-expansions.
+         */
+        std::size_t get_num_reexpansions() const
+        {
+            return num_reexpansions_;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_IDA_STAR_H
@@ -0,0 +1,324 @@
+#ifndef SEARCH_JPS_H
+#define SEARCH_JPS_H
+
+/**
+ * @file jps.h
+ * @brief Jump Point Search (JPS) algorithm implementation for 2D grid environments.
+ */
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <optional>
+#include <algorithm>
+#include <search/search/search.h>
+
+namespace search
+{
+    /**
+     * @class JPS
+     * @brief This class represents the Jump Point Search (JPS) algorithm for 8-connected 2D grids where diagonal moves may not
+     * cut blocked corners (see `GridEnvironment`). It is A* with the octile distance heuristic where, instead of pushing
+     * every neighbor, a node only pushes the jump points found by scanning straight and diagonally away from it - cells
+     * reachable as cheaply some other way are pruned, which removes most of the symmetric expansions of open areas. The
+     * returned path lists every cell, as for the other algorithms. Moves cost 1 along an axis and sqrt(2) diagonally.
+     * @tparam T Type.
+     * @tparam D Dimension - must be 2.
+     * @tparam E Environment type - a 2D grid environment exposing `is_free`, `get_id`, `get_coordinates` and `allows_diagonal`.
+     */
+    template <typename T, unsigned int D, typename E>
+        requires(IndexedEnvironment<E, T, D> && D == 2)
+    class JPS : protected Search<T, D, E>
+    {
+    private:
+        // Signed cell coordinates
+        using Point = std::array<std::int64_t, 2>;
+
+        // Cost of a diagonal move
+        inline static const double diagonal_cost_ = std::sqrt(2.0);
+
+        // Octile distance between two cells
+        static double _get_octile_distance(const Point &from, const Point &to)
+        {
+            const std::int64_t dx = std::abs(to[0] - from[0]);
+            const std::int64_t dy = std::abs(to[1] - from[1]);
+            return static_cast<double>(std::max(dx, dy) - std::min(dx, dy)) + diagonal_cost_ * static_cast<double>(std::min(dx, dy));
+        }
+
+        // Get the signed coordinates of a cell
+        static Point _get_point(const std::uint32_t id, const E &env)
+        {
+            const auto coordinates = env.get_coordinates(id);
+            return {static_cast<std::int64_t>(coordinates[0]), static_cast<std::int64_t>(coordinates[1])};
+        }
+
+        // Check whether a cell exists and is free
+        static bool _is_free(const std::int64_t x, const std::int64_t y, const E &env)
+        {
+            return env.is_free({x, y});
+        }
+
+        // Scan from `(x, y)` in direction `(dx, dy)` and return the first jump point - the goal, a cell with a forced
+        // neighbor or, diagonally, a cell from which a straight scan finds a jump point
+        static std::optional<Point> _jump(std::int64_t x, std::int64_t y, const std::int64_t dx, const std::int64_t dy, const Point &goal, const E &env)
+        {
+            while (_is_free(x, y, env))
+            {
+                if (x == goal[0] && y == goal[1])
+                {
+                    return Point{x, y};
+                }
+                if (dx != 0 && dy != 0)
+                {
+                    if (_jump(x + dx, y, dx, 0, goal, env) || _jump(x, y + dy, 0, dy, goal, env))
+                    {
+                        return Point{x, y};
+                    }
+                    // Diagonal moves may not cut corners
+                    if (!_is_free(x + dx, y, env) || !_is_free(x, y + dy, env))
+                    {
+                        return std::nullopt;
+                    }
+                }
+                else if (dx != 0)
+                {
+                    if ((_is_free(x, y - 1, env) && !_is_free(x - dx, y - 1, env)) ||
+                        (_is_free(x, y + 1, env) && !_is_free(x - dx, y + 1, env)))
+                    {
+                        return Point{x, y};
+                    }
+                }
+                else
+                {
+                    if ((_is_free(x - 1, y, env) && !_is_free(x - 1, y - dy, env)) ||
+                        (_is_free(x + 1, y, env) && !_is_free(x + 1, y - dy, env)))
+                    {
+                        return Point{x, y};
+                    }
+                }
+                x += dx;
+                y += dy;
+            }
+            return std::nullopt;
+        }
+
+        // Collect the directions worth scanning from `point` reached in direction `(dx, dy)` - every move for the start
+        template <typename F>
+        static void _for_each_direction(const Point &point, const std::int64_t dx, const std::int64_t dy, const E &env, F &&visit)
+        {
+            const auto [x, y] = point;
+            if (dx == 0 && dy == 0)
+            {
+                env.for_each_edge(env.get_id({static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y)}), [&](const std::uint32_t neighbor_id, const double)
+                                  {
+                    const Point neighbor = _get_point(neighbor_id, env);
+                    visit(neighbor[0] - x, neighbor[1] - y); });
+                return;
+            }
+            if (dx != 0 && dy != 0)
+            {
+                const bool vertical_free = _is_free(x, y + dy, env);
+                const bool horizontal_free = _is_free(x + dx, y, env);
+                if (vertical_free)
+                {
+                    visit(0, dy);
+                }
+                if (horizontal_free)
+                {
+                    visit(dx, 0);
+                }
+                if (vertical_free && horizontal_free)
+                {
+                    visit(dx, dy);
+                }
+            }
+            else if (dx != 0)
+            {
+                const bool next_free = _is_free(x + dx, y, env);
+                const bool up_free = _is_free(x, y + 1, env);
+                const bool down_free = _is_free(x, y - 1, env);
+                if (next_free)
+                {
+                    visit(dx, 0);
+                    if (up_free)
+                    {
+                        visit(dx, 1);
+                    }
+                    if (down_free)
+                    {
+                        visit(dx, -1);
+                    }
+                }
+                if (up_free)
+                {
+                    visit(0, 1);
+                }
+                if (down_free)
+                {
+                    visit(0, -1);
+                }
+            }
+            else
+            {
+                const bool next_free = _is_free(x, y + dy, env);
+                const bool right_free = _is_free(x + 1, y, env);
+                const bool left_free = _is_free(x - 1, y, env);
+                if (next_free)
+                {
+                    visit(0, dy);
+                    if (right_free)
+                    {
+                        visit(1, dy);
+                    }
+                    if (left_free)
+                    {
+                        visit(-1, dy);
+                    }
+                }
+                if (right_free)
+                {
+                    visit(1, 0);
+                }
+                if (left_free)
+                {
+                    visit(-1, 0);
+                }
+            }
+        }
+
+        // Expand the jump point path held by the workspace into a path through every cell
+        const std::vector<std::pair<const Node<T, D> *, double>> _get_cell_path(const std::uint32_t start_id,
+                                                                                const std::uint32_t goal_id,
+                                                                                const SearchWorkspace &workspace,
+                                                                                const E &env) const
+        {
+            std::vector<std::pair<const Node<T, D> *, double>> path;
+            for (std::uint32_t id = goal_id; id != start_id; id = workspace.get_parent(id))
+            {
+                const Point to = _get_point(id, env);
+                const Point from = _get_point(workspace.get_parent(id), env);
+                const std::int64_t dx = (to[0] > from[0]) - (to[0] < from[0]);
+                const std::int64_t dy = (to[1] > from[1]) - (to[1] < from[1]);
+                const double step_cost = dx != 0 && dy != 0 ? diagonal_cost_ : 1.0;
+                double cost = workspace.get_cost(id);
+                for (Point point = to; point != from; point[0] -= dx, point[1] -= dy)
+                {
+                    path.emplace_back(env.get_node(env.get_id({static_cast<std::uint32_t>(point[0]), static_cast<std::uint32_t>(point[1])})), cost);
+                    cost -= step_cost;
+                }
+            }
+            path.emplace_back(env.get_node(start_id), 0.0); // Add the starting node with cost 0
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+    public:
+        /**
+         * @brief Construct a new JPS object.
+         */
+        JPS()
+        {
+            PLOGD << "Initializing JPS object.";
+        }
+
+        /**
+         * @brief Destructor for the JPS class.
+         */
+        ~JPS()
+        {
+            PLOGD << "Destroying JPS object.";
+        }
+
+        /**
+         * @brief Perform JPS search on a grid environment and return a path from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, env, workspace);
+        }
+
+        /**
+         * @brief Perform JPS search on a grid environment reusing the scratch memory of `workspace`.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing JPS search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            if (!env.allows_diagonal())
+            {
+                PLOGE << "JPS requires a grid with diagonal moves.";
+                throw std::invalid_argument("JPS requires a grid with diagonal moves");
+            }
+            const std::uint32_t start_id = env.get_node_id(start_node);
+            const std::uint32_t goal_id = env.get_node_id(goal_node);
+            const Point goal = _get_point(goal_id, env);
+            workspace.begin(env.get_num_nodes());
+            if (start_id != goal_id && (env.is_blocked(start_id) || env.is_blocked(goal_id)))
+            {
+                return {};
+            }
+            IndexedDaryHeap<double> &frontier = workspace.get_heap();
+            workspace.reach(start_id, start_id, 0.0);
+            frontier.push(start_id, _get_octile_distance(_get_point(start_id, env), goal));
+            while (!frontier.empty())
+            {
+                if (workspace.is_cancelled())
+                {
+                    PLOGD << "JPS search cancelled.";
+                    return {};
+                }
+                const std::uint32_t current_id = frontier.pop().second;
+                if (current_id == goal_id)
+                {
+                    return this->_get_cell_path(start_id, goal_id, workspace, env);
+                }
+                workspace.close(current_id);
+                const Point current = _get_point(current_id, env);
+                const double cost = workspace.get_cost(current_id);
+                std::int64_t dx = 0;
+                std::int64_t dy = 0;
+                if (current_id != start_id)
+                {
+                    const Point parent = _get_point(workspace.get_parent(current_id), env);
+                    dx = (current[0] > parent[0]) - (current[0] < parent[0]);
+                    dy = (current[1] > parent[1]) - (current[1] < parent[1]);
+                }
+                _for_each_direction(current, dx, dy, env, [&](const std::int64_t step_x, const std::int64_t step_y)
+                                    {
+                    const std::optional<Point> jump_point = _jump(current[0] + step_x, current[1] + step_y, step_x, step_y, goal, env);
+                    if (!jump_point)
+                    {
+                        return;
+                    }
+                    const std::uint32_t jump_id = env.get_id({static_cast<std::uint32_t>((*jump_point)[0]), static_cast<std::uint32_t>((*jump_point)[1])});
+                    const double new_cost = cost + _get_octile_distance(current, *jump_point);
+                    if (!workspace.is_closed(jump_id) && new_cost < workspace.get_cost(jump_id))
+                    {
+                        workspace.reach(jump_id, current_id, new_cost);
+                        frontier.push_or_decrease(jump_id, new_cost + _get_octile_distance(*jump_point, goal));
+                    } });
+            }
+            return {};
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_JPS_H
@@ -0,0 +1,330 @@
+#ifndef SEARCH_LPA_STAR_H
+#define SEARCH_LPA_STAR_H
+
+/**
+ * @file lpa_star.h
+ * @brief Lifelong Planning A* (LPA*) incremental search algorithm implementation for graph-based environments.
+ */
+
+#include <limits>
+#include <compare>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <plog/Log.h>
+#include <search/node/node.h>
+#include <search/environment/environment.h>
+#include <search/container/indexed_heap.h>
+#include <search/search/cancellation.h>
+#include <search/heuristic/distance_heuristic.h>
+
+namespace search
+{
+    /**
+     * @class LpaStar
+     * @brief This class represents the Lifelong Planning A* (LPA*) algorithm for repeated searches between a fixed start and
+     * goal while edges are added, removed or change cost. The first `search` costs about as much as A*; afterwards every
+     * edge change reported with `notify_edge_change` only marks its target inconsistent, and the next `search` repairs the
+     * previous solution by expanding just the nodes whose cost actually changed. Unlike the other algorithms the object
+     * keeps per query state, so it is bound to one environment, start and goal and must outlive the changes it tracks.
+     * A search stopped by a `CancellationToken` leaves the remaining repair to the next `search`.
+     * The heuristic must be consistent and edge costs must be non negative - zero cost edges, cycles and self loops are
+     * fine, ties between equally cheap paths go to the one with fewer edges.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     * @tparam H Heuristic type - default is the Euclidean distance heuristic.
+     */
+    template <typename T, unsigned int D, typename E, typename H = EuclideanHeuristic<T, D>>
+        requires(AdjacencyEnvironment<E, T, D> && Heuristic<H, T, D>)
+    class LpaStar
+    {
+
+        // Cost of a path - its total edge cost, ties broken by its number of edges. Every edge then strictly increases the
+        // cost of a path, so zero cost cycles can not hold up each other's stale costs after an edge cost increase and the
+        // walk back from the goal always ends at the start
+        struct PathCost
+        {
+            double cost;
+            std::uint32_t num_edges;
+
+            friend auto operator<=>(const PathCost &, const PathCost &) = default;
+        };
+
+        // Priority of an inconsistent node - `(min(g, rhs) + h, min(g, rhs))` compared lexicographically
+        using Key = std::pair<double, PathCost>;
+
+        // Cost of an unreachable node
+        static constexpr PathCost unreachable = {std::numeric_limits<double>::infinity(), std::numeric_limits<std::uint32_t>::max()};
+
+    private:
+        // Environment the search runs in
+        const E *env_;
+
+        // Heuristic policy
+        H heuristic_;
+
+        // Start node id
+        std::uint32_t start_id_;
+
+        // Goal node id
+        std::uint32_t goal_id_;
+
+        // Cost of every node as of its last expansion
+        std::vector<PathCost> g_;
+
+        // One step lookahead cost of every node - the best `g` of a predecessor plus the edge cost
+        std::vector<PathCost> rhs_;
+
+        // Inconsistent nodes (g != rhs)
+        IndexedDaryHeap<Key> open_;
+
+        // Number of nodes expanded by the last search
+        std::size_t num_expansions_ = 0;
+
+        // Get the heuristic of a node towards the goal
+        double _get_heuristic(const std::uint32_t id) const
+        {
+            return heuristic_.get_heuristic(env_->get_node_value(id), env_->get_node_value(goal_id_));
+        }
+
+        // Get the priority of a node
+        Key _get_key(const std::uint32_t id) const
+        {
+            const PathCost cost = std::min(g_[id], rhs_[id]);
+            return {cost.cost + _get_heuristic(id), cost};
+        }
+
+        // Get the cost of a path extended by one edge
+        static PathCost _extend(const PathCost &cost, const double edge_cost)
+        {
+            return {cost.cost + edge_cost, cost.num_edges + 1};
+        }
+
+        // Get the cheapest edge cost from `from_id` to `to_id` - infinity when there is no edge
+        double _get_edge_cost(const std::uint32_t from_id, const std::uint32_t to_id) const
+        {
+            double edge_cost = std::numeric_limits<double>::infinity();
+            env_->for_each_edge(from_id, [&](const std::uint32_t neighbor_id, const double cost)
+                                {
+                if (neighbor_id == to_id)
+                {
+                    if (cost < 0.0)
+                    {
+                        PLOGE << "LPA* found a negative edge cost: " << cost;
+                        throw std::invalid_argument("LPA* requires non negative edge costs");
+                    }
+                    edge_cost = std::min(edge_cost, cost);
+                } });
+            return edge_cost;
+        }
+
+        // Recompute the lookahead cost of a node from its predecessors
+        void _update_rhs(const std::uint32_t id)
+        {
+            if (id == start_id_)
+            {
+                return;
+            }
+            PathCost rhs = unreachable;
+            for (const std::uint32_t predecessor_id : env_->get_predecessor_ids(id))
+            {
+                if (g_[predecessor_id] < rhs)
+                {
+                    rhs = std::min(rhs, _extend(g_[predecessor_id], this->_get_edge_cost(predecessor_id, id)));
+                }
+            }
+            rhs_[id] = rhs;
+        }
+
+        // Put a node in the open list when it is inconsistent and take it out otherwise
+        void _update_node(const std::uint32_t id)
+        {
+            open_.erase(id);
+            if (g_[id] != rhs_[id])
+            {
+                open_.push(id, this->_get_key(id));
+            }
+        }
+
+        // Expand inconsistent nodes until the goal is consistent and no open node can lower its cost - false when the token
+        // stopped the expansion first
+        bool _compute_shortest_path(const CancellationToken *token)
+        {
+            num_expansions_ = 0;
+            while (!open_.empty() && (open_.top().first < this->_get_key(goal_id_) || rhs_[goal_id_] != g_[goal_id_]))
+            {
+                if (token != nullptr && num_expansions_ % 64 == 0 && token->is_cancelled())
+                {
+                    return false;
+                }
+                const std::uint32_t current_id = open_.pop().second;
+                ++num_expansions_;
+                if (g_[current_id] > rhs_[current_id])
+                {
+                    // Over consistent - settle the node and relax its out edges
+                    g_[current_id] = rhs_[current_id];
+                    env_->for_each_edge(current_id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                        {
+                        if (edge_cost < 0.0)
+                        {
+                            PLOGE << "LPA* found a negative edge cost: " << edge_cost;
+                            throw std::invalid_argument("LPA* requires non negative edge costs");
+                        }
+                        if (neighbor_id != start_id_ && _extend(g_[current_id], edge_cost) < rhs_[neighbor_id])
+                        {
+                            rhs_[neighbor_id] = _extend(g_[current_id], edge_cost);
+                            this->_update_node(neighbor_id);
+                        } });
+                }
+                else
+                {
+                    // Under consistent - forget the node cost and let it and its successors find new parents
+                    g_[current_id] = unreachable;
+                    this->_update_rhs(current_id);
+                    this->_update_node(current_id);
+                    for (const std::uint32_t neighbor_id : env_->get_neighbor_ids(current_id))
+                    {
+                        this->_update_rhs(neighbor_id);
+                        this->_update_node(neighbor_id);
+                    }
+                }
+            }
+            return true;
+        }
+
+        // Run the expansions and walk the path back from the goal
+        const std::vector<std::pair<const Node<T, D> *, double>> _search(const CancellationToken *token)
+        {
+            PLOGD << "Performing LPA* search from node id: " << start_id_ << " to node id: " << goal_id_;
+            if (!this->_compute_shortest_path(token))
+            {
+                PLOGD << "LPA* search cancelled after " << num_expansions_ << " expansions.";
+                return {};
+            }
+            PLOGD << "LPA* expanded " << num_expansions_ << " nodes.";
+            if (g_[goal_id_] == unreachable)
+            {
+                return {};
+            }
+            // Walk back from the goal through predecessors that realize the node costs - each has one edge less, so the walk
+            // can not loop even over zero cost cycles
+            std::vector<std::pair<const Node<T, D> *, double>> path;
+            path.reserve(g_[goal_id_].num_edges + 1);
+            std::uint32_t id = goal_id_;
+            while (id != start_id_)
+            {
+                path.emplace_back(env_->get_node(id), g_[id].cost);
+                std::uint32_t parent_id = id;
+                for (const std::uint32_t predecessor_id : env_->get_predecessor_ids(id))
+                {
+                    if (g_[predecessor_id] != unreachable && _extend(g_[predecessor_id], this->_get_edge_cost(predecessor_id, id)) == g_[id])
+                    {
+                        parent_id = predecessor_id;
+                        break;
+                    }
+                }
+                if (parent_id == id)
+                {
+                    PLOGE << "LPA* could not walk the path back from node id " << id;
+                    throw std::logic_error("LPA* found an inconsistent path");
+                }
+                id = parent_id;
+            }
+            path.emplace_back(env_->get_node(start_id_), 0.0); // Add the starting node with cost 0
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+    public:
+        /**
+         * @brief Construct a new LpaStar object bound to an initialized environment, a start and a goal.
+         * @param env environment in which the search is performed.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param heuristic heuristic policy - default constructed by default.
+         */
+        LpaStar(const E &env,
+                const Node<T, D> &start_node,
+                const Node<T, D> &goal_node,
+                const H &heuristic = H())
+            : env_(&env),
+              heuristic_(heuristic),
+              start_id_(env.get_node_id(start_node)),
+              goal_id_(env.get_node_id(goal_node)),
+              g_(env.get_num_nodes(), unreachable),
+              rhs_(env.get_num_nodes(), unreachable),
+              open_(env.get_num_nodes())
+        {
+            PLOGD << "Initializing LpaStar object from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            rhs_[start_id_] = PathCost{0.0, 0};
+            open_.push(start_id_, this->_get_key(start_id_));
+        }
+
+        /**
+         * @brief Destructor for the LpaStar class.
+         */
+        ~LpaStar()
+        {
+            PLOGD << "Destroying LpaStar object.";
+        }
+
+        /**
+         * @brief Report that the edge(s) from `from_id` to `to_id` were added, removed or changed cost in the environment.
+         * Call it after every change - the work is deferred to the next `search`.
+         * @param from_id id of the source node.
+         * @param to_id id of the target node.
+         */
+        void notify_edge_change(const std::uint32_t from_id, const std::uint32_t to_id)
+        {
+            PLOGD << "LPA* notified of a change of the edge from node id " << from_id << " to node id " << to_id;
+            this->_update_rhs(to_id);
+            this->_update_node(to_id);
+        }
+
+        /**
+         * @brief Report that the edge(s) from `from_node` to `to_node` were added, removed or changed cost in the environment.
+         * @param from_node source node.
+         * @param to_node target node.
+         */
+        void notify_edge_change(const Node<T, D> &from_node, const Node<T, D> &to_node)
+        {
+            this->notify_edge_change(env_->get_node_id(from_node), env_->get_node_id(to_node));
+        }
+
+        /**
+         * @brief Find (or repair) the shortest path from start to goal.
+         * @return A vectors of pairs representing the path from start to goal along with the cost to reach every node - empty
+         * when the goal can not be reached.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search()
+        {
+            return this->_search(nullptr);
+        }
+
+        /**
+         * @brief Find (or repair) the shortest path from start to goal unless `token` is cancelled first - the expansions
+         * done so far are kept for the next search.
+         * @param token cancellation token polled every 64 expansions.
+         * @return A vectors of pairs representing the path from start to goal along with the cost to reach every node - empty
+         * when the goal can not be reached or the search was cancelled.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(const CancellationToken &token)
+        {
+            return this->_search(&token);
+        }
+
+        /**
+         * @brief Get the number of nodes expanded by the last search.
+         * @return std::size_t number of expansions.
+         */
+        std::size_t get_num_expansions() const
+        {
+            return num_expansions_;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_LPA_STAR_H
@@ -0,0 +1,231 @@
+#ifndef SEARCH_SEARCH_MANY_TO_MANY_H
+#define SEARCH_SEARCH_MANY_TO_MANY_H
+
+/**
+ * @file many_to_many.h
+ * @brief Many-to-many distance matrices over indexed environments.
+ */
+
+#include <span>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <math/types.h>
+#include <utils/constants.h>
+#include <search/parallel/parallel_for.h>
+#include <search/search/ucs.h>
+
+namespace search
+{
+
+    /**
+     * @class ManyToManySearch
+     * @brief This class fills distance matrices between sets of nodes. `search` runs one one-to-many UCS per source, which
+     * stops once every target is settled, and hands the sources out one at a time to `num_threads` threads - each with its
+     * own `SearchWorkspace`. Only a `ConcurrentEnvironment` is searched from several threads, the searches of the other
+     * environments may write to them (see `ImplicitEnvironment`). `floyd_warshall` computes the distances between every
+     * pair of nodes with a blocked (cache tiled) Floyd-Warshall, which beats repeated searches on small dense graphs.
+     * Unreachable pairs have an infinite distance. The environment must not be modified while a matrix is computed.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     */
+    template <typename T, unsigned int D, typename E>
+        requires(IndexedEnvironment<E, T, D>)
+    class ManyToManySearch
+    {
+
+        using PriorityQueueType = utils::PriorityQueueType;
+        using DistanceMatrix = math::DynamicMatrix<double>;
+
+    private:
+        // Number of threads filling the matrices
+        std::size_t num_threads_;
+
+        // Priority queue used by the one-to-many searches
+        PriorityQueueType queue_type_;
+
+        // Function to relax `distances(i, j)` through every `k` of a block - `i` runs down a column so the inner loop is
+        // contiguous in the column major matrix
+        static void _relax_block(DistanceMatrix &distances,
+                                 const std::size_t i_begin, const std::size_t i_end,
+                                 const std::size_t j_begin, const std::size_t j_end,
+                                 const std::size_t k_begin, const std::size_t k_end)
+        {
+            for (std::size_t k = k_begin; k < k_end; ++k)
+            {
+                const double *column_k = distances.data() + k * distances.rows();
+                for (std::size_t j = j_begin; j < j_end; ++j)
+                {
+                    const double distance_kj = distances(k, j);
+                    if (distance_kj == std::numeric_limits<double>::infinity())
+                    {
+                        continue;
+                    }
+                    double *column_j = distances.data() + j * distances.rows();
+                    for (std::size_t i = i_begin; i < i_end; ++i)
+                    {
+                        column_j[i] = std::min(column_j[i], column_k[i] + distance_kj);
+                    }
+                }
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new ManyToManySearch object.
+         * @param num_threads number of threads filling the matrices - default is the number of hardware threads.
+         * @param queue_type priority queue used by the one-to-many searches - default is the indexed d-ary heap.
+         */
+        explicit ManyToManySearch(const std::size_t num_threads = std::thread::hardware_concurrency(),
+                                  const PriorityQueueType queue_type = PriorityQueueType::D_ARY_HEAP)
+            : num_threads_(std::max<std::size_t>(num_threads, 1)),
+              queue_type_(queue_type)
+        {
+            PLOGD << "Initializing ManyToManySearch object with " << num_threads_ << " threads.";
+        }
+
+        /**
+         * @brief Destructor for the ManyToManySearch class.
+         */
+        ~ManyToManySearch()
+        {
+            PLOGD << "Destroying ManyToManySearch object.";
+        }
+
+        /**
+         * @brief Compute the distances from every source to every target with one one-to-many UCS per source. Edge costs must
+         * be non negative.
+         * @param source_nodes The source nodes (rows).
+         * @param target_nodes The target nodes (columns).
+         * @param env The environment in which the search is performed.
+         * @return math::DynamicMatrix<double> `source_nodes.size() x target_nodes.size()` matrix of path costs.
+         */
+        DistanceMatrix search(const std::span<const Node<T, D> *const> source_nodes,
+                              const std::span<const Node<T, D> *const> target_nodes,
+                              const E &env) const
+        {
+            PLOGD << "Computing the " << source_nodes.size() << " x " << target_nodes.size() << " distance matrix.";
+            std::vector<std::uint32_t> source_ids(source_nodes.size());
+            std::vector<std::uint32_t> target_ids(target_nodes.size());
+            for (std::size_t row = 0; row < source_nodes.size(); ++row)
+            {
+                source_ids[row] = env.get_node_id(*source_nodes[row]);
+            }
+            for (std::size_t column = 0; column < target_nodes.size(); ++column)
+            {
+                target_ids[column] = env.get_node_id(*target_nodes[column]);
+            }
+            DistanceMatrix distances(source_ids.size(), target_ids.size());
+            if (target_ids.empty())
+            {
+                return distances;
+            }
+            const UCS<T, D, E> ucs(queue_type_);
+            const std::size_t num_threads = ConcurrentEnvironment<E, T, D> ? num_threads_ : 1;
+            std::atomic<std::size_t> next_row = 0;
+            parallel_for(std::min(num_threads, source_ids.size()), num_threads, [&](const std::size_t, const std::size_t, const std::size_t)
+                         {
+                SearchWorkspace workspace;
+                for (std::size_t row = next_row.fetch_add(1, std::memory_order_relaxed); row < source_ids.size();
+                     row = next_row.fetch_add(1, std::memory_order_relaxed))
+                {
+                    ucs.search_many(source_ids[row], target_ids, env, workspace);
+                    for (std::size_t column = 0; column < target_ids.size(); ++column)
+                    {
+                        distances(row, column) = workspace.is_closed(target_ids[column]) ? workspace.get_cost(target_ids[column])
+                                                                                         : std::numeric_limits<double>::infinity();
+                    }
+                } },
+                         1);
+            return distances;
+        }
+
+        /**
+         * @brief Compute the distances between every pair of nodes with a blocked Floyd-Warshall in O(n^3) time and O(n^2)
+         * memory. Negative edge costs are allowed as long as there is no negative cycle - a negative diagonal entry reveals one.
+         * Every edge must end at an id below `get_num_nodes()`, which rules out environments that discover their nodes while
+         * they are searched once their frontier is expanded (see `ImplicitEnvironment`).
+         * @param env The environment in which the search is performed.
+         * @param block_size side of the tiles the matrix is processed in - default is 64 (a 32 KiB tile of doubles).
+         * @return math::DynamicMatrix<double> `n x n` matrix of path costs indexed by node id.
+         */
+        DistanceMatrix floyd_warshall(const E &env, const std::size_t block_size = 64) const
+        {
+            const std::size_t num_nodes = env.get_num_nodes();
+            PLOGD << "Computing the all pairs distance matrix of " << num_nodes << " nodes with blocks of " << block_size << ".";
+            if (block_size == 0)
+            {
+                PLOGE << "Floyd-Warshall block size must be positive";
+                throw std::invalid_argument("Floyd-Warshall block size must be positive");
+            }
+            DistanceMatrix distances = DistanceMatrix::Constant(num_nodes, num_nodes, std::numeric_limits<double>::infinity());
+            for (std::uint32_t id = 0; id < num_nodes; ++id)
+            {
+                distances(id, id) = 0.0;
+                env.for_each_edge(id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                  {
+                    if (neighbor_id >= num_nodes)
+                    {
+                        PLOGE << "Floyd-Warshall found an edge to node id " << neighbor_id << " past the " << num_nodes << " nodes";
+                        throw std::invalid_argument("Floyd-Warshall requires every edge to end at a node id below the number of nodes");
+                    }
+                    distances(id, neighbor_id) = std::min(distances(id, neighbor_id), edge_cost); });
+            }
+            const std::size_t num_blocks = (num_nodes + block_size - 1) / block_size;
+            const auto block_begin = [&](const std::size_t block)
+            { return block * block_size; };
+            const auto block_end = [&](const std::size_t block)
+            { return std::min(num_nodes, (block + 1) * block_size); };
+            for (std::size_t k_block = 0; k_block < num_blocks; ++k_block)
+            {
+                const std::size_t k_begin = block_begin(k_block);
+                const std::size_t k_end = block_end(k_block);
+                // Phase 1 - the diagonal block depends only on itself
+                _relax_block(distances, k_begin, k_end, k_begin, k_end, k_begin, k_end);
+                // Phase 2 - the blocks in the row and column of the diagonal block depend on it and on themselves
+                parallel_for(2 * num_blocks, num_threads_, [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                             {
+                    for (std::size_t idx = begin; idx < end; ++idx)
+                    {
+                        const std::size_t block = idx / 2;
+                        if (block == k_block)
+                        {
+                            continue;
+                        }
+                        if (idx % 2 == 0)
+                        {
+                            _relax_block(distances, k_begin, k_end, block_begin(block), block_end(block), k_begin, k_end);
+                        }
+                        else
+                        {
+                            _relax_block(distances, block_begin(block), block_end(block), k_begin, k_end, k_begin, k_end);
+                        }
+                    } },
+                             1);
+                // Phase 3 - every other block depends on the row and column blocks only
+                parallel_for(num_blocks, num_threads_, [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                             {
+                    for (std::size_t j_block = begin; j_block < end; ++j_block)
+                    {
+                        if (j_block == k_block)
+                        {
+                            continue;
+                        }
+                        for (std::size_t i_block = 0; i_block < num_blocks; ++i_block)
+                        {
+                            if (i_block != k_block)
+                            {
+                                _relax_block(distances, block_begin(i_block), block_end(i_block), block_begin(j_block), block_end(j_block), k_begin, k_end);
+                            }
+                        }
+                    } },
+                             1);
+            }
+            return distances;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_SEARCH_MANY_TO_MANY_H
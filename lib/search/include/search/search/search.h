@@ -6,9 +6,14 @@
  * @brief Abstract class for representing search algorithms. This is mostly a pure virtual class and must be inherited to define a custom search algorithm.
  */
 
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <memory_resource>
 #include <plog/Log.h>
 #include <search/node/node.h>
 #include <search/environment/environment.h>
+#include <search/search/workspace.h>
 
 namespace search
 {
@@ -48,6 +53,24 @@ namespace search
             const Node<T, D> &goal_node,
             const E &env) const = 0;
 
+        /**
+         * @brief Perform a search on graph based environment reusing the scratch memory of `workspace`.
+         * The default implementation ignores the workspace - algorithms override it to run allocation free.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        virtual const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env,
+            SearchWorkspace &) const
+        {
+            return search(start_node, goal_node, env);
+        }
+
         /**
          * @brief Get the path from `from_node` to `to_node` in the environment given the parent map.
          * @param from_node node A.
@@ -57,7 +80,7 @@ namespace search
          */
         virtual const std::vector<std::pair<const Node<T, D> *, double>> get_path(const Node<T, D> &from_node,
                                                                             const Node<T, D> &to_node,
-                                                                            const std::unordered_map<const Node<T, D> *, std::pair<const Node<T, D> *, double>> &parent_map) const
+                                                                            const std::pmr::unordered_map<const Node<T, D> *, std::pair<const Node<T, D> *, double>> &parent_map) const
         {
             PLOGD << "Getting path from node: " << from_node.get_name() << " to node: " << to_node.get_name();
             std::vector<std::pair<const Node<T, D> *, double>> path;
@@ -71,6 +94,36 @@ namespace search
             std::reverse(path.begin(), path.end());
             return path;
         }
+
+        /**
+         * @brief Get the path from `from_id` to `to_id` in an indexed environment given the parents and costs held by a workspace.
+         * The parents are walked twice - once to size the path, once to fill it back to front - so the path is allocated once.
+         * @param from_id id of node A.
+         * @param to_id id of node B.
+         * @param workspace workspace holding the parent and cost of every reached node.
+         * @param env The environment in which the search was performed.
+         * @return const std::vector<std::pair<Node<T, D> *, double>> path from `from_id` to `to_id`.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> get_path(const std::uint32_t from_id,
+                                                                          const std::uint32_t to_id,
+                                                                          const SearchWorkspace &workspace,
+                                                                          const E &env) const
+            requires(IndexedEnvironment<E, T, D>)
+        {
+            PLOGD << "Getting path from node id: " << from_id << " to node id: " << to_id;
+            std::size_t length = 1;
+            for (std::uint32_t id = to_id; id != from_id; id = workspace.get_parent(id))
+            {
+                ++length;
+            }
+            std::vector<std::pair<const Node<T, D> *, double>> path(length);
+            for (std::uint32_t id = to_id; id != from_id; id = workspace.get_parent(id))
+            {
+                path[--length] = {env.get_node(id), workspace.get_cost(id)};
+            }
+            path[0] = {env.get_node(from_id), 0.0}; // Add the starting node with cost 0
+            return path;
+        }
     };
 
 } // namespace search
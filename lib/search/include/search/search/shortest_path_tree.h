@@ -0,0 +1,172 @@
+#ifndef SEARCH_SEARCH_SHORTEST_PATH_TREE_H
+#define SEARCH_SEARCH_SHORTEST_PATH_TREE_H
+
+/**
+ * @file shortest_path_tree.h
+ * @brief Shortest path tree of a one-to-many search as dense distance and parent arrays.
+ */
+
+#include <span>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <plog/Log.h>
+#include <search/node/node.h>
+#include <search/search/workspace.h>
+
+namespace search
+{
+
+    /**
+     * @class ShortestPathTree
+     * @brief This class holds the result of a one-to-many search from a root node: for every node id the cost of the cheapest
+     * path from the root and the parent of the node on that path, in two dense arrays indexed by node id. Nodes the search did
+     * not settle - unreachable or left once every target was settled - have an infinite distance and no parent.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class ShortestPathTree
+    {
+
+    public:
+        // Parent of the nodes outside the tree
+        static constexpr std::uint32_t no_parent = std::numeric_limits<std::uint32_t>::max();
+
+    private:
+        // Id of the root node
+        std::uint32_t root_id_ = no_parent;
+
+        // Cost of the cheapest path from the root - indexed by node id
+        std::vector<double> distances_;
+
+        // Parent on the cheapest path from the root - indexed by node id
+        std::vector<std::uint32_t> parents_;
+
+    public:
+        /**
+         * @brief Construct an empty ShortestPathTree object.
+         */
+        ShortestPathTree() = default;
+
+        /**
+         * @brief Construct a new ShortestPathTree object from the nodes closed in the current query of a workspace.
+         * @param root_id id of the root node.
+         * @param num_nodes number of nodes of the environment.
+         * @param workspace workspace holding the parent and cost of every closed node.
+         */
+        ShortestPathTree(const std::uint32_t root_id, const std::size_t num_nodes, const SearchWorkspace &workspace)
+            : root_id_(root_id),
+              distances_(std::max(num_nodes, workspace.size()), std::numeric_limits<double>::infinity()),
+              parents_(distances_.size(), no_parent)
+        {
+            PLOGD << "Exporting the shortest path tree of node id " << root_id_ << " over " << distances_.size() << " nodes.";
+            for (std::uint32_t id = 0; id < distances_.size(); ++id)
+            {
+                if (workspace.is_closed(id))
+                {
+                    distances_[id] = workspace.get_cost(id);
+                    parents_[id] = workspace.get_parent(id);
+                }
+            }
+        }
+
+        /**
+         * @brief Get the id of the root node.
+         * @return std::uint32_t root node id.
+         */
+        std::uint32_t get_root_id() const
+        {
+            return root_id_;
+        }
+
+        /**
+         * @brief Get the number of nodes covered by the arrays.
+         * @return std::size_t number of nodes.
+         */
+        std::size_t size() const
+        {
+            return distances_.size();
+        }
+
+        /**
+         * @brief Check whether a node is part of the tree.
+         * @param id node id.
+         * @return true if the cheapest path from the root to the node is known, false otherwise.
+         */
+        bool contains(const std::uint32_t id) const
+        {
+            return id < parents_.size() && parents_[id] != no_parent;
+        }
+
+        /**
+         * @brief Get the cost of the cheapest path from the root to a node.
+         * @param id node id.
+         * @return double cost of the path, infinity when the node is not part of the tree.
+         */
+        double get_distance(const std::uint32_t id) const
+        {
+            return id < distances_.size() ? distances_[id] : std::numeric_limits<double>::infinity();
+        }
+
+        /**
+         * @brief Get the parent of a node - the root is its own parent.
+         * @param id node id.
+         * @return std::uint32_t parent node id, `no_parent` when the node is not part of the tree.
+         */
+        std::uint32_t get_parent(const std::uint32_t id) const
+        {
+            return id < parents_.size() ? parents_[id] : no_parent;
+        }
+
+        /**
+         * @brief Get the distance array.
+         * @return std::span<const double> cost of the cheapest path from the root to every node.
+         */
+        std::span<const double> get_distances() const
+        {
+            return distances_;
+        }
+
+        /**
+         * @brief Get the parent array.
+         * @return std::span<const std::uint32_t> parent of every node.
+         */
+        std::span<const std::uint32_t> get_parents() const
+        {
+            return parents_;
+        }
+
+        /**
+         * @brief Get the path from the root to a node.
+         * @tparam E Environment type.
+         * @param to_id id of the node.
+         * @param env The environment in which the search was performed.
+         * @return A vectors of pairs representing the path from the root to the node along with its step costs - empty when
+         * the node is not part of the tree.
+         */
+        template <typename E>
+        std::vector<std::pair<const Node<T, D> *, double>> get_path(const std::uint32_t to_id, const E &env) const
+        {
+            if (!this->contains(to_id))
+            {
+                return {};
+            }
+            std::size_t length = 1;
+            for (std::uint32_t id = to_id; id != root_id_; id = parents_[id])
+            {
+                ++length;
+            }
+            std::vector<std::pair<const Node<T, D> *, double>> path(length);
+            for (std::uint32_t id = to_id; id != root_id_; id = parents_[id])
+            {
+                path[--length] = {env.get_node(id), distances_[id]};
+            }
+            path[0] = {env.get_node(root_id_), 0.0};
+            return path;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_SEARCH_SHORTEST_PATH_TREE_H
@@ -0,0 +1,521 @@
+#ifndef SEARCH_SMA_STAR_H
+#define SEARCH_SMA_STAR_H
+
+/**
+ * @file sma_star.h
+ * @brief Simplified Memory-bounded A* (SMA*) search algorithm implementation for graph-based environments.
+ */
+
+#include <set>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <stdexcept>
+#include <memory_resource>
+#include <search/search/search.h>
+#include <search/heuristic/distance_heuristic.h>
+
+namespace search
+{
+    /**
+     * @class SmaStar
+     * @brief This class represents the Simplified Memory-bounded A* (SMA*) algorithm: A* over a search tree that holds at
+     * most as many nodes as fit in the memory limit. When the tree is full, the worst leaf - highest `f`, shallowest first -
+     * is forgotten to make room, and its parent remembers the best `f` among its forgotten children so the subtree is
+     * regenerated only once everything better has been tried. Every node backs up the best `f` of its subtree, so the
+     * search keeps improving its estimates instead of starting over like IDA*. A successor already in the tree at no higher
+     * cost is skipped, and a leaf reached more cheaply is replaced, so the tree does not fill up with paths to the same node.
+     * Nodes that would be deeper than the tree can hold are never expanded, and the path is optimal when the heuristic is
+     * admissible and an optimal path fits in memory. When no path fits, forgotten subtrees keep being regenerated and the
+     * search may thrash for a long time before it gives up, so the number of expansions can be capped as well - an empty
+     * path is returned when either limit is hit. Edge costs must be non negative. The statistics describe the last search,
+     * so an object must not run searches from several threads at once.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     * @tparam H Heuristic type - default is the Euclidean distance heuristic.
+     */
+    template <typename T, unsigned int D, typename E, typename H = EuclideanHeuristic<T, D>>
+        requires(IndexedEnvironment<E, T, D> && Heuristic<H, T, D>)
+    class SmaStar : protected Search<T, D, E>
+    {
+    private:
+        // Missing tree node
+        static constexpr std::uint32_t npos_ = std::numeric_limits<std::uint32_t>::max();
+
+        // Node of the search tree
+        struct Record
+        {
+            std::uint32_t id;           // Node id in the environment
+            std::uint32_t parent;       // Parent record
+            std::uint32_t first_child;  // First child record
+            std::uint32_t next_sibling; // Next record with the same parent
+            std::uint32_t prev_sibling; // Previous record with the same parent
+            std::uint32_t depth;        // Number of edges from the root
+            std::uint32_t num_children; // Number of children in memory
+            bool expanded;              // Whether the successors were generated before
+            bool in_open;               // Whether the record is in the open list
+            double cost;                // Cost to reach the node
+            double f;                   // Best `f` of the subtree
+            double forgotten;           // Best `f` of the forgotten children
+        };
+
+        // Successor of the node being expanded
+        struct Successor
+        {
+            std::uint32_t id; // Node id
+            double cost;      // Cost to reach the node
+            double f;         // Cost plus heuristic, at least the `f` of the node
+        };
+
+        // Open list entry - best `f` first, deepest first among equal `f`
+        struct OpenKey
+        {
+            double f;
+            std::uint32_t depth;
+            std::uint32_t index;
+
+            bool operator<(const OpenKey &other) const
+            {
+                if (f != other.f)
+                {
+                    return f < other.f;
+                }
+                if (depth != other.depth)
+                {
+                    return depth > other.depth;
+                }
+                return index < other.index;
+            }
+        };
+
+        // Bytes of one tree node - the record, its open list entry with the tree overhead, its cheapest record entry with the
+        // bucket overhead and its free list slot
+        static constexpr std::size_t bytes_per_node_ = sizeof(Record) + sizeof(OpenKey) + 4 * sizeof(void *) +
+                                                       2 * sizeof(std::uint32_t) + 3 * sizeof(void *) + sizeof(std::uint32_t);
+
+        // Heuristic policy
+        H heuristic_;
+
+        // Largest number of bytes held by the search tree
+        std::size_t memory_limit_;
+
+        // Largest number of tree nodes
+        std::size_t max_nodes_;
+
+        // Largest number of expansions of a search
+        std::size_t max_expansions_;
+
+        // Number of nodes expanded by the last search
+        mutable std::size_t num_expansions_ = 0;
+
+        // Number of expansions of the last search that regenerated forgotten successors
+        mutable std::size_t num_reexpansions_ = 0;
+
+        // Number of tree nodes forgotten by the last search
+        mutable std::size_t num_forgotten_ = 0;
+
+        // Search tree of one query
+        struct Tree
+        {
+            std::vector<Record> records;        // Tree nodes, live or free
+            std::vector<std::uint32_t> free;    // Free records
+            std::pmr::unsynchronized_pool_resource resource; // Recycles the open list and cheapest record entries
+            std::pmr::set<OpenKey> open{&resource};          // Leaves and nodes with forgotten children
+            std::pmr::unordered_map<std::uint32_t, std::uint32_t> cheapest{&resource}; // Cheapest record of every node id
+            std::size_t num_live = 0;                        // Number of live records
+
+            // Create a record and link it under `parent`
+            std::uint32_t create(const std::uint32_t id, const std::uint32_t parent, const double cost, const double f, const std::size_t max_nodes)
+            {
+                std::uint32_t index;
+                if (!free.empty())
+                {
+                    index = free.back();
+                    free.pop_back();
+                }
+                else
+                {
+                    if (records.size() == records.capacity())
+                    {
+                        records.reserve(std::min(std::max<std::size_t>(2 * records.size(), 64), max_nodes));
+                    }
+                    index = static_cast<std::uint32_t>(records.size());
+                    records.emplace_back();
+                }
+                const std::uint32_t depth = parent == npos_ ? 0 : records[parent].depth + 1;
+                records[index] = {id, parent, npos_, npos_, npos_, depth, 0, false, false, cost, f, std::numeric_limits<double>::infinity()};
+                if (parent != npos_)
+                {
+                    Record &parent_record = records[parent];
+                    records[index].next_sibling = parent_record.first_child;
+                    if (parent_record.first_child != npos_)
+                    {
+                        records[parent_record.first_child].prev_sibling = index;
+                    }
+                    parent_record.first_child = index;
+                    ++parent_record.num_children;
+                }
+                cheapest[id] = index;
+                ++num_live;
+                return index;
+            }
+
+            // Unlink a leaf from its parent and free it
+            void destroy(const std::uint32_t index)
+            {
+                Record &record = records[index];
+                if (record.prev_sibling != npos_)
+                {
+                    records[record.prev_sibling].next_sibling = record.next_sibling;
+                }
+                else
+                {
+                    records[record.parent].first_child = record.next_sibling;
+                }
+                if (record.next_sibling != npos_)
+                {
+                    records[record.next_sibling].prev_sibling = record.prev_sibling;
+                }
+                --records[record.parent].num_children;
+                const auto it = cheapest.find(record.id);
+                if (it != cheapest.end() && it->second == index)
+                {
+                    cheapest.erase(it);
+                }
+                free.push_back(index);
+                --num_live;
+            }
+
+            void push(const std::uint32_t index)
+            {
+                Record &record = records[index];
+                if (!record.in_open)
+                {
+                    open.insert({record.f, record.depth, index});
+                    record.in_open = true;
+                }
+            }
+
+            void pop(const std::uint32_t index)
+            {
+                Record &record = records[index];
+                if (record.in_open)
+                {
+                    open.erase({record.f, record.depth, index});
+                    record.in_open = false;
+                }
+            }
+
+            // Set the `f` of a record, keeping its open list entry in order
+            void set_f(const std::uint32_t index, const double f)
+            {
+                const bool in_open = records[index].in_open;
+                this->pop(index);
+                records[index].f = f;
+                if (in_open)
+                {
+                    this->push(index);
+                }
+            }
+
+            // Best `f` of the children in memory and the forgotten children of a record
+            double get_backed_up_f(const std::uint32_t index) const
+            {
+                double f = records[index].forgotten;
+                for (std::uint32_t child = records[index].first_child; child != npos_; child = records[child].next_sibling)
+                {
+                    f = std::min(f, records[child].f);
+                }
+                return f;
+            }
+
+            // Find the worst leaf of the open list - none when only `excluded` or inner nodes are open
+            std::uint32_t find_worst_leaf(const std::uint32_t excluded) const
+            {
+                for (auto it = open.rbegin(); it != open.rend(); ++it)
+                {
+                    if (it->index != excluded && records[it->index].num_children == 0 && records[it->index].parent != npos_)
+                    {
+                        return it->index;
+                    }
+                }
+                return npos_;
+            }
+        };
+
+        // Forget a leaf, leaving its `f` with its parent
+        void _forget(Tree &tree, const std::uint32_t index, const std::uint32_t expanding) const
+        {
+            const std::uint32_t parent = tree.records[index].parent;
+            tree.pop(index);
+            tree.records[parent].forgotten = std::min(tree.records[parent].forgotten, tree.records[index].f);
+            tree.destroy(index);
+            ++num_forgotten_;
+            // The parent has to be expanded again unless the leaf was a dead end - the node being expanded is put back once
+            // it is done, and a parent left without children is a leaf either way
+            const Record &parent_record = tree.records[parent];
+            if (parent != expanding && (parent_record.num_children == 0 || parent_record.forgotten != std::numeric_limits<double>::infinity()))
+            {
+                tree.push(parent);
+            }
+        }
+
+        // Drop a leaf reached more cheaply elsewhere - its parent forgets nothing
+        void _drop(Tree &tree, const std::uint32_t index, const std::uint32_t expanding) const
+        {
+            const std::uint32_t parent = tree.records[index].parent;
+            tree.pop(index);
+            tree.destroy(index);
+            if (parent != expanding)
+            {
+                if (tree.records[parent].num_children == 0)
+                {
+                    tree.push(parent);
+                }
+                tree.set_f(parent, tree.get_backed_up_f(parent));
+                this->_back_up(tree, parent);
+            }
+        }
+
+        // Propagate a changed `f` from a record to its ancestors
+        void _back_up(Tree &tree, std::uint32_t index) const
+        {
+            for (std::uint32_t parent = tree.records[index].parent; parent != npos_; index = parent, parent = tree.records[parent].parent)
+            {
+                const double f = tree.get_backed_up_f(parent);
+                if (f == tree.records[parent].f)
+                {
+                    break;
+                }
+                tree.set_f(parent, f);
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new SmaStar object.
+         * @param heuristic heuristic policy - default constructed by default.
+         * @param memory_limit largest number of bytes held by the search tree - default is 64 MiB.
+         * @param max_expansions largest number of expansions before a search gives up - default is unlimited.
+         */
+        SmaStar(const H &heuristic = H(),
+                const std::size_t memory_limit = 64 * 1024 * 1024,
+                const std::size_t max_expansions = std::numeric_limits<std::size_t>::max())
+            : heuristic_(heuristic),
+              memory_limit_(memory_limit),
+              max_nodes_(std::min<std::size_t>(memory_limit / bytes_per_node_, npos_)),
+              max_expansions_(max_expansions)
+        {
+            PLOGD << "Initializing SmaStar object with a memory limit of " << memory_limit_ << " bytes (" << max_nodes_ << " nodes).";
+            if (max_nodes_ < 2)
+            {
+                PLOGE << "SmaStar memory limit of " << memory_limit_ << " bytes can not hold two nodes";
+                throw std::invalid_argument("SmaStar memory limit must hold at least two nodes");
+            }
+        }
+
+        /**
+         * @brief Destructor for the SmaStar class.
+         */
+        ~SmaStar()
+        {
+            PLOGD << "Destroying SmaStar object.";
+        }
+
+        /**
+         * @brief Perform SMA* search on graph based environment and return a path from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, env, workspace);
+        }
+
+        /**
+         * @brief Perform SMA* search on graph based environment and poll the cancellation token of `workspace`. The search
+         * tree is bounded by the memory limit rather than sized by the graph, so the workspace is not sized to the graph.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @param workspace Workspace whose cancellation token is polled (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing SMA* search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            const std::uint32_t start_id = env.get_node_id(start_node);
+            const std::uint32_t goal_id = env.get_node_id(goal_node);
+            const NodeValue<T, D> goal_value = env.get_node_value(goal_id);
+            num_expansions_ = 0;
+            num_reexpansions_ = 0;
+            num_forgotten_ = 0;
+            Tree tree;
+            std::vector<Successor> successors;
+            tree.push(tree.create(start_id, npos_, 0.0, heuristic_.get_heuristic(env.get_node_value(start_id), goal_value), max_nodes_));
+            while (!tree.open.empty() && tree.open.begin()->f != std::numeric_limits<double>::infinity())
+            {
+                const std::uint32_t current = tree.open.begin()->index;
+                if (tree.records[current].id == goal_id)
+                {
+                    PLOGD << "SMA* expanded " << num_expansions_ << " nodes, " << num_reexpansions_ << " of them again, and forgot " << num_forgotten_ << " nodes.";
+                    std::vector<std::pair<const Node<T, D> *, double>> path(tree.records[current].depth + 1);
+                    for (std::uint32_t index = current; index != npos_; index = tree.records[index].parent)
+                    {
+                        path[tree.records[index].depth] = {env.get_node(tree.records[index].id), tree.records[index].cost};
+                    }
+                    return path;
+                }
+                if (workspace.is_cancelled())
+                {
+                    PLOGD << "SMA* search cancelled.";
+                    return {};
+                }
+                if (num_expansions_ == max_expansions_)
+                {
+                    PLOGD << "SMA* gave up after " << num_expansions_ << " expansions.";
+                    return {};
+                }
+                tree.pop(current);
+                ++num_expansions_;
+                num_reexpansions_ += tree.records[current].expanded;
+                tree.records[current].expanded = true;
+                tree.records[current].forgotten = std::numeric_limits<double>::infinity();
+                successors.clear();
+                env.for_each_edge(tree.records[current].id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                  {
+                    if (edge_cost < 0.0)
+                    {
+                        PLOGE << "SMA* found a negative edge cost: " << edge_cost;
+                        throw std::invalid_argument("SMA* requires non negative edge costs");
+                    }
+                    const Record &record = tree.records[current];
+                    // Nodes at the deepest level the tree can hold can not lead anywhere - only the goal is kept there
+                    if (neighbor_id != goal_id && record.depth + 2 >= max_nodes_)
+                    {
+                        return;
+                    }
+                    // Skip successors already in the tree at no higher cost - the path to the node, its children still in
+                    // memory and every other path there
+                    const double cost = record.cost + edge_cost;
+                    const auto it = tree.cheapest.find(neighbor_id);
+                    if (it != tree.cheapest.end() && tree.records[it->second].cost <= cost)
+                    {
+                        return;
+                    }
+                    successors.push_back({neighbor_id, cost, std::max(record.f, cost + heuristic_.get_heuristic(env.get_node_value(neighbor_id), goal_value))}); });
+                // Best successors first, so those that do not fit are the worst ones
+                std::sort(successors.begin(), successors.end(), [](const Successor &a, const Successor &b)
+                          { return a.f < b.f; });
+                const std::uint32_t depth = tree.records[current].depth + 1;
+                for (const Successor &successor : successors)
+                {
+                    // Replace a leaf reached more cheaply now
+                    const auto it = tree.cheapest.find(successor.id);
+                    if (it != tree.cheapest.end())
+                    {
+                        if (tree.records[it->second].cost <= successor.cost)
+                        {
+                            continue;
+                        }
+                        if (tree.records[it->second].num_children == 0 && tree.records[it->second].parent != npos_)
+                        {
+                            this->_drop(tree, it->second, current);
+                        }
+                    }
+                    if (tree.num_live == max_nodes_)
+                    {
+                        const std::uint32_t worst = tree.find_worst_leaf(current);
+                        if (worst == npos_ || !(OpenKey{successor.f, depth, 0} < OpenKey{tree.records[worst].f, tree.records[worst].depth, 0}))
+                        {
+                            // The successor is no better than anything in memory - forget it right away
+                            tree.records[current].forgotten = std::min(tree.records[current].forgotten, successor.f);
+                            continue;
+                        }
+                        this->_forget(tree, worst, current);
+                    }
+                    tree.push(tree.create(successor.id, current, successor.cost, successor.f, max_nodes_));
+                }
+                // Dead ends keep an infinite `f` until they are forgotten
+                const double f = tree.get_backed_up_f(current);
+                tree.records[current].f = f;
+                if (tree.records[current].num_children == 0 || tree.records[current].forgotten != std::numeric_limits<double>::infinity())
+                {
+                    tree.push(current);
+                }
+                this->_back_up(tree, current);
+            }
+            PLOGD << "SMA* found no path after " << num_expansions_ << " expansions.";
+            return {};
+        }
+
+        /**
+         * @brief Get the memory limit.
+         * @return std::size_t largest number of bytes held by the search tree.
+         */
+        std::size_t get_memory_limit() const
+        {
+            return memory_limit_;
+        }
+
+        /**
+         * @brief Get the largest number of expansions of a search.
+         * @return std::size_t expansion limit.
+         */
+        std::size_t get_max_expansions() const
+        {
+            return max_expansions_;
+        }
+
+        /**
+         * @brief Get the largest number of nodes the search tree holds under the memory limit.
+         * @return std::size_t largest number of tree nodes.
+         */
+        std::size_t get_max_nodes() const
+        {
+            return max_nodes_;
+        }
+
+        /**
+         * @brief Get the number of nodes expanded by the last search, counting every expansion.
+         * @return std::size_t number of expansions.
+         */
+        std::size_t get_num_expansions() const
+        {
+            return num_expansions_;
+        }
+
+        /**
+         * @brief Get the number of expansions of the last search that regenerated the forgotten successors of a node.
+         * @return std::size_t number of re-expansions.
+         */
+        std::size_t get_num_reexpansions() const
+        {
+            return num_reexpansions_;
+        }
+
+        /**
+         * @brief Get the number of tree nodes the last search forgot to stay under the memory limit.
+         * @return std::size_t number of forgotten nodes.
+         */
+        std::size_t get_num_forgotten() const
+        {
+            return num_forgotten_;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_SMA_STAR_H
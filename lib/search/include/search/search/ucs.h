@@ -0,0 +1,329 @@
+#ifndef SEARCH_UCS_H
+#define SEARCH_UCS_H
+
+/**
+ * @file ucs.h
+ * @brief Uniform Cost Search (UCS / Dijkstra) algorithm implementation for graph-based environments.
+ */
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utils/constants.h>
+#include <search/search/search.h>
+#include <search/search/shortest_path_tree.h>
+
+namespace search
+{
+    /**
+     * @class UCS
+     * @brief This class represents the Uniform Cost Search (UCS) algorithm for searching in an environment. Costs and parents
+     * live in the flat per node arrays of a `SearchWorkspace`. The frontier is either an indexed d-ary heap with decrease-key
+     * or a monotone radix heap keyed on costs quantized to multiples of `quantum` (exact for integer costs with a quantum of 1).
+     * Radix heap keys are 64 bit, so a path cost of `2^64 * quantum` or more throws `std::overflow_error`. Edge costs must be
+     * non negative.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     * @tparam E Environment type.
+     */
+    template <typename T, unsigned int D, typename E>
+        requires(IndexedEnvironment<E, T, D>)
+    class UCS : protected Search<T, D, E>
+    {
+
+        using PriorityQueueType = utils::PriorityQueueType;
+
+    private:
+        // Priority queue used for the frontier
+        PriorityQueueType queue_type_;
+
+        // Cost quantum used to derive radix heap keys
+        double quantum_;
+
+        // Reject edges that would break the monotone frontier
+        void _check_edge_cost(const double edge_cost) const
+        {
+            if (edge_cost < 0.0)
+            {
+                PLOGE << "UCS found a negative edge cost: " << edge_cost;
+                throw std::invalid_argument("UCS requires non negative edge costs");
+            }
+        }
+
+        // Quantize a path cost to its radix heap key - keys past the 64 bit range would wrap and break the monotone order
+        std::uint64_t _get_radix_key(const double cost) const
+        {
+            // 2^64, the first quantized cost without a key
+            constexpr double key_limit = 18446744073709551616.0;
+            const double key = std::round(cost / quantum_);
+            if (!(key < key_limit))
+            {
+                PLOGE << "UCS path cost " << cost << " is out of the radix heap key range for a quantum of " << quantum_;
+                throw std::overflow_error("UCS path cost is out of the radix heap key range - use a larger quantum or the d-ary heap");
+            }
+            return static_cast<std::uint64_t>(key);
+        }
+
+        // UCS with an indexed d-ary heap - runs until `settle(id)` returns true for a popped (closed) node
+        template <typename F>
+        bool _search_d_ary_heap(
+            const std::uint32_t start_id,
+            const E &env,
+            SearchWorkspace &workspace,
+            F &&settle) const
+        {
+            IndexedDaryHeap<double> &frontier = workspace.get_heap();
+            workspace.reach(start_id, start_id, 0.0);
+            frontier.push(start_id, 0.0);
+            while (!frontier.empty())
+            {
+                if (workspace.is_cancelled())
+                {
+                    PLOGD << "UCS search cancelled.";
+                    return false;
+                }
+                const auto [cost, current_id] = frontier.pop();
+                workspace.close(current_id);
+                if (settle(current_id))
+                {
+                    return true;
+                }
+                env.for_each_edge(current_id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                  {
+                    this->_check_edge_cost(edge_cost);
+                    const double new_cost = cost + edge_cost;
+                    if (new_cost < workspace.get_cost(neighbor_id))
+                    {
+                        workspace.reach(neighbor_id, current_id, new_cost);
+                        frontier.push_or_decrease(neighbor_id, new_cost);
+                    } });
+            }
+            return false;
+        }
+
+        // UCS with a radix heap over quantized costs - runs until `settle(id)` returns true for a closed node
+        template <typename F>
+        bool _search_radix_heap(
+            const std::uint32_t start_id,
+            const E &env,
+            SearchWorkspace &workspace,
+            F &&settle) const
+        {
+            RadixHeap &frontier = workspace.get_radix_heap();
+            workspace.reach(start_id, start_id, 0.0);
+            frontier.push(start_id, 0);
+            while (!frontier.empty())
+            {
+                if (workspace.is_cancelled())
+                {
+                    PLOGD << "UCS search cancelled.";
+                    return false;
+                }
+                const std::uint32_t current_id = frontier.pop().second;
+                if (workspace.is_closed(current_id))
+                {
+                    continue; // Stale entry
+                }
+                workspace.close(current_id);
+                if (settle(current_id))
+                {
+                    return true;
+                }
+                const double cost = workspace.get_cost(current_id);
+                env.for_each_edge(current_id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                  {
+                    this->_check_edge_cost(edge_cost);
+                    const double new_cost = cost + edge_cost;
+                    if (!workspace.is_closed(neighbor_id) && new_cost < workspace.get_cost(neighbor_id))
+                    {
+                        workspace.reach(neighbor_id, current_id, new_cost);
+                        frontier.push(neighbor_id, this->_get_radix_key(new_cost));
+                    } });
+            }
+            return false;
+        }
+
+        // Run UCS with the configured frontier until `settle(id)` returns true
+        template <typename F>
+        bool _search(
+            const std::uint32_t start_id,
+            const E &env,
+            SearchWorkspace &workspace,
+            F &&settle) const
+        {
+            switch (queue_type_)
+            {
+            case PriorityQueueType::D_ARY_HEAP:
+                return this->_search_d_ary_heap(start_id, env, workspace, settle);
+            case PriorityQueueType::RADIX_HEAP:
+                return this->_search_radix_heap(start_id, env, workspace, settle);
+            default:
+                PLOGE << "Unknown priority queue type.";
+                throw std::invalid_argument("Unknown priority queue type.");
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new UCS object.
+         * @param queue_type priority queue used for the frontier - default is the indexed d-ary heap.
+         * @param quantum cost resolution of the radix heap keys - default is the project wide floating point precision.
+         */
+        UCS(const PriorityQueueType queue_type = PriorityQueueType::D_ARY_HEAP,
+            const double quantum = utils::floating_point_precision)
+            : queue_type_(queue_type),
+              quantum_(quantum)
+        {
+            PLOGD << "Initializing UCS object with priority queue: " << static_cast<int>(queue_type_);
+            if (quantum_ <= 0.0)
+            {
+                PLOGE << "UCS quantum must be positive, got: " << quantum_;
+                throw std::invalid_argument("UCS quantum must be positive");
+            }
+        }
+
+        /**
+         * @brief Destructor for the UCS class.
+         */
+        ~UCS()
+        {
+            PLOGD << "Destroying UCS object.";
+        }
+
+        /**
+         * @brief Perform UCS search on graph based environment and return the cheapest path from start to goal.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env) const override
+        {
+            SearchWorkspace workspace;
+            return this->search(start_node, goal_node, env, workspace);
+        }
+
+        /**
+         * @brief Perform UCS search on graph based environment reusing the scratch memory of `workspace`.
+         * @param start_node The starting node.
+         * @param goal_node The goal node.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return A vectors of pairs representing the paths from start to goal along with their step costs.
+         */
+        const std::vector<std::pair<const Node<T, D> *, double>> search(
+            const Node<T, D> &start_node,
+            const Node<T, D> &goal_node,
+            const E &env,
+            SearchWorkspace &workspace) const override
+        {
+            PLOGD << "Performing UCS search from node: " << start_node.get_name() << " to node: " << goal_node.get_name();
+            const std::uint32_t start_id = env.get_node_id(start_node);
+            const std::uint32_t goal_id = env.get_node_id(goal_node);
+            workspace.begin(env.get_num_nodes());
+            if (this->_search(start_id, env, workspace, [goal_id](const std::uint32_t id)
+                              { return id == goal_id; }))
+            {
+                return this->get_path(start_id, goal_id, workspace, env);
+            }
+            return {};
+        }
+
+        /**
+         * @brief Perform one-to-many UCS from `start_id` and stop once every node of `goal_ids` is settled - with no goals the
+         * whole reachable graph is settled. The costs and parents are left in `workspace` until its next `begin`: a node
+         * has its cheapest cost and path when `workspace.is_closed(id)` holds, and a goal that is not closed is unreachable
+         * (unless the search was cancelled).
+         * @param start_id id of the starting node.
+         * @param goal_ids ids of the goal nodes - duplicates are allowed.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return std::size_t number of distinct goals settled.
+         */
+        std::size_t search_many(
+            const std::uint32_t start_id,
+            const std::span<const std::uint32_t> goal_ids,
+            const E &env,
+            SearchWorkspace &workspace) const
+        {
+            PLOGD << "Performing one-to-many UCS search from node id: " << start_id << " to " << goal_ids.size() << " nodes";
+            workspace.begin(env.get_num_nodes());
+            std::size_t num_goals = 0;
+            for (const std::uint32_t goal_id : goal_ids)
+            {
+                num_goals += workspace.mark_target(goal_id);
+            }
+            std::size_t num_settled = 0;
+            this->_search(start_id, env, workspace, [&](const std::uint32_t id)
+                          { return workspace.is_target(id) && ++num_settled == num_goals; });
+            return num_settled;
+        }
+
+        /**
+         * @brief Perform one-to-many UCS from `start_node` and export the shortest path tree - the search stops once every
+         * node of `goal_nodes` is settled, with no goals it covers the whole reachable graph.
+         * @param start_node The starting node (root of the tree).
+         * @param goal_nodes The goal nodes.
+         * @param env The environment in which the search is performed.
+         * @return ShortestPathTree<T, D> distances and parents of every settled node.
+         */
+        ShortestPathTree<T, D> get_shortest_path_tree(
+            const Node<T, D> &start_node,
+            const std::span<const Node<T, D> *const> goal_nodes,
+            const E &env) const
+        {
+            SearchWorkspace workspace;
+            return this->get_shortest_path_tree(start_node, goal_nodes, env, workspace);
+        }
+
+        /**
+         * @brief Perform one-to-many UCS from `start_node` reusing the scratch memory of `workspace` and export the shortest
+         * path tree - the search stops once every node of `goal_nodes` is settled, with no goals it covers the whole
+         * reachable graph.
+         * @param start_node The starting node (root of the tree).
+         * @param goal_nodes The goal nodes.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return ShortestPathTree<T, D> distances and parents of every settled node.
+         */
+        ShortestPathTree<T, D> get_shortest_path_tree(
+            const Node<T, D> &start_node,
+            const std::span<const Node<T, D> *const> goal_nodes,
+            const E &env,
+            SearchWorkspace &workspace) const
+        {
+            std::vector<std::uint32_t> goal_ids;
+            goal_ids.reserve(goal_nodes.size());
+            for (const Node<T, D> *goal_node : goal_nodes)
+            {
+                goal_ids.push_back(env.get_node_id(*goal_node));
+            }
+            return this->get_shortest_path_tree(env.get_node_id(start_node), goal_ids, env, workspace);
+        }
+
+        /**
+         * @brief Perform one-to-many UCS from `start_id` reusing the scratch memory of `workspace` and export the shortest
+         * path tree (see `search_many`).
+         * @param start_id id of the starting node (root of the tree).
+         * @param goal_ids ids of the goal nodes.
+         * @param env The environment in which the search is performed.
+         * @param workspace Scratch memory reused across queries (one per thread).
+         * @return ShortestPathTree<T, D> distances and parents of every settled node.
+         */
+        ShortestPathTree<T, D> get_shortest_path_tree(
+            const std::uint32_t start_id,
+            const std::span<const std::uint32_t> goal_ids,
+            const E &env,
+            SearchWorkspace &workspace) const
+        {
+            this->search_many(start_id, goal_ids, env, workspace);
+            return ShortestPathTree<T, D>(start_id, env.get_num_nodes(), workspace);
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_UCS_H
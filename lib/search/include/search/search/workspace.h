@@ -0,0 +1,501 @@
+#ifndef SEARCH_SEARCH_WORKSPACE_H
+#define SEARCH_SEARCH_WORKSPACE_H
+
+/**
+ * @file workspace.h
+ * @brief Reusable per thread scratch memory for the search algorithms.
+ */
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <memory_resource>
+#include <plog/Log.h>
+#include <search/container/atomic_bitmap.h>
+#include <search/container/indexed_heap.h>
+#include <search/container/radix_heap.h>
+#include <search/search/cancellation.h>
+
+namespace search
+{
+
+    /**
+     * @class SearchWorkspace
+     * @brief This class holds the dense per node arrays (reached / closed marks, parents and costs) and the frontier
+     * containers used by the search algorithms. Marks are stamped with a generation number, so starting a new query on a
+     * graph of the same size is O(1): nothing is cleared and nothing is allocated once the buffers have grown to size.
+     * A workspace must only be used by one query at a time - keep one per thread. The per node arrays, the stack and the
+     * containers of the node based searches are allocated from the workspace memory resource, so a query can run out of a
+     * `std::pmr::monotonic_buffer_resource` set up for it. The per thread buffers and the heaps keep the default allocator:
+     * they are filled from worker threads and monotonic buffers are not thread safe. The per node arrays grow when `reach` or
+     * `close` is called with an id past the size given to `begin`, for environments that discover their nodes while they are
+     * searched (see `ImplicitEnvironment`) - the concurrent accessors and the bitmaps only cover the size given to `begin`.
+     * A `CancellationToken` set on the workspace is polled by every search that runs with it, once every 64 expansions.
+     */
+    class SearchWorkspace
+    {
+
+    private:
+        // Number of `is_cancelled` calls per read of the cancellation token
+        static constexpr std::uint32_t poll_interval_ = 64;
+
+        // Per node search state - kept together so a relaxation touches a single cache line
+        struct Slot
+        {
+            std::uint32_t reached = 0; // Generation in which the parent and cost were set
+            std::uint32_t closed = 0;  // Generation in which the node was closed (expanded / settled)
+            std::uint32_t parent = 0;  // Parent node id
+            double cost = 0.0;         // Cost to reach the node
+        };
+
+        // Memory resource of the per query containers
+        std::pmr::memory_resource *resource_;
+
+        // Current generation - stamps equal to it are valid
+        std::uint32_t generation_ = 0;
+
+        // Per node search state
+        std::pmr::vector<Slot> slots_;
+
+        // Generation in which every node was marked a target - only sized once `mark_target` is called
+        std::pmr::vector<std::uint32_t> targets_;
+
+        // Current pass - `begin` and `begin_pass` start a new one, pass stamps equal to it are valid
+        std::uint32_t pass_ = 0;
+
+        // Pass in which every node was last marked - only sized once `mark_in_pass` is called
+        std::pmr::vector<std::uint32_t> passes_;
+
+        // Stack / frontier buffer
+        std::pmr::vector<std::uint32_t> stack_;
+
+        // Per thread buffers
+        std::vector<std::vector<std::uint32_t>> thread_buffers_;
+
+        // Dense frontier bitmaps
+        std::array<AtomicBitmap, 2> bitmaps_;
+
+        // Indexed d-ary heap frontier
+        IndexedDaryHeap<double> heap_;
+
+        // Radix heap frontier
+        RadixHeap radix_heap_;
+
+        // Token polled by the searches - none by default
+        const CancellationToken *cancellation_token_ = nullptr;
+
+        // Number of polls left before the token is read again
+        std::uint32_t polls_left_ = 0;
+
+        // Grow the per node arrays to at least `num_nodes` nodes, keeping the marks of the current query
+        void _grow(const std::size_t num_nodes)
+        {
+            slots_.resize(num_nodes, Slot{});
+            heap_.grow(num_nodes);
+        }
+
+    public:
+        /**
+         * @brief Construct a new SearchWorkspace object - buffers are sized on first use.
+         * @param resource memory resource of the per query containers - default is the default memory resource.
+         */
+        explicit SearchWorkspace(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+            : resource_(resource),
+              slots_(resource),
+              targets_(resource),
+              passes_(resource),
+              stack_(resource)
+        {
+            PLOGD << "Initializing SearchWorkspace object.";
+        }
+
+        /**
+         * @brief Construct a new SearchWorkspace object with buffers sized for a graph.
+         * @param num_nodes number of nodes of the graph.
+         * @param resource memory resource of the per query containers - default is the default memory resource.
+         */
+        explicit SearchWorkspace(const std::size_t num_nodes,
+                                 std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+            : resource_(resource),
+              slots_(resource),
+              targets_(resource),
+              passes_(resource),
+              stack_(resource)
+        {
+            PLOGD << "Initializing SearchWorkspace object for " << num_nodes << " nodes.";
+            begin(num_nodes);
+        }
+
+        /**
+         * @brief Destroy the SearchWorkspace object.
+         */
+        ~SearchWorkspace()
+        {
+            PLOGD << "Destroying SearchWorkspace object.";
+        }
+
+        /**
+         * @brief Start a new query on a graph with `num_nodes` nodes - invalidates every mark of the previous query.
+         * Buffers are only reallocated when the graph size changes, and only extended when it grows.
+         * @param num_nodes number of nodes of the graph.
+         */
+        void begin(const std::size_t num_nodes)
+        {
+            if (slots_.size() < num_nodes)
+            {
+                PLOGD << "Growing SearchWorkspace to " << num_nodes << " nodes.";
+                this->_grow(num_nodes);
+                bitmaps_ = {AtomicBitmap(num_nodes), AtomicBitmap(num_nodes)};
+            }
+            else if (slots_.size() > num_nodes)
+            {
+                PLOGD << "Resizing SearchWorkspace to " << num_nodes << " nodes.";
+                slots_.assign(num_nodes, Slot{});
+                targets_.clear();
+                passes_.clear();
+                pass_ = 0;
+                heap_.clear();
+                heap_.resize(num_nodes);
+                bitmaps_ = {AtomicBitmap(num_nodes), AtomicBitmap(num_nodes)};
+                generation_ = 0;
+            }
+            if (++generation_ == 0)
+            {
+                // Stamps wrapped around - clear them once every 2^32 queries
+                std::fill(slots_.begin(), slots_.end(), Slot{});
+                std::fill(targets_.begin(), targets_.end(), 0);
+                generation_ = 1;
+            }
+            this->begin_pass();
+            heap_.clear();
+            radix_heap_.clear();
+            stack_.clear();
+            polls_left_ = 0;
+        }
+
+        /**
+         * @brief Get the memory resource of the per query containers.
+         * @return std::pmr::memory_resource* memory resource.
+         */
+        std::pmr::memory_resource *get_memory_resource() const
+        {
+            return resource_;
+        }
+
+        /**
+         * @brief Set the cancellation token polled by the searches run with this workspace - it must outlive them.
+         * @param token token, or nullptr to run searches to completion.
+         */
+        void set_cancellation_token(const CancellationToken *token)
+        {
+            cancellation_token_ = token;
+            polls_left_ = 0;
+        }
+
+        /**
+         * @brief Get the cancellation token polled by the searches.
+         * @return const CancellationToken* token, nullptr when none is set.
+         */
+        const CancellationToken *get_cancellation_token() const
+        {
+            return cancellation_token_;
+        }
+
+        /**
+         * @brief Poll the cancellation token - only one call in 64 reads it, the first call after `begin` always
+         * does. Searches call it once per expansion.
+         * @return true if the search should stop, false otherwise.
+         */
+        bool is_cancelled()
+        {
+            if (cancellation_token_ == nullptr)
+            {
+                return false;
+            }
+            if (polls_left_ > 0)
+            {
+                --polls_left_;
+                return false;
+            }
+            polls_left_ = poll_interval_ - 1;
+            return cancellation_token_->is_cancelled();
+        }
+
+        /**
+         * @brief Get the number of nodes the workspace is sized for.
+         * @return std::size_t number of nodes.
+         */
+        std::size_t size() const
+        {
+            return slots_.size();
+        }
+
+        /**
+         * @brief Check whether a node was reached (has a parent and cost) in the current query.
+         * @param id node id.
+         * @return true if the node was reached, false otherwise.
+         */
+        bool is_reached(const std::uint32_t id) const
+        {
+            return id < slots_.size() && slots_[id].reached == generation_;
+        }
+
+        /**
+         * @brief Set the parent and cost of a node and mark it reached.
+         * @param id node id.
+         * @param parent parent node id.
+         * @param cost cost to reach the node.
+         */
+        void reach(const std::uint32_t id, const std::uint32_t parent, const double cost)
+        {
+            if (id >= slots_.size())
+            {
+                this->_grow(std::max<std::size_t>(2 * slots_.size(), static_cast<std::size_t>(id) + 1));
+            }
+            Slot &slot = slots_[id];
+            slot.reached = generation_;
+            slot.parent = parent;
+            slot.cost = cost;
+        }
+
+        /**
+         * @brief Mark a node reached from many threads at once - only the first caller wins.
+         * @param id node id.
+         * @param parent parent node id.
+         * @return true if this call reached the node, false if it was already reached.
+         */
+        bool try_reach(const std::uint32_t id, const std::uint32_t parent)
+        {
+            Slot &slot = slots_[id];
+            std::atomic_ref<std::uint32_t> reached(slot.reached);
+            if (reached.load(std::memory_order_relaxed) == generation_ ||
+                reached.exchange(generation_, std::memory_order_relaxed) == generation_)
+            {
+                return false;
+            }
+            slot.parent = parent;
+            return true;
+        }
+
+        /**
+         * @brief Check whether a node was reached, safe to call while other threads call `try_reach`.
+         * @param id node id.
+         * @return true if the node was reached, false otherwise.
+         */
+        bool is_reached_atomic(const std::uint32_t id)
+        {
+            return std::atomic_ref<std::uint32_t>(slots_[id].reached).load(std::memory_order_relaxed) == generation_;
+        }
+
+        /**
+         * @brief Get the parent of a reached node.
+         * @param id node id.
+         * @return std::uint32_t parent node id.
+         */
+        std::uint32_t get_parent(const std::uint32_t id) const
+        {
+            return slots_[id].parent;
+        }
+
+        /**
+         * @brief Get the cost of a node - infinity when it was not reached in the current query.
+         * @param id node id.
+         * @return double cost to reach the node.
+         */
+        double get_cost(const std::uint32_t id) const
+        {
+            return is_reached(id) ? slots_[id].cost : std::numeric_limits<double>::infinity();
+        }
+
+        /**
+         * @brief Set the cost of a reached node.
+         * @param id node id.
+         * @param cost cost to reach the node.
+         */
+        void set_cost(const std::uint32_t id, const double cost)
+        {
+            slots_[id].cost = cost;
+        }
+
+        /**
+         * @brief Check whether a node was closed in the current query.
+         * @param id node id.
+         * @return true if the node was closed, false otherwise.
+         */
+        bool is_closed(const std::uint32_t id) const
+        {
+            return id < slots_.size() && slots_[id].closed == generation_;
+        }
+
+        /**
+         * @brief Mark a node closed.
+         * @param id node id.
+         */
+        void close(const std::uint32_t id)
+        {
+            if (id >= slots_.size())
+            {
+                this->_grow(std::max<std::size_t>(2 * slots_.size(), static_cast<std::size_t>(id) + 1));
+            }
+            slots_[id].closed = generation_;
+        }
+
+        /**
+         * @brief Mark a node as a target of the current query.
+         * @param id node id.
+         * @return true if the node was not marked yet, false otherwise.
+         */
+        bool mark_target(const std::uint32_t id)
+        {
+            if (id >= targets_.size())
+            {
+                targets_.resize(std::max<std::size_t>(slots_.size(), static_cast<std::size_t>(id) + 1), 0);
+            }
+            if (targets_[id] == generation_)
+            {
+                return false;
+            }
+            targets_[id] = generation_;
+            return true;
+        }
+
+        /**
+         * @brief Check whether a node was marked as a target in the current query.
+         * @param id node id.
+         * @return true if the node is a target, false otherwise.
+         */
+        bool is_target(const std::uint32_t id) const
+        {
+            return id < targets_.size() && targets_[id] == generation_;
+        }
+
+        /**
+         * @brief Start a new pass of the current query - invalidates the pass marks without touching the other marks. Used
+         * by the searches that run several passes over the same costs (see `AraStar`).
+         */
+        void begin_pass()
+        {
+            if (++pass_ == 0)
+            {
+                // Stamps wrapped around - clear them once every 2^32 passes
+                std::fill(passes_.begin(), passes_.end(), 0);
+                pass_ = 1;
+            }
+        }
+
+        /**
+         * @brief Mark a node in the current pass.
+         * @param id node id.
+         */
+        void mark_in_pass(const std::uint32_t id)
+        {
+            if (id >= passes_.size())
+            {
+                passes_.resize(std::max<std::size_t>(slots_.size(), static_cast<std::size_t>(id) + 1), 0);
+            }
+            passes_[id] = pass_;
+        }
+
+        /**
+         * @brief Check whether a node was marked in the current pass.
+         * @param id node id.
+         * @return true if the node was marked, false otherwise.
+         */
+        bool is_marked_in_pass(const std::uint32_t id) const
+        {
+            return id < passes_.size() && passes_[id] == pass_;
+        }
+
+        /**
+         * @brief Get the stack / frontier buffer (emptied by `begin`).
+         * @return std::pmr::vector<std::uint32_t>& buffer.
+         */
+        std::pmr::vector<std::uint32_t> &get_stack()
+        {
+            return stack_;
+        }
+
+        /**
+         * @brief Get `count` per thread buffers - their content is left to the caller.
+         * @param count number of buffers.
+         * @return std::vector<std::vector<std::uint32_t>>& buffers.
+         */
+        std::vector<std::vector<std::uint32_t>> &get_thread_buffers(const std::size_t count)
+        {
+            if (thread_buffers_.size() < count)
+            {
+                thread_buffers_.resize(count);
+            }
+            return thread_buffers_;
+        }
+
+        /**
+         * @brief Get one of the two dense frontier bitmaps - their content is left to the caller.
+         * @param idx bitmap index (0 or 1).
+         * @return AtomicBitmap& bitmap sized to the graph.
+         */
+        AtomicBitmap &get_bitmap(const std::size_t idx)
+        {
+            return bitmaps_[idx];
+        }
+
+        /**
+         * @brief Get the indexed d-ary heap (emptied by `begin`).
+         * @return IndexedDaryHeap<double>& heap sized to the graph.
+         */
+        IndexedDaryHeap<double> &get_heap()
+        {
+            return heap_;
+        }
+
+        /**
+         * @brief Get the radix heap (emptied by `begin`).
+         * @return RadixHeap& heap.
+         */
+        RadixHeap &get_radix_heap()
+        {
+            return radix_heap_;
+        }
+    };
+
+    /**
+     * @class CancellationScope
+     * @brief Sets the cancellation token of a workspace for the lifetime of the scope and clears it on exit, also when the
+     * search run in the scope throws - a workspace reused by the next query must not keep polling a stale token.
+     */
+    class CancellationScope
+    {
+    private:
+        // Workspace whose token is set
+        SearchWorkspace &workspace_;
+
+    public:
+        /**
+         * @brief Construct a new CancellationScope object.
+         * @param workspace workspace whose token is set - it must outlive the scope.
+         * @param token token polled by the searches run in the scope, nullptr to run them to completion.
+         */
+        CancellationScope(SearchWorkspace &workspace, const CancellationToken *token)
+            : workspace_(workspace)
+        {
+            workspace_.set_cancellation_token(token);
+        }
+
+        CancellationScope(const CancellationScope &) = delete;
+        CancellationScope &operator=(const CancellationScope &) = delete;
+
+        /**
+         * @brief Destroy the CancellationScope object - clears the token of the workspace.
+         */
+        ~CancellationScope()
+        {
+            workspace_.set_cancellation_token(nullptr);
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_SEARCH_WORKSPACE_H
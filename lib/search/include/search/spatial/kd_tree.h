@@ -0,0 +1,447 @@
+#ifndef SEARCH_SPATIAL_KD_TREE_H
+#define SEARCH_SPATIAL_KD_TREE_H
+
+/**
+ * @file kd_tree.h
+ * @brief k-d tree over node values for nearest, k nearest and radius queries.
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <plog/Log.h>
+#include <math/types.h>
+#include <utils/constants.h>
+#include <search/node/node.h>
+#include <search/environment/environment.h>
+#include <search/parallel/parallel_for.h>
+
+namespace search
+{
+
+    /**
+     * @class KdTree
+     * @brief This class indexes node values in a balanced k-d tree so the node closest to a raw coordinate - e.g. to snap
+     * the start and goal of a query onto a graph - is found in about O(log N) instead of by scanning every node. Every inner
+     * node splits its range at the median along the axis of largest spread, and ranges of at most `leaf_size` values are
+     * scanned linearly. The tree is stored implicitly: the values are reordered into one contiguous column major matrix and
+     * the children of a range are its two halves, so there are no per node allocations or pointers. Distances follow
+     * `utils::DistanceMetric` and match `DistanceCost`. Matches are `(id, distance)` pairs where the id is the index of the
+     * value the tree was built from (the node id when built from an environment); ties are broken by the smaller id. The
+     * tree is immutable - rebuild it when node values change. Queries are thread safe.
+     * @tparam T Type.
+     * @tparam D Dimension.
+     */
+    template <typename T, unsigned int D>
+    class KdTree
+    {
+
+        using Query = math::ColumnVector<double, D>;
+        using Queries = math::ColumnVectors<double, D>;
+        using Match = std::pair<std::uint32_t, double>;
+        using DistanceMetric = utils::DistanceMetric;
+
+        // Distance in the metric's monotonic reduced form - squared for the Euclidean metric - and the id of a value
+        using Candidate = std::pair<double, std::uint32_t>;
+
+    private:
+        // Node values in tree order - one column per value
+        math::ColumnVectors<T, D> points_;
+
+        // Id of every value in tree order
+        std::vector<std::uint32_t> ids_;
+
+        // Split axis of every inner node, stored at the position of its median value
+        std::vector<std::uint32_t> axes_;
+
+        // Distance metric
+        DistanceMetric distance_metric_;
+
+        // Maximum number of values in a leaf
+        std::size_t leaf_size_;
+
+        // Get the reduced distance from a query to the value at `index` in tree order
+        double _get_reduced_distance(const std::size_t index, const Query &query) const
+        {
+            const auto difference = points_.col(index).template cast<double>() - query;
+            return distance_metric_ == DistanceMetric::EUCLIDEAN ? difference.squaredNorm() : difference.template lpNorm<1>();
+        }
+
+        // Convert a distance to its reduced form
+        double _reduce(const double distance) const
+        {
+            return distance_metric_ == DistanceMetric::EUCLIDEAN ? distance * distance : distance;
+        }
+
+        // Convert a reduced distance back to a distance
+        double _expand(const double reduced_distance) const
+        {
+            return distance_metric_ == DistanceMetric::EUCLIDEAN ? std::sqrt(reduced_distance) : reduced_distance;
+        }
+
+        // Sort candidates by distance and convert them to matches
+        std::vector<Match> _get_matches(std::vector<Candidate> &candidates) const
+        {
+            std::sort(candidates.begin(), candidates.end());
+            std::vector<Match> matches;
+            matches.reserve(candidates.size());
+            for (const Candidate &candidate : candidates)
+            {
+                matches.emplace_back(candidate.second, this->_expand(candidate.first));
+            }
+            return matches;
+        }
+
+        // Split the range `[begin, end)` of `order` at its median along the axis of largest spread and recurse
+        void _build(const math::ColumnVectors<T, D> &values,
+                    std::vector<std::uint32_t> &order,
+                    const std::size_t begin,
+                    const std::size_t end)
+        {
+            if (end - begin <= leaf_size_)
+            {
+                return;
+            }
+            std::uint32_t axis = 0;
+            double max_spread = -1.0;
+            for (std::uint32_t dimension = 0; dimension < D; ++dimension)
+            {
+                T low = values(dimension, order[begin]);
+                T high = low;
+                for (std::size_t idx = begin + 1; idx < end; ++idx)
+                {
+                    low = std::min(low, values(dimension, order[idx]));
+                    high = std::max(high, values(dimension, order[idx]));
+                }
+                const double spread = static_cast<double>(high) - static_cast<double>(low);
+                if (spread > max_spread)
+                {
+                    max_spread = spread;
+                    axis = dimension;
+                }
+            }
+            const std::size_t median = begin + (end - begin) / 2;
+            std::nth_element(order.begin() + begin, order.begin() + median, order.begin() + end,
+                             [&](const std::uint32_t lhs, const std::uint32_t rhs)
+                             { return values(axis, lhs) < values(axis, rhs); });
+            axes_[median] = axis;
+            this->_build(values, order, begin, median);
+            this->_build(values, order, median + 1, end);
+        }
+
+        // Build the tree over node values stored one per column
+        void _initialize(const math::ColumnVectors<T, D> &values)
+        {
+            if (distance_metric_ != DistanceMetric::EUCLIDEAN && distance_metric_ != DistanceMetric::MANHATTAN)
+            {
+                PLOGE << "Unknown distance metric: " << static_cast<int>(distance_metric_);
+                throw std::invalid_argument("Unknown distance metric");
+            }
+            const std::size_t num_values = static_cast<std::size_t>(values.cols());
+            if (num_values > std::numeric_limits<std::uint32_t>::max())
+            {
+                PLOGE << "KdTree can not index " << num_values << " node values";
+                throw std::invalid_argument("KdTree supports at most 2^32 - 1 node values");
+            }
+            ids_.resize(num_values);
+            for (std::size_t idx = 0; idx < num_values; ++idx)
+            {
+                ids_[idx] = static_cast<std::uint32_t>(idx);
+            }
+            axes_.assign(num_values, 0);
+            this->_build(values, ids_, 0, num_values);
+            points_.resize(D, static_cast<Eigen::Index>(num_values));
+            for (std::size_t idx = 0; idx < num_values; ++idx)
+            {
+                points_.col(idx) = values.col(ids_[idx]);
+            }
+        }
+
+        // Visit the range `[begin, end)` nearest half first, skipping the far half when the splitting plane is farther than
+        // `bound` - `offer(index, reduced_distance)` is called for every value visited and may shrink `bound`
+        template <typename F>
+        void _visit(const std::size_t begin,
+                    const std::size_t end,
+                    const Query &query,
+                    const double &bound,
+                    F &&offer) const
+        {
+            if (end - begin <= leaf_size_)
+            {
+                for (std::size_t idx = begin; idx < end; ++idx)
+                {
+                    offer(idx, this->_get_reduced_distance(idx, query));
+                }
+                return;
+            }
+            const std::size_t median = begin + (end - begin) / 2;
+            const std::uint32_t axis = axes_[median];
+            const double difference = query[axis] - static_cast<double>(points_(axis, median));
+            const bool lower_first = difference < 0.0;
+            this->_visit(lower_first ? begin : median + 1, lower_first ? median : end, query, bound, offer);
+            offer(median, this->_get_reduced_distance(median, query));
+            if (this->_reduce(std::abs(difference)) <= bound)
+            {
+                this->_visit(lower_first ? median + 1 : begin, lower_first ? end : median, query, bound, offer);
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new KdTree object over node values - the id of `values[i]` is `i`.
+         * @param values node values.
+         * @param distance_metric distance metric - default is Euclidean.
+         * @param leaf_size maximum number of values scanned linearly at a leaf - default is 8.
+         */
+        explicit KdTree(const std::vector<NodeValue<T, D>> &values,
+                        const DistanceMetric distance_metric = DistanceMetric::EUCLIDEAN,
+                        const std::size_t leaf_size = 8)
+            : distance_metric_(distance_metric),
+              leaf_size_(std::max<std::size_t>(leaf_size, 1))
+        {
+            PLOGD << "Initializing KdTree object over " << values.size() << " node values";
+            math::ColumnVectors<T, D> columns(D, static_cast<Eigen::Index>(values.size()));
+            for (std::size_t idx = 0; idx < values.size(); ++idx)
+            {
+                columns.col(idx) = values[idx].value;
+            }
+            this->_initialize(columns);
+        }
+
+        /**
+         * @brief Construct a new KdTree object over the node values of an environment - match ids are node ids.
+         * @tparam E Environment type.
+         * @param env initialized environment.
+         * @param distance_metric distance metric - default is Euclidean.
+         * @param leaf_size maximum number of values scanned linearly at a leaf - default is 8.
+         */
+        template <typename E>
+            requires(IndexedEnvironment<E, T, D>)
+        explicit KdTree(const E &env,
+                        const DistanceMetric distance_metric = DistanceMetric::EUCLIDEAN,
+                        const std::size_t leaf_size = 8)
+            : distance_metric_(distance_metric),
+              leaf_size_(std::max<std::size_t>(leaf_size, 1))
+        {
+            const std::size_t num_nodes = env.get_num_nodes();
+            PLOGD << "Initializing KdTree object over " << num_nodes << " environment nodes";
+            math::ColumnVectors<T, D> columns(D, static_cast<Eigen::Index>(num_nodes));
+            for (std::size_t idx = 0; idx < num_nodes; ++idx)
+            {
+                const NodeValue<T, D> &node_value = env.get_node_value(static_cast<std::uint32_t>(idx));
+                columns.col(idx) = node_value.value;
+            }
+            this->_initialize(columns);
+        }
+
+        /**
+         * @brief Destroy the KdTree object.
+         */
+        ~KdTree()
+        {
+            PLOGD << "Destroying KdTree object";
+        }
+
+        /**
+         * @brief Get the number of indexed node values.
+         * @return std::size_t number of node values.
+         */
+        std::size_t size() const
+        {
+            return ids_.size();
+        }
+
+        /**
+         * @brief Get the distance metric.
+         * @return DistanceMetric distance metric.
+         */
+        DistanceMetric get_distance_metric() const
+        {
+            return distance_metric_;
+        }
+
+        /**
+         * @brief Find the node value closest to a point.
+         * @param point query coordinates.
+         * @return std::pair<std::uint32_t, double> id of the closest node value and its distance.
+         */
+        Match nearest(const Query &point) const
+        {
+            if (ids_.empty())
+            {
+                PLOGE << "Nearest neighbor query on an empty KdTree";
+                throw std::out_of_range("KdTree is empty");
+            }
+            Candidate best{std::numeric_limits<double>::infinity(), std::numeric_limits<std::uint32_t>::max()};
+            this->_visit(0, ids_.size(), point, best.first, [&](const std::size_t index, const double reduced_distance)
+                         {
+                const Candidate candidate{reduced_distance, ids_[index]};
+                if (candidate < best)
+                {
+                    best = candidate;
+                } });
+            return {best.second, this->_expand(best.first)};
+        }
+
+        /**
+         * @brief Find the node value closest to a node value.
+         * @param node_value query node value.
+         * @return std::pair<std::uint32_t, double> id of the closest node value and its distance.
+         */
+        Match nearest(const NodeValue<T, D> &node_value) const
+        {
+            return this->nearest(node_value.value.template cast<double>().eval());
+        }
+
+        /**
+         * @brief Find the `k` node values closest to a point.
+         * @param point query coordinates.
+         * @param k number of node values.
+         * @return std::vector<std::pair<std::uint32_t, double>> ids and distances of the `min(k, size())` closest node
+         * values, closest first.
+         */
+        std::vector<Match> k_nearest(const Query &point, const std::size_t k) const
+        {
+            std::vector<Candidate> heap;
+            if (k == 0)
+            {
+                return {};
+            }
+            heap.reserve(std::min(k, ids_.size()));
+            double bound = std::numeric_limits<double>::infinity();
+            this->_visit(0, ids_.size(), point, bound, [&](const std::size_t index, const double reduced_distance)
+                         {
+                const Candidate candidate{reduced_distance, ids_[index]};
+                if (heap.size() < k)
+                {
+                    heap.push_back(candidate);
+                    std::push_heap(heap.begin(), heap.end());
+                }
+                else if (candidate < heap.front())
+                {
+                    std::pop_heap(heap.begin(), heap.end());
+                    heap.back() = candidate;
+                    std::push_heap(heap.begin(), heap.end());
+                }
+                if (heap.size() == k)
+                {
+                    bound = heap.front().first;
+                } });
+            return this->_get_matches(heap);
+        }
+
+        /**
+         * @brief Find the `k` node values closest to a node value.
+         * @param node_value query node value.
+         * @param k number of node values.
+         * @return std::vector<std::pair<std::uint32_t, double>> ids and distances of the closest node values, closest first.
+         */
+        std::vector<Match> k_nearest(const NodeValue<T, D> &node_value, const std::size_t k) const
+        {
+            return this->k_nearest(node_value.value.template cast<double>().eval(), k);
+        }
+
+        /**
+         * @brief Find every node value within `radius` of a point (inclusive).
+         * @param point query coordinates.
+         * @param radius search radius.
+         * @return std::vector<std::pair<std::uint32_t, double>> ids and distances of the node values, closest first.
+         */
+        std::vector<Match> radius_search(const Query &point, const double radius) const
+        {
+            std::vector<Candidate> candidates;
+            if (radius < 0.0)
+            {
+                return {};
+            }
+            const double bound = this->_reduce(radius);
+            this->_visit(0, ids_.size(), point, bound, [&](const std::size_t index, const double reduced_distance)
+                         {
+                if (reduced_distance <= bound)
+                {
+                    candidates.emplace_back(reduced_distance, ids_[index]);
+                } });
+            return this->_get_matches(candidates);
+        }
+
+        /**
+         * @brief Find every node value within `radius` of a node value (inclusive).
+         * @param node_value query node value.
+         * @param radius search radius.
+         * @return std::vector<std::pair<std::uint32_t, double>> ids and distances of the node values, closest first.
+         */
+        std::vector<Match> radius_search(const NodeValue<T, D> &node_value, const double radius) const
+        {
+            return this->radius_search(node_value.value.template cast<double>().eval(), radius);
+        }
+
+        /**
+         * @brief Find the node value closest to every point of a batch, splitting the batch across threads.
+         * @param points query coordinates - one column per query.
+         * @param num_threads maximum number of threads - default is the hardware concurrency.
+         * @return std::vector<std::pair<std::uint32_t, double>> closest node value of every query, in query order.
+         */
+        std::vector<Match> nearest_batch(const Queries &points,
+                                         const std::size_t num_threads = std::thread::hardware_concurrency()) const
+        {
+            std::vector<Match> matches(static_cast<std::size_t>(points.cols()));
+            parallel_for(matches.size(), num_threads, [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                         {
+                for (std::size_t idx = begin; idx < end; ++idx)
+                {
+                    matches[idx] = this->nearest(points.col(idx).eval());
+                } }, 256);
+            return matches;
+        }
+
+        /**
+         * @brief Find the `k` node values closest to every point of a batch, splitting the batch across threads.
+         * @param points query coordinates - one column per query.
+         * @param k number of node values per query.
+         * @param num_threads maximum number of threads - default is the hardware concurrency.
+         * @return std::vector<std::vector<std::pair<std::uint32_t, double>>> closest node values of every query, in query order.
+         */
+        std::vector<std::vector<Match>> k_nearest_batch(const Queries &points,
+                                                        const std::size_t k,
+                                                        const std::size_t num_threads = std::thread::hardware_concurrency()) const
+        {
+            std::vector<std::vector<Match>> matches(static_cast<std::size_t>(points.cols()));
+            parallel_for(matches.size(), num_threads, [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                         {
+                for (std::size_t idx = begin; idx < end; ++idx)
+                {
+                    matches[idx] = this->k_nearest(points.col(idx).eval(), k);
+                } }, 256);
+            return matches;
+        }
+
+        /**
+         * @brief Find every node value within `radius` of every point of a batch, splitting the batch across threads.
+         * @param points query coordinates - one column per query.
+         * @param radius search radius.
+         * @param num_threads maximum number of threads - default is the hardware concurrency.
+         * @return std::vector<std::vector<std::pair<std::uint32_t, double>>> node values within the radius of every query, in query order.
+         */
+        std::vector<std::vector<Match>> radius_search_batch(const Queries &points,
+                                                            const double radius,
+                                                            const std::size_t num_threads = std::thread::hardware_concurrency()) const
+        {
+            std::vector<std::vector<Match>> matches(static_cast<std::size_t>(points.cols()));
+            parallel_for(matches.size(), num_threads, [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                         {
+                for (std::size_t idx = begin; idx < end; ++idx)
+                {
+                    matches[idx] = this->radius_search(points.col(idx).eval(), radius);
+                } }, 256);
+            return matches;
+        }
+    };
+
+} // namespace search
+
+#endif // SEARCH_SPATIAL_KD_TREE_H
@@ -0,0 +1,125 @@
+#ifndef SEARCH_TEST_A_STAR_H
+#define SEARCH_TEST_A_STAR_H
+
+/**
+ * @file a_star_test.h
+ * @brief Contains the declarations for testing A*. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <search/cost/default_cost.h>
+#include <search/cost/distance_cost.h>
+#include <search/environment/graph.h>
+#include <search/environment/csr_graph.h>
+
+namespace search
+{
+
+    namespace search_a_star_tests
+    {
+        struct AStarTestParameters
+        {
+            const utils::DistanceMetric distance_metric; // Metric of the edge costs and of the heuristic
+            const double epsilon;                        // Heuristic inflation factor
+            const std::size_t goal_node_index;           // Index of the goal node (the start is node 0)
+        };
+
+        /**
+         * @class AStarTest
+         * @brief This class is a test fixture for testing the A* algorithm.
+         * It sets up an 8-connected 2D grid graph with a wall and compares A* against UCS.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class AStarTest : public ::testing::TestWithParam<AStarTestParameters>
+        {
+        protected:
+            using T = double;
+            static constexpr unsigned int D = 2;
+
+            static constexpr std::size_t width = 20;  // Width of the grid
+            static constexpr std::size_t height = 20; // Height of the grid
+
+            double a_star_cost = 0.0; // Cost of the path found by A*
+            double ucs_cost = 0.0;    // Cost of the path found by UCS
+            bool valid_path = true;   // Whether every step of the A* path is an edge of the graph
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                AStarTestParameters props = GetParam();
+                // Make nodes on a grid
+                std::vector<std::unique_ptr<Node<T, D>>> nodes;
+                for (std::size_t y = 0; y < height; ++y)
+                {
+                    for (std::size_t x = 0; x < width; ++x)
+                    {
+                        NodeValue<T, D> node_value;
+                        node_value.value << static_cast<T>(x), static_cast<T>(y);
+                        nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(y * width + x)));
+                    }
+                }
+                // Connect the grid, leaving a wall at x = width / 2 open only at the top row
+                std::vector<std::pair<std::size_t, std::size_t>> edges;
+                const auto blocked = [](const std::size_t x, const std::size_t y)
+                { return x == width / 2 && y > 0; };
+                for (std::size_t y = 0; y < height; ++y)
+                {
+                    for (std::size_t x = 0; x < width; ++x)
+                    {
+                        for (int dy = -1; dy <= 1; ++dy)
+                        {
+                            for (int dx = -1; dx <= 1; ++dx)
+                            {
+                                const long nx = static_cast<long>(x) + dx;
+                                const long ny = static_cast<long>(y) + dy;
+                                if ((dx == 0 && dy == 0) || nx < 0 || ny < 0 || nx >= static_cast<long>(width) || ny >= static_cast<long>(height))
+                                {
+                                    continue;
+                                }
+                                if (blocked(x, y) || blocked(nx, ny))
+                                {
+                                    continue;
+                                }
+                                edges.emplace_back(y * width + x, ny * width + nx);
+                            }
+                        }
+                    }
+                }
+                // Set cost function
+                DistanceCost<T, D> cost_function = DistanceCost<T, D>(props.distance_metric);
+                // Create the graph with the nodes and edges
+                Graph<T, D> graph_evn = Graph<T, D>(nodes, edges, cost_function);
+                // Initialize the graph environment
+                graph_evn.initialize();
+                const Node<T, D> &start_node = *graph_evn.get_node(0);
+                const Node<T, D> &goal_node = *graph_evn.get_node(props.goal_node_index);
+                // Run A* and UCS
+                std::vector<std::pair<const Node<T, D> *, double>> path;
+                if (props.distance_metric == utils::DistanceMetric::EUCLIDEAN)
+                {
+                    path = AStar<T, D, Graph<T, D>, EuclideanHeuristic<T, D>>(EuclideanHeuristic<T, D>(), props.epsilon).search(start_node, goal_node, graph_evn);
+                }
+                else
+                {
+                    path = AStar<T, D, Graph<T, D>, ManhattanHeuristic<T, D>>(ManhattanHeuristic<T, D>(), props.epsilon).search(start_node, goal_node, graph_evn);
+                }
+                std::vector<std::pair<const Node<T, D> *, double>> ucs_path = graph_evn.search(start_node, goal_node, utils::SearchAlgorithm::UCS);
+                // Store the result
+                a_star_cost = path.empty() ? -1.0 : path.back().second;
+                ucs_cost = ucs_path.empty() ? -1.0 : ucs_path.back().second;
+                for (std::size_t idx = 1; idx < path.size(); ++idx)
+                {
+                    const double step = (path[idx].first->get_node_value().value - path[idx - 1].first->get_node_value().value).cwiseAbs().maxCoeff();
+                    valid_path = valid_path && step == 1.0;
+                }
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_A_STAR_H
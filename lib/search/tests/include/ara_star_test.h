@@ -0,0 +1,54 @@
+#ifndef SEARCH_TEST_ARA_STAR_H
+#define SEARCH_TEST_ARA_STAR_H
+
+/**
+ * @file ara_star_test.h
+ * @brief Contains the declarations for testing ARA* and the cancellation of the searches. Use this to define your helpers.
+ */
+
+#include <memory>
+#include <gtest/gtest.h>
+#include <random_grid_test.h>
+#include <search/search/ara_star.h>
+
+namespace search
+{
+
+    namespace search_ara_star_tests
+    {
+        /**
+         * @class CancellingHeuristic
+         * @brief Euclidean heuristic that cancels a token once it has been evaluated `limit` times - stops a search at a
+         * deterministic point.
+         */
+        struct CancellingHeuristic
+        {
+            CancellationToken *token;                   // Token to cancel
+            std::size_t limit;                          // Number of evaluations before the token is cancelled
+            std::shared_ptr<std::size_t> num_calls;     // Number of evaluations so far - shared by the copies
+
+            double get_heuristic(const NodeValue<int, 2> &from_value, const NodeValue<int, 2> &goal_value) const
+            {
+                if (++*num_calls >= limit)
+                {
+                    token->cancel();
+                }
+                return EuclideanHeuristic<int, 2>().get_heuristic(from_value, goal_value);
+            }
+        };
+
+        using search_random_grid_tests::RandomGridTestParameters;
+
+        /**
+         * @class AraStarTest
+         * @brief This class is a test fixture for testing the ARA* algorithm.
+         * It runs on the random obstacle grid of `RandomGridTest`.
+         */
+        class AraStarTest : public search_random_grid_tests::RandomGridTest
+        {
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_ARA_STAR_H
@@ -0,0 +1,59 @@
+#ifndef SEARCH_TEST_ASYNC_SEARCH_H
+#define SEARCH_TEST_ASYNC_SEARCH_H
+
+/**
+ * @file async_search_test.h
+ * @brief Contains the declarations for testing the work-stealing executor and the asynchronous searches. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <random_graph_test.h>
+#include <search/parallel/executor.h>
+
+namespace search
+{
+
+    namespace search_async_search_tests
+    {
+        struct AsyncSearchTestParameters
+        {
+            const std::size_t num_nodes;   // Number of nodes in the graph
+            const std::size_t num_edges;   // Number of random edges in the graph
+            const std::size_t num_queries; // Number of random queries
+            const std::size_t num_threads; // Number of executor threads
+            const std::uint32_t seed;      // Seed of the graph and query generator
+        };
+
+        /**
+         * @class AsyncSearchTest
+         * @brief This class is a test fixture for testing the asynchronous searches.
+         * It sets up the random 2D graph of `RandomGraphTest` and a list of random queries.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class AsyncSearchTest : public search_random_graph_tests::RandomGraphTest<AsyncSearchTestParameters>
+        {
+        protected:
+            std::vector<std::pair<std::size_t, std::size_t>> queries;          // Start and goal node indices
+            std::unique_ptr<WorkStealingExecutor> executor;                    // Executor running the searches
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                AsyncSearchTestParameters props = GetParam();
+                this->build_graph(props.num_nodes, props.num_edges, props.seed);
+                for (std::size_t i = 0; i < props.num_queries; ++i)
+                {
+                    queries.emplace_back(node_index(generator), node_index(generator));
+                }
+                executor = std::make_unique<WorkStealingExecutor>(props.num_threads);
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_ASYNC_SEARCH_H
@@ -0,0 +1,64 @@
+#ifndef SEARCH_TEST_BATCH_SEARCH_H
+#define SEARCH_TEST_BATCH_SEARCH_H
+
+/**
+ * @file batch_search_test.h
+ * @brief Contains the declarations for testing the batched searches. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <random_graph_test.h>
+#include <search/search/batch_search.h>
+
+namespace search
+{
+
+    namespace search_batch_search_tests
+    {
+        struct BatchSearchTestParameters
+        {
+            const std::size_t num_nodes;   // Number of nodes in the graph
+            const std::size_t num_edges;   // Number of random edges in the graph
+            const std::size_t num_queries; // Number of random queries
+            const std::size_t num_starts;  // Number of distinct start nodes the queries are drawn from
+            const std::size_t num_threads; // Number of threads answering the queries
+            const std::uint32_t seed;      // Seed of the graph and query generator
+        };
+
+        /**
+         * @class BatchSearchTest
+         * @brief This class is a test fixture for testing the batched searches.
+         * It sets up the random 2D graph of `RandomGraphTest` and a list of random queries whose starts repeat.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class BatchSearchTest : public search_random_graph_tests::RandomGraphTest<BatchSearchTestParameters>
+        {
+        protected:
+            std::vector<SearchQuery<T, D>> queries;                            // Start and goal of every query
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                BatchSearchTestParameters props = GetParam();
+                this->build_graph(props.num_nodes, props.num_edges, props.seed);
+                std::vector<std::size_t> starts;
+                for (std::size_t i = 0; i < props.num_starts; ++i)
+                {
+                    starts.push_back(node_index(generator));
+                }
+                std::uniform_int_distribution<std::size_t> start_index(0, props.num_starts - 1);
+                for (std::size_t i = 0; i < props.num_queries; ++i)
+                {
+                    queries.push_back({graph_evn->get_node(starts[start_index(generator)]), this->random_node()});
+                }
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_BATCH_SEARCH_H
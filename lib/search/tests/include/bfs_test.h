@@ -0,0 +1,126 @@
+#ifndef SEARCH_TEST_BFS_H
+#define SEARCH_TEST_BFS_H
+
+/**
+ * @file bfs_test.h
+ * @brief Contains the declarations for testing BFS. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <search/cost/default_cost.h>
+#include <search/environment/graph.h>
+#include <search/environment/csr_graph.h>
+
+namespace search
+{
+
+    namespace search_bfs_tests
+    {
+        struct BfsTestParameters
+        {
+            const std::size_t num_nodes;                                  // Number of nodes in the graph
+            const std::size_t start_node_index;                           // Index of the start node
+            const std::size_t goal_node_index;                            // Index of the goal node
+            const std::vector<std::pair<std::size_t, std::size_t>> edges; // List of edges in the graph
+            const std::vector<std::string> expected_result;               // Expected result of the BFS search
+        };
+
+        /**
+         * @class BfsTest
+         * @brief This class is a test fixture for testing the Breadth First Search (BFS) algorithm.
+         * It sets up a graph with nodes and edges for testing purposes.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class BfsTest : public ::testing::TestWithParam<BfsTestParameters>
+        {
+            using T = int;
+            static constexpr unsigned int D = 1;
+
+        protected:
+            std::vector<std::string> result; // Path found by BFS search with names only for validation
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                BfsTestParameters props = GetParam();
+                // Make nodes
+                std::vector<std::unique_ptr<Node<T, D>>> nodes;
+                for (std::size_t i = 0; i < props.num_nodes; ++i)
+                {
+                    nodes.emplace_back(std::make_unique<Node<T, D>>(NodeValue<T, D>(), std::to_string(i)));
+                }
+                // Set cost function
+                DefaultCost<T, D> cost_function = DefaultCost<T, D>(); // Default cost of 1.0
+                // Create the graph with the nodes and edges
+                Graph<T, D> graph_evn = Graph<T, D>(nodes, props.edges, cost_function);
+                // Initialize the graph environment
+                graph_evn.initialize();
+                // Run BFS search
+                std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn.search(
+                    *graph_evn.get_node(props.start_node_index),
+                    *graph_evn.get_node(props.goal_node_index),
+                    utils::SearchAlgorithm::BFS);
+                // Store the result
+                result.clear();
+                for (std::pair<const Node<T, D> *, double> &node_pair : path)
+                {
+                    result.emplace_back(node_pair.first->get_name());
+                }
+            }
+        };
+
+        /**
+         * @class BfsLargeGraphTest
+         * @brief This class is a test fixture for running BFS on a graph large enough to switch to bottom-up expansion and
+         * split levels across threads.
+         */
+        class BfsLargeGraphTest : public ::testing::Test
+        {
+        protected:
+            using T = int;
+            static constexpr unsigned int D = 1;
+
+            static constexpr std::size_t width = 200;  // Width of the grid shaped graph
+            static constexpr std::size_t height = 200; // Height of the grid shaped graph
+
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;           // Nodes of the graph
+            std::vector<std::pair<std::size_t, std::size_t>> edges; // Edges of the graph (4-connected grid)
+            DefaultCost<T, D> cost_function;                          // Cost function
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                for (std::size_t i = 0; i < width * height; ++i)
+                {
+                    nodes.emplace_back(std::make_unique<Node<T, D>>(NodeValue<T, D>(), std::to_string(i)));
+                }
+                for (std::size_t y = 0; y < height; ++y)
+                {
+                    for (std::size_t x = 0; x < width; ++x)
+                    {
+                        const std::size_t idx = y * width + x;
+                        if (x + 1 < width)
+                        {
+                            edges.emplace_back(idx, idx + 1);
+                            edges.emplace_back(idx + 1, idx);
+                        }
+                        if (y + 1 < height)
+                        {
+                            edges.emplace_back(idx, idx + width);
+                            edges.emplace_back(idx + width, idx);
+                        }
+                    }
+                }
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_BFS_H
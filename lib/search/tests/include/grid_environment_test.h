@@ -0,0 +1,31 @@
+#ifndef SEARCH_TEST_GRID_ENVIRONMENT_H
+#define SEARCH_TEST_GRID_ENVIRONMENT_H
+
+/**
+ * @file grid_environment_test.h
+ * @brief Contains the declarations for testing the GridEnvironment and JPS. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <random_grid_test.h>
+
+namespace search
+{
+
+    namespace search_grid_environment_tests
+    {
+        using search_random_grid_tests::RandomGridTestParameters;
+
+        /**
+         * @class GridEnvironmentTest
+         * @brief This class is a test fixture for testing the GridEnvironment and JPS.
+         * It runs on the random obstacle grid of `RandomGridTest`.
+         */
+        class GridEnvironmentTest : public search_random_grid_tests::RandomGridTest
+        {
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_GRID_ENVIRONMENT_H
@@ -0,0 +1,34 @@
+#ifndef SEARCH_TEST_IDA_STAR_H
+#define SEARCH_TEST_IDA_STAR_H
+
+/**
+ * @file ida_star_test.h
+ * @brief Contains the declarations for testing IDA*. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <random_grid_test.h>
+#include <search/cost/default_cost.h>
+#include <search/environment/graph.h>
+#include <search/search/ida_star.h>
+
+namespace search
+{
+
+    namespace search_ida_star_tests
+    {
+        using search_random_grid_tests::RandomGridTestParameters;
+
+        /**
+         * @class IdaStarTest
+         * @brief This class is a test fixture for testing the IDA* algorithm.
+         * It runs on the random obstacle grid of `RandomGridTest`.
+         */
+        class IdaStarTest : public search_random_grid_tests::RandomGridTest
+        {
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_IDA_STAR_H
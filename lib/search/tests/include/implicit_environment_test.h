@@ -0,0 +1,119 @@
+#ifndef SEARCH_TEST_IMPLICIT_ENVIRONMENT_H
+#define SEARCH_TEST_IMPLICIT_ENVIRONMENT_H
+
+/**
+ * @file implicit_environment_test.h
+ * @brief Contains the declarations for testing the ImplicitEnvironment and the StateTable. Use this to define your helpers.
+ */
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random_grid_test.h>
+#include <search/container/state_table.h>
+#include <search/environment/implicit_environment.h>
+#include <search/search/many_to_many.h>
+
+namespace search
+{
+
+    namespace search_implicit_environment_tests
+    {
+        /**
+         * @struct LatticeGenerator
+         * @brief Successor generator of an 8-connected 2D lattice that mirrors `GridEnvironment` with diagonal moves: cells
+         * outside `[0, width) x [0, height)` or marked in `blocked` are walls, diagonal moves may not cut them, and a move
+         * costs its Euclidean length. A width or height of 0 leaves that axis unbounded.
+         */
+        struct LatticeGenerator
+        {
+            int width = 0;                    // Number of columns - 0 for an unbounded axis
+            int height = 0;                   // Number of rows - 0 for an unbounded axis
+            const std::vector<bool> *blocked; // Blocked cells by row major id - null when none
+
+            bool is_free(const int x, const int y) const
+            {
+                if ((width > 0 && (x < 0 || x >= width)) || (height > 0 && (y < 0 || y >= height)))
+                {
+                    return false;
+                }
+                return blocked == nullptr || !(*blocked)[static_cast<std::size_t>(y * width + x)];
+            }
+
+            template <typename F>
+            void operator()(const math::ColumnVector<int, 2> &state, F &&emit) const
+            {
+                const int x = state(0);
+                const int y = state(1);
+                if (!this->is_free(x, y))
+                {
+                    return;
+                }
+                for (int dy = -1; dy <= 1; ++dy)
+                {
+                    for (int dx = -1; dx <= 1; ++dx)
+                    {
+                        if ((dx != 0 || dy != 0) && this->is_free(x + dx, y + dy) && this->is_free(x + dx, y) && this->is_free(x, y + dy))
+                        {
+                            emit(math::ColumnVector<int, 2>(x + dx, y + dy), std::sqrt(static_cast<double>(dx * dx + dy * dy)));
+                        }
+                    }
+                }
+            }
+        };
+
+        /**
+         * @class ImplicitEnvironmentTest
+         * @brief This class is a test fixture for testing the ImplicitEnvironment.
+         * It sets up a 40 x 30 lattice with the random obstacles of `search_random_grid_tests::make_random_obstacles`, both as
+         * a `GridEnvironment` and as an `ImplicitEnvironment` over `LatticeGenerator`.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class ImplicitEnvironmentTest : public ::testing::Test
+        {
+        protected:
+            using T = int;
+            static constexpr unsigned int D = 2;
+            static constexpr int width = 40;
+            static constexpr int height = 30;
+
+            std::vector<bool> blocked;                                                  // Blocked cells
+            std::unique_ptr<GridEnvironment<T, D>> grid_evn;                            // Reference grid
+            std::unique_ptr<ImplicitEnvironment<T, D, LatticeGenerator>> implicit_evn; // Generated lattice
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                grid_evn = std::make_unique<GridEnvironment<T, D>>(GridEnvironment<T, D>::Coordinates{width, height}, true);
+                blocked = search_random_grid_tests::make_random_obstacles(width, height, 0.25, 3);
+                for (int y = 0; y < height; ++y)
+                {
+                    for (int x = 0; x < width; ++x)
+                    {
+                        grid_evn->set_blocked({static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y)}, blocked[y * width + x]);
+                    }
+                }
+                implicit_evn = std::make_unique<ImplicitEnvironment<T, D, LatticeGenerator>>(LatticeGenerator{width, height, &blocked});
+            }
+
+            /**
+             * @brief Make a node at a lattice position.
+             * @param x column.
+             * @param y row.
+             * @return std::unique_ptr<Node<T, D>> node.
+             */
+            static std::unique_ptr<Node<T, D>> make_node(const int x, const int y)
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << x, y;
+                return std::make_unique<Node<T, D>>(node_value, std::to_string(x) + "," + std::to_string(y));
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_IMPLICIT_ENVIRONMENT_H
@@ -0,0 +1,102 @@
+#ifndef SEARCH_TEST_KD_TREE_H
+#define SEARCH_TEST_KD_TREE_H
+
+/**
+ * @file kd_tree_test.h
+ * @brief Contains the declarations for testing the KdTree. Use this to define your helpers.
+ */
+
+#include <random>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <search/cost/distance_cost.h>
+#include <search/spatial/kd_tree.h>
+
+namespace search
+{
+
+    namespace search_kd_tree_tests
+    {
+        struct KdTreeTestParameters
+        {
+            const std::size_t num_values;                // Number of indexed node values
+            const int max_coordinate;                    // Coordinates are drawn from [-max_coordinate, max_coordinate]
+            const utils::DistanceMetric distance_metric; // Distance metric
+            const std::size_t leaf_size;                 // Maximum number of values in a leaf
+            const std::size_t k;                         // Number of neighbors of the k nearest queries
+            const double radius;                         // Radius of the radius queries
+        };
+
+        /**
+         * @class KdTreeTest
+         * @brief This class is a test fixture for testing the KdTree.
+         * It indexes random integer node values (with many duplicates when the coordinate range is small) and answers random
+         * queries both with the tree and by scanning every value with `DistanceCost`.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class KdTreeTest : public ::testing::TestWithParam<KdTreeTestParameters>
+        {
+        protected:
+            using T = int;
+            static constexpr unsigned int D = 3;
+
+            std::vector<NodeValue<T, D>> values;    // Indexed node values
+            math::ColumnVectors<double, D> queries; // Query coordinates - one column per query
+            std::unique_ptr<KdTree<T, D>> kd_tree;  // Tree under test
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                KdTreeTestParameters props = GetParam();
+                std::mt19937 generator(static_cast<std::uint32_t>(props.num_values));
+                std::uniform_int_distribution<int> coordinate(-props.max_coordinate, props.max_coordinate);
+                for (std::size_t idx = 0; idx < props.num_values; ++idx)
+                {
+                    NodeValue<T, D> value;
+                    value.value << coordinate(generator), coordinate(generator), coordinate(generator);
+                    values.push_back(value);
+                }
+                std::uniform_real_distribution<double> query_coordinate(-1.5 * props.max_coordinate, 1.5 * props.max_coordinate);
+                queries.resize(D, 64);
+                for (Eigen::Index idx = 0; idx < queries.cols(); ++idx)
+                {
+                    queries.col(idx) << query_coordinate(generator), query_coordinate(generator), query_coordinate(generator);
+                }
+                kd_tree = std::make_unique<KdTree<T, D>>(values, props.distance_metric, props.leaf_size);
+            }
+
+            /**
+             * @brief Get every indexed value as an `(id, distance)` match sorted by distance then id, by scanning every value.
+             * @param query query coordinates.
+             * @return std::vector<std::pair<std::uint32_t, double>> sorted matches.
+             */
+            std::vector<std::pair<std::uint32_t, double>> scan(const math::ColumnVector<double, D> &query) const
+            {
+                DistanceCost<double, D> distance_cost = DistanceCost<double, D>(GetParam().distance_metric);
+                NodeValue<double, D> query_value;
+                query_value.value = query;
+                std::vector<std::pair<double, std::uint32_t>> candidates;
+                for (std::size_t idx = 0; idx < values.size(); ++idx)
+                {
+                    NodeValue<double, D> value;
+                    value.value = values[idx].value.template cast<double>();
+                    candidates.emplace_back(distance_cost.get_distance(query_value, value), static_cast<std::uint32_t>(idx));
+                }
+                std::sort(candidates.begin(), candidates.end());
+                std::vector<std::pair<std::uint32_t, double>> matches;
+                for (const std::pair<double, std::uint32_t> &candidate : candidates)
+                {
+                    matches.emplace_back(candidate.second, candidate.first);
+                }
+                return matches;
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_KD_TREE_H
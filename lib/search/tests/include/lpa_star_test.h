@@ -0,0 +1,148 @@
+#ifndef SEARCH_TEST_LPA_STAR_H
+#define SEARCH_TEST_LPA_STAR_H
+
+/**
+ * @file lpa_star_test.h
+ * @brief Contains the declarations for testing LPA* and the graph mutation API. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <search/cost/default_cost.h>
+#include <search/cost/distance_cost.h>
+#include <search/heuristic/heuristic.h>
+#include <search/environment/graph.h>
+#include <search/search/lpa_star.h>
+
+namespace search
+{
+
+    namespace search_lpa_star_tests
+    {
+        enum class EdgeChangeKind
+        {
+            ADD,
+            REMOVE,
+            UPDATE
+        };
+
+        struct EdgeChange
+        {
+            const EdgeChangeKind kind; // Kind of change
+            const std::uint32_t from;  // Source node id
+            const std::uint32_t to;    // Target node id
+            const double cost;         // Cost of the edge (ADD and UPDATE)
+        };
+
+        struct LpaStarTestParameters
+        {
+            const std::size_t goal_node_index;      // Index of the goal node (the start is node 0)
+            const std::vector<EdgeChange> changes;  // Edge changes applied one at a time, each followed by a replan
+        };
+
+        /**
+         * @class LpaStarTest
+         * @brief This class is a test fixture for testing the LPA* algorithm.
+         * It sets up a 4-connected 2D grid graph with precomputed Euclidean edge costs.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class LpaStarTest : public ::testing::TestWithParam<LpaStarTestParameters>
+        {
+        protected:
+            using T = double;
+            static constexpr unsigned int D = 2;
+
+            static constexpr std::size_t width = 20;  // Width of the grid
+            static constexpr std::size_t height = 20; // Height of the grid
+
+            std::vector<std::unique_ptr<Node<T, D>>> nodes; // Nodes of the grid
+            DistanceCost<T, D> cost_function;              // Euclidean edge costs
+            std::unique_ptr<Graph<T, D>> graph_evn;        // Grid graph
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                for (std::size_t y = 0; y < height; ++y)
+                {
+                    for (std::size_t x = 0; x < width; ++x)
+                    {
+                        NodeValue<T, D> node_value;
+                        node_value.value << static_cast<T>(x), static_cast<T>(y);
+                        nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(y * width + x)));
+                    }
+                }
+                std::vector<std::pair<std::size_t, std::size_t>> edges;
+                for (std::size_t y = 0; y < height; ++y)
+                {
+                    for (std::size_t x = 0; x < width; ++x)
+                    {
+                        if (x + 1 < width)
+                        {
+                            edges.emplace_back(y * width + x, y * width + x + 1);
+                            edges.emplace_back(y * width + x + 1, y * width + x);
+                        }
+                        if (y + 1 < height)
+                        {
+                            edges.emplace_back(y * width + x, (y + 1) * width + x);
+                            edges.emplace_back((y + 1) * width + x, y * width + x);
+                        }
+                    }
+                }
+                graph_evn = std::make_unique<Graph<T, D>>(nodes, edges, cost_function);
+                graph_evn->initialize(true);
+            }
+
+            /**
+             * @brief Apply an edge change to the graph.
+             * @param change edge change.
+             */
+            void apply(const EdgeChange &change)
+            {
+                switch (change.kind)
+                {
+                case EdgeChangeKind::ADD:
+                    graph_evn->add_edge(change.from, change.to, change.cost);
+                    break;
+                case EdgeChangeKind::REMOVE:
+                    graph_evn->remove_edge(change.from, change.to);
+                    break;
+                case EdgeChangeKind::UPDATE:
+                    graph_evn->update_edge_cost(change.from, change.to, change.cost);
+                    break;
+                }
+            }
+
+            /**
+             * @brief Check that every step of a path is an edge of the graph and that the costs add up.
+             * @param path path to check.
+             * @return true if the path is valid, false otherwise.
+             */
+            bool is_valid_path(const std::vector<std::pair<const Node<T, D> *, double>> &path) const
+            {
+                for (std::size_t idx = 1; idx < path.size(); ++idx)
+                {
+                    const std::uint32_t from_id = graph_evn->get_node_id(*path[idx - 1].first);
+                    const std::uint32_t to_id = graph_evn->get_node_id(*path[idx].first);
+                    double edge_cost = std::numeric_limits<double>::infinity();
+                    graph_evn->for_each_edge(from_id, [&](const std::uint32_t neighbor_id, const double cost)
+                                             {
+                        if (neighbor_id == to_id)
+                        {
+                            edge_cost = std::min(edge_cost, cost);
+                        } });
+                    if (std::abs(path[idx - 1].second + edge_cost - path[idx].second) > utils::floating_point_precision)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_LPA_STAR_H
@@ -0,0 +1,64 @@
+#ifndef SEARCH_TEST_MANY_TO_MANY_H
+#define SEARCH_TEST_MANY_TO_MANY_H
+
+/**
+ * @file many_to_many_test.h
+ * @brief Contains the declarations for testing the many-to-many distance matrices. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <random_graph_test.h>
+#include <search/search/many_to_many.h>
+
+namespace search
+{
+
+    namespace search_many_to_many_tests
+    {
+        struct ManyToManyTestParameters
+        {
+            const std::size_t num_nodes;   // Number of nodes in the graph
+            const std::size_t num_edges;   // Number of random edges in the graph
+            const std::size_t num_sources; // Number of random sources
+            const std::size_t num_targets; // Number of random targets
+            const std::size_t block_size;  // Side of the Floyd-Warshall tiles
+            const std::size_t num_threads; // Number of threads filling the matrices
+            const std::uint32_t seed;      // Seed of the graph, source and target generator
+        };
+
+        /**
+         * @class ManyToManyTest
+         * @brief This class is a test fixture for testing the many-to-many distance matrices.
+         * It sets up the random 2D graph of `RandomGraphTest` and lists of random sources and targets.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class ManyToManyTest : public search_random_graph_tests::RandomGraphTest<ManyToManyTestParameters>
+        {
+        protected:
+            std::vector<const Node<T, D> *> source_nodes;                      // Sources of the distance matrix (rows)
+            std::vector<const Node<T, D> *> target_nodes;                      // Targets of the distance matrix (columns)
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                ManyToManyTestParameters props = GetParam();
+                this->build_graph(props.num_nodes, props.num_edges, props.seed);
+                for (std::size_t i = 0; i < props.num_sources; ++i)
+                {
+                    source_nodes.push_back(this->random_node());
+                }
+                for (std::size_t i = 0; i < props.num_targets; ++i)
+                {
+                    target_nodes.push_back(this->random_node());
+                }
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_MANY_TO_MANY_H
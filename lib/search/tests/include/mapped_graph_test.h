@@ -0,0 +1,125 @@
+#ifndef SEARCH_TEST_MAPPED_GRAPH_H
+#define SEARCH_TEST_MAPPED_GRAPH_H
+
+/**
+ * @file mapped_graph_test.h
+ * @brief Contains the declarations for testing the memory mapped graph environment. Use this to define your helpers.
+ */
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <search/cost/distance_cost.h>
+#include <search/environment/graph.h>
+#include <search/environment/mapped_graph.h>
+
+namespace search
+{
+
+    namespace search_mapped_graph_tests
+    {
+        struct MappedGraphTestParameters
+        {
+            const utils::SearchAlgorithm search_algorithm; // Search algorithm to run on both graphs
+            const bool write_edge_costs;                   // Whether the file stores the edge costs
+            const std::size_t goal_node_index;             // Index of the goal node (the start is node 0)
+        };
+
+        /**
+         * @class MappedGraphTest
+         * @brief This class is a test fixture for testing the memory mapped graph environment.
+         * It writes a 2D grid graph to a graph file, maps it back and runs the same search on both.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class MappedGraphTest : public ::testing::TestWithParam<MappedGraphTestParameters>
+        {
+        protected:
+            using T = float;
+            static constexpr unsigned int D = 2;
+
+            static constexpr std::size_t width = 12;  // Width of the grid
+            static constexpr std::size_t height = 9;  // Height of the grid
+
+            std::string path;                    // Path of the graph file
+            std::vector<std::string> result;     // Names along the path found on the mapped graph
+            std::vector<std::string> expected;   // Names along the path found on the in memory graph
+            double cost = 0.0;                   // Cost of the path found on the mapped graph
+            double expected_cost = 0.0;          // Cost of the path found on the in memory graph
+            std::size_t num_materialized = 0;    // Number of nodes materialized by the mapped graph
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                MappedGraphTestParameters props = GetParam();
+                path = ::testing::TempDir() + "mapped_graph_test_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + ".graph";
+                // Make nodes on a grid
+                std::vector<std::unique_ptr<Node<T, D>>> nodes;
+                for (std::size_t y = 0; y < height; ++y)
+                {
+                    for (std::size_t x = 0; x < width; ++x)
+                    {
+                        NodeValue<T, D> node_value;
+                        node_value.value << static_cast<T>(x), static_cast<T>(y * y);
+                        nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, "n" + std::to_string(y * width + x)));
+                    }
+                }
+                // Connect every node to its right and lower neighbor, and back
+                std::vector<std::pair<std::size_t, std::size_t>> edges;
+                for (std::size_t y = 0; y < height; ++y)
+                {
+                    for (std::size_t x = 0; x < width; ++x)
+                    {
+                        const std::size_t id = y * width + x;
+                        if (x + 1 < width)
+                        {
+                            edges.emplace_back(id, id + 1);
+                            edges.emplace_back(id + 1, id);
+                        }
+                        if (y + 1 < height)
+                        {
+                            edges.emplace_back(id, id + width);
+                            edges.emplace_back(id + width, id);
+                        }
+                    }
+                }
+                DistanceCost<T, D> cost_function = DistanceCost<T, D>(utils::DistanceMetric::EUCLIDEAN);
+                Graph<T, D> graph_evn = Graph<T, D>(nodes, edges, cost_function);
+                graph_evn.initialize();
+                write_graph_file<T, D>(path, graph_evn, props.write_edge_costs);
+                std::vector<std::pair<const Node<T, D> *, double>> expected_path = graph_evn.search(
+                    *graph_evn.get_node(0), *graph_evn.get_node(props.goal_node_index), props.search_algorithm);
+                // Map the file back and run the same search
+                MappedGraph<T, D> mapped_graph_evn = props.write_edge_costs ? MappedGraph<T, D>(path) : MappedGraph<T, D>(path, cost_function);
+                mapped_graph_evn.initialize();
+                std::vector<std::pair<const Node<T, D> *, double>> path_found = mapped_graph_evn.search(
+                    *mapped_graph_evn.get_node(0), *mapped_graph_evn.get_node(props.goal_node_index), props.search_algorithm);
+                // Store the result
+                for (const std::pair<const Node<T, D> *, double> &node_pair : expected_path)
+                {
+                    expected.emplace_back(node_pair.first->get_name());
+                }
+                for (const std::pair<const Node<T, D> *, double> &node_pair : path_found)
+                {
+                    result.emplace_back(node_pair.first->get_name());
+                }
+                expected_cost = expected_path.empty() ? -1.0 : expected_path.back().second;
+                cost = path_found.empty() ? -1.0 : path_found.back().second;
+                num_materialized = mapped_graph_evn.get_num_materialized_nodes();
+            }
+
+            /**
+             * @brief Tear down the test fixture.
+             */
+            void TearDown() override
+            {
+                std::remove(path.c_str());
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_MAPPED_GRAPH_H
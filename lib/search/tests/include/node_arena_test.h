@@ -0,0 +1,157 @@
+#ifndef SEARCH_TEST_NODE_ARENA_H
+#define SEARCH_TEST_NODE_ARENA_H
+
+/**
+ * @file node_arena_test.h
+ * @brief Contains the declarations for testing the NodeArena and memory resource support. Use this to define your helpers.
+ */
+
+#include <array>
+#include <memory_resource>
+#include <gtest/gtest.h>
+#include <search/cost/default_cost.h>
+#include <search/environment/graph.h>
+#include <search/node/node_arena.h>
+
+namespace search
+{
+
+    namespace search_node_arena_tests
+    {
+        struct NodeArenaTestParameters
+        {
+            const std::size_t num_nodes;                                   // Number of nodes in the graph
+            const std::size_t start_node_index;                            // Index of the start node
+            const std::size_t goal_node_index;                             // Index of the goal node
+            const std::vector<std::pair<std::size_t, std::size_t>> edges; // List of edges in the graph
+            const std::vector<std::string> expected_result;                // Expected result of the DFS search
+        };
+
+        /**
+         * @class CountingResource
+         * @brief Memory resource that forwards to an upstream resource and counts the allocations.
+         */
+        class CountingResource : public std::pmr::memory_resource
+        {
+        public:
+            std::pmr::memory_resource *upstream;   // Resource the allocations are forwarded to
+            std::size_t num_allocations = 0;       // Number of allocations
+
+            explicit CountingResource(std::pmr::memory_resource *upstream) : upstream(upstream) {}
+
+        private:
+            void *do_allocate(std::size_t bytes, std::size_t alignment) override
+            {
+                ++num_allocations;
+                return upstream->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+            {
+                upstream->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+            {
+                return this == &other;
+            }
+        };
+
+        /**
+         * @class NeighborListEnvironment
+         * @brief Environment without node ids - searched over the node neighbor lists.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        template <typename T, unsigned int D>
+        class NeighborListEnvironment : public Environment<T, D>
+        {
+        public:
+            void initialize() override {}
+
+            // The override has to repeat the `const double` return type of `Environment::get_cost`
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+            const double get_cost(const Node<T, D> &, const Node<T, D> &) const override
+            {
+                return 1.0;
+            }
+#pragma GCC diagnostic pop
+
+            const std::vector<std::pair<const Node<T, D> *, double>> search(
+                const Node<T, D> &start_node,
+                const Node<T, D> &goal_node,
+                utils::SearchAlgorithm) const override
+            {
+                return DFS<T, D, NeighborListEnvironment<T, D>>().search(start_node, goal_node, *this);
+            }
+
+            const std::vector<std::pair<const Node<T, D> *, double>> search(
+                const Node<T, D> &start_node,
+                const Node<T, D> &goal_node,
+                utils::SearchAlgorithm,
+                SearchWorkspace &workspace) const override
+            {
+                return DFS<T, D, NeighborListEnvironment<T, D>>().search(start_node, goal_node, *this, workspace);
+            }
+        };
+
+        /**
+         * @class NodeArenaTest
+         * @brief This class is a test fixture for testing the NodeArena and memory resource support.
+         * It creates the nodes of a graph in an arena carved from a fixed buffer, builds the graph in the arena and runs
+         * DFS with a workspace backed by a monotonic buffer - running out of either buffer throws `std::bad_alloc`.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class NodeArenaTest : public ::testing::TestWithParam<NodeArenaTestParameters>
+        {
+            using T = int;
+            static constexpr unsigned int D = 1;
+
+        protected:
+            std::vector<std::string> result;           // Path found by DFS search with names only for validation
+            std::vector<std::size_t> neighbor_counts;  // Number of neighbors of every node
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                NodeArenaTestParameters props = GetParam();
+                // Make nodes in an arena that can not grow past a fixed buffer
+                std::array<std::byte, 64 * 1024> arena_buffer;
+                std::pmr::monotonic_buffer_resource arena_upstream(arena_buffer.data(), arena_buffer.size(), std::pmr::null_memory_resource());
+                NodeArena<T, D> arena(4 * 1024, &arena_upstream);
+                arena.reserve(props.num_nodes);
+                for (std::size_t i = 0; i < props.num_nodes; ++i)
+                {
+                    arena.create(NodeValue<T, D>{math::ColumnVector<T, D>::Constant(static_cast<T>(i))}, std::to_string(i), utils::NodeIdentity::DENSE);
+                }
+                // Set cost function
+                DefaultCost<T, D> cost_function = DefaultCost<T, D>(); // Default cost of 1.0
+                // Create the graph in the arena
+                Graph<T, D> graph_evn = Graph<T, D>(arena.get_pointers(), props.edges, cost_function, arena.get_memory_resource());
+                graph_evn.initialize();
+                for (std::size_t i = 0; i < props.num_nodes; ++i)
+                {
+                    neighbor_counts.push_back(arena[i]->get_neighbors().size());
+                }
+                // Search with a workspace that can not grow past a fixed buffer
+                std::array<std::byte, 16 * 1024> query_buffer;
+                std::pmr::monotonic_buffer_resource query_resource(query_buffer.data(), query_buffer.size(), std::pmr::null_memory_resource());
+                SearchWorkspace workspace(&query_resource);
+                const std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn.search(
+                    *arena[props.start_node_index], *arena[props.goal_node_index], utils::SearchAlgorithm::DFS, workspace);
+                for (const std::pair<const Node<T, D> *, double> &node : path)
+                {
+                    result.push_back(node.first->get_name());
+                }
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_NODE_ARENA_H
@@ -0,0 +1,58 @@
+#ifndef SEARCH_TEST_NODE_FACTORY_H
+#define SEARCH_TEST_NODE_FACTORY_H
+
+/**
+ * @file node_factory_test.h
+ * @brief Contains the declarations for testing the parallel node factory. Use this to define your helpers.
+ */
+
+#include <set>
+#include <gtest/gtest.h>
+#include <search/node/node_factory.h>
+
+namespace search
+{
+
+    namespace search_node_factory_tests
+    {
+        struct NodeFactoryTestParameters
+        {
+            const std::size_t count;             // Number of nodes to make
+            const utils::NodeIdentity identity;  // Identity policy of the nodes
+            const std::size_t num_threads;       // Number of threads used to make the nodes
+        };
+
+        /**
+         * @class NodeFactoryTest
+         * @brief This class is a test fixture for testing the parallel node factory.
+         * It makes a block of nodes whose value is their index.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class NodeFactoryTest : public ::testing::TestWithParam<NodeFactoryTestParameters>
+        {
+        protected:
+            using T = long;
+            static constexpr unsigned int D = 1;
+
+            NodeBlock<T, D> nodes; // Nodes made by the factory
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                NodeFactoryTestParameters props = GetParam();
+                nodes = make_nodes<T, D>(props.count, [](const std::size_t idx)
+                                         {
+                    NodeValue<T, D> node_value;
+                    node_value.value << static_cast<T>(idx);
+                    return node_value; }, props.identity, props.num_threads);
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_NODE_FACTORY_H
@@ -0,0 +1,77 @@
+#ifndef SEARCH_TEST_NODE_STORE_H
+#define SEARCH_TEST_NODE_STORE_H
+
+/**
+ * @file node_store_test.h
+ * @brief Contains the declarations for testing the NodeStore. Use this to define your helpers.
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <search/cost/distance_cost.h>
+#include <search/node/node_store.h>
+#include <search/heuristic/distance_heuristic.h>
+#include <search/environment/csr_graph.h>
+
+namespace search
+{
+
+    namespace search_node_store_tests
+    {
+        struct NodeStoreTestParameters
+        {
+            const std::vector<std::array<int, 3>> node_values; // Value of every node in the store
+            const std::array<int, 3> from_value;               // Value to measure from
+            const utils::DistanceMetric distance_metric;       // Distance metric
+        };
+
+        /**
+         * @class NodeStoreTest
+         * @brief This class is a test fixture for testing the NodeStore.
+         * It fills a store with node values and computes the distances with the bulk kernels and with `DistanceCost`.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class NodeStoreTest : public ::testing::TestWithParam<NodeStoreTestParameters>
+        {
+            using T = int;
+            static constexpr unsigned int D = 3;
+
+        protected:
+            std::vector<double> distances;          // Distances computed by the one-to-many sweep
+            std::vector<double> gathered_distances; // Distances computed by the gather kernel in reverse order
+            std::vector<double> expected_distances; // Distances computed one by one by `DistanceCost`
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                NodeStoreTestParameters props = GetParam();
+                // Fill the store one value at a time so it has to grow
+                NodeStore<T, D> store;
+                NodeValue<T, D> from_value;
+                from_value.value << props.from_value[0], props.from_value[1], props.from_value[2];
+                DistanceCost<T, D> distance_cost = DistanceCost<T, D>(props.distance_metric);
+                std::vector<std::uint32_t> indices;
+                for (const std::array<int, 3> &value : props.node_values)
+                {
+                    NodeValue<T, D> node_value;
+                    node_value.value << value[0], value[1], value[2];
+                    indices.insert(indices.begin(), store.add(node_value).index);
+                    expected_distances.emplace_back(distance_cost.get_distance(from_value, node_value));
+                }
+                // Run the kernels
+                distances.resize(store.size());
+                store.get_distances(from_value.value, props.distance_metric, distances);
+                gathered_distances.resize(indices.size());
+                store.get_distances(from_value.value, props.distance_metric, indices, gathered_distances);
+                std::reverse(gathered_distances.begin(), gathered_distances.end());
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_NODE_STORE_H
@@ -0,0 +1,57 @@
+#ifndef SEARCH_TEST_NODE_H
+#define SEARCH_TEST_NODE_H
+
+/**
+ * @file node_test.h
+ * @brief Contains the declarations for testing the Node. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <search/cost/default_cost.h>
+#include <search/environment/graph.h>
+
+namespace search
+{
+
+    namespace search_node_tests
+    {
+        struct NodeTestParameters
+        {
+            const utils::NodeIdentity identity; // Identity policy of the nodes
+            const std::string name;             // Name given to the nodes
+        };
+
+        /**
+         * @class NodeTest
+         * @brief This class is a test fixture for testing the Node identity policies.
+         * It creates two nodes and a copy of the first one with the given identity policy and name.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class NodeTest : public ::testing::TestWithParam<NodeTestParameters>
+        {
+        protected:
+            using T = int;
+            static constexpr unsigned int D = 2;
+
+            std::unique_ptr<Node<T, D>> first_node;  // First node
+            std::unique_ptr<Node<T, D>> second_node; // Second node
+            std::unique_ptr<Node<T, D>> copied_node; // Copy of the first node
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                NodeTestParameters props = GetParam();
+                first_node = std::make_unique<Node<T, D>>(NodeValue<T, D>(), props.name, props.identity);
+                second_node = std::make_unique<Node<T, D>>(NodeValue<T, D>(), props.name, props.identity);
+                copied_node = std::make_unique<Node<T, D>>(*first_node);
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_NODE_H
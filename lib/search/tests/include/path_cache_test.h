@@ -0,0 +1,83 @@
+#ifndef SEARCH_TEST_PATH_CACHE_H
+#define SEARCH_TEST_PATH_CACHE_H
+
+/**
+ * @file path_cache_test.h
+ * @brief Contains the declarations for testing the PathCache. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <search/cost/default_cost.h>
+#include <search/cost/distance_cost.h>
+#include <search/environment/graph.h>
+#include <search/cache/path_cache.h>
+
+namespace search
+{
+
+    namespace search_path_cache_tests
+    {
+        /**
+         * @class PathCacheTest
+         * @brief This class is a test fixture for testing the PathCache.
+         * It builds a `size x size` lattice graph connected to the right and upwards with Euclidean edge costs.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class PathCacheTest : public ::testing::Test
+        {
+        protected:
+            using T = double;
+            static constexpr unsigned int D = 2;
+            static constexpr int size = 8;
+
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;                        // Lattice nodes
+            DistanceCost<T, D> distance_cost = DistanceCost<T, D>(utils::DistanceMetric::EUCLIDEAN); // Euclidean edge costs
+            DefaultCost<T, D> default_cost = DefaultCost<T, D>();                  // Unit edge costs
+            std::unique_ptr<Graph<T, D>> graph_evn;                                // Lattice graph
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                std::vector<std::pair<std::size_t, std::size_t>> edges;
+                for (int y = 0; y < size; ++y)
+                {
+                    for (int x = 0; x < size; ++x)
+                    {
+                        NodeValue<T, D> node_value;
+                        node_value.value << 2.0 * x, y;
+                        nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(y * size + x)));
+                        const std::size_t id = static_cast<std::size_t>(y * size + x);
+                        if (x + 1 < size)
+                        {
+                            edges.emplace_back(id, id + 1);
+                        }
+                        if (y + 1 < size)
+                        {
+                            edges.emplace_back(id, id + size);
+                        }
+                    }
+                }
+                graph_evn = std::make_unique<Graph<T, D>>(nodes, edges, distance_cost);
+                graph_evn->initialize();
+            }
+
+            /**
+             * @brief Get the node at a lattice position.
+             * @param x column.
+             * @param y row.
+             * @return const Node<T, D>& node.
+             */
+            const Node<T, D> &at(const int x, const int y) const
+            {
+                return *graph_evn->get_node(static_cast<std::size_t>(y * size + x));
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_PATH_CACHE_H
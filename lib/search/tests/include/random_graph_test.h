@@ -0,0 +1,83 @@
+#ifndef SEARCH_TEST_RANDOM_GRAPH_H
+#define SEARCH_TEST_RANDOM_GRAPH_H
+
+/**
+ * @file random_graph_test.h
+ * @brief Contains the random 2D graph shared by the tests of the graph searches. Use this to define your helpers.
+ */
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <search/cost/distance_cost.h>
+#include <search/environment/graph.h>
+
+namespace search
+{
+
+    namespace search_random_graph_tests
+    {
+        /**
+         * @class RandomGraphTest
+         * @brief This class is a test fixture shared by the tests of the graph searches - derive a fixture per search engine
+         * and call `build_graph` from its `SetUp`.
+         * It sets up a random 2D graph whose edge costs are the Euclidean distance between the node values, and keeps the
+         * generator so the derived fixture can draw its queries from the same seed.
+         * @tparam P Parameters of the derived fixture.
+         */
+        template <typename P>
+        class RandomGraphTest : public ::testing::TestWithParam<P>
+        {
+        protected:
+            using T = double;
+            static constexpr unsigned int D = 2;
+
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;                    // Nodes of the graph
+            std::unique_ptr<DistanceCost<T, D>> cost_function;                 // Cost function of the graph
+            std::unique_ptr<Graph<T, D>> graph_evn;                            // Graph environment
+            std::mt19937 generator;                                            // Generator of the graph and the queries
+            std::uniform_int_distribution<std::size_t> node_index;             // Distribution of the node indices
+
+            /**
+             * @brief Build a graph of nodes spread uniformly over `[0, 100) x [0, 100)` and random edges.
+             * @param num_nodes number of nodes in the graph.
+             * @param num_edges number of random edges in the graph.
+             * @param seed seed of the graph and query generator.
+             */
+            void build_graph(const std::size_t num_nodes, const std::size_t num_edges, const std::uint32_t seed)
+            {
+                generator.seed(seed);
+                std::uniform_real_distribution<T> coordinate(0.0, 100.0);
+                node_index = std::uniform_int_distribution<std::size_t>(0, num_nodes - 1);
+                for (std::size_t i = 0; i < num_nodes; ++i)
+                {
+                    NodeValue<T, D> node_value;
+                    node_value.value << coordinate(generator), coordinate(generator);
+                    nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(i)));
+                }
+                std::vector<std::pair<std::size_t, std::size_t>> edges;
+                for (std::size_t i = 0; i < num_edges; ++i)
+                {
+                    edges.emplace_back(node_index(generator), node_index(generator));
+                }
+                cost_function = std::make_unique<DistanceCost<T, D>>(utils::DistanceMetric::EUCLIDEAN);
+                graph_evn = std::make_unique<Graph<T, D>>(nodes, edges, *cost_function);
+                graph_evn->initialize(true);
+            }
+
+            /**
+             * @brief Draw a random node of the graph.
+             * @return const Node<T, D>* node.
+             */
+            const Node<T, D> *random_node()
+            {
+                return graph_evn->get_node(node_index(generator));
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_RANDOM_GRAPH_H
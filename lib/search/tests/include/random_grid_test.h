@@ -0,0 +1,140 @@
+#ifndef SEARCH_TEST_RANDOM_GRID_H
+#define SEARCH_TEST_RANDOM_GRID_H
+
+/**
+ * @file random_grid_test.h
+ * @brief Contains the random obstacle grid shared by the tests of the grid searches. Use this to define your helpers.
+ */
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include <search/environment/grid_environment.h>
+
+namespace search
+{
+
+    namespace search_random_grid_tests
+    {
+        struct RandomGridTestParameters
+        {
+            const std::uint32_t width;     // Width of the grid
+            const std::uint32_t height;    // Height of the grid
+            const bool allow_diagonal;     // Whether diagonal moves are allowed
+            const double obstacle_density; // Fraction of randomly blocked cells
+            const std::uint32_t seed;      // Seed of the obstacle generator
+        };
+
+        /**
+         * @brief Draw random obstacles, keeping the bottom left and top right corners free.
+         * @param width width of the grid.
+         * @param height height of the grid.
+         * @param obstacle_density fraction of randomly blocked cells.
+         * @param seed seed of the obstacle generator.
+         * @return std::vector<bool> blocked cells by row major id.
+         */
+        inline std::vector<bool> make_random_obstacles(const std::uint32_t width,
+                                                       const std::uint32_t height,
+                                                       const double obstacle_density,
+                                                       const std::uint32_t seed)
+        {
+            std::mt19937 generator(seed);
+            std::bernoulli_distribution blocked(obstacle_density);
+            std::vector<bool> obstacles(static_cast<std::size_t>(width) * height);
+            for (std::size_t id = 0; id < obstacles.size(); ++id)
+            {
+                obstacles[id] = blocked(generator);
+            }
+            obstacles.front() = false;
+            obstacles.back() = false;
+            return obstacles;
+        }
+
+        /**
+         * @class RandomGridTest
+         * @brief This class is a test fixture shared by the tests of the grid searches - derive a fixture per search engine.
+         * It sets up a 2D grid with random obstacles, keeping the corners free, and finds the optimal corner to corner path with UCS.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class RandomGridTest : public ::testing::TestWithParam<RandomGridTestParameters>
+        {
+        protected:
+            using T = int;
+            static constexpr unsigned int D = 2;
+
+            std::unique_ptr<GridEnvironment<T, D>> grid_evn;                   // Grid environment
+            std::unique_ptr<Node<T, D>> start_node;                            // Start node - bottom left corner
+            std::unique_ptr<Node<T, D>> goal_node;                             // Goal node - top right corner
+            std::vector<std::pair<const Node<T, D> *, double>> ucs_path;      // Optimal path
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                RandomGridTestParameters props = GetParam();
+                grid_evn = std::make_unique<GridEnvironment<T, D>>(GridEnvironment<T, D>::Coordinates{props.width, props.height}, props.allow_diagonal);
+                const std::vector<bool> obstacles = make_random_obstacles(props.width, props.height, props.obstacle_density, props.seed);
+                for (std::uint32_t y = 0; y < props.height; ++y)
+                {
+                    for (std::uint32_t x = 0; x < props.width; ++x)
+                    {
+                        grid_evn->set_blocked({x, y}, obstacles[static_cast<std::size_t>(y) * props.width + x]);
+                    }
+                }
+                grid_evn->initialize();
+                NodeValue<T, D> start_value;
+                start_value.value << 0, 0;
+                NodeValue<T, D> goal_value;
+                goal_value.value << static_cast<T>(props.width - 1), static_cast<T>(props.height - 1);
+                start_node = std::make_unique<Node<T, D>>(start_value);
+                goal_node = std::make_unique<Node<T, D>>(goal_value);
+                ucs_path = grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::UCS);
+            }
+
+            /**
+             * @brief Check that every step of a path is a move of the grid and that the costs add up.
+             * @param path path to check.
+             * @return true if the path follows the grid moves (an empty path does), false otherwise.
+             */
+            bool follows_grid_moves(const std::vector<std::pair<const Node<T, D> *, double>> &path) const
+            {
+                for (std::size_t idx = 1; idx < path.size(); ++idx)
+                {
+                    const std::uint32_t from_id = grid_evn->get_node_id(*path[idx - 1].first);
+                    const std::uint32_t to_id = grid_evn->get_node_id(*path[idx].first);
+                    double edge_cost = -1.0;
+                    grid_evn->for_each_edge(from_id, [&](const std::uint32_t neighbor_id, const double cost)
+                                            {
+                        if (neighbor_id == to_id)
+                        {
+                            edge_cost = cost;
+                        } });
+                    if (edge_cost < 0.0 || std::abs(path[idx - 1].second + edge_cost - path[idx].second) > utils::floating_point_precision)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /**
+             * @brief Check that a path runs from start to goal along moves of the grid and that the costs add up.
+             * @param path path to check.
+             * @return true if the path is valid, false otherwise.
+             */
+            bool is_valid_path(const std::vector<std::pair<const Node<T, D> *, double>> &path) const
+            {
+                return !path.empty() && path.front().first->get_node_value().value == start_node->get_node_value().value &&
+                       path.back().first->get_node_value().value == goal_node->get_node_value().value && this->follows_grid_moves(path);
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_RANDOM_GRID_H
@@ -0,0 +1,59 @@
+#ifndef SEARCH_TEST_SHORTEST_PATH_TREE_H
+#define SEARCH_TEST_SHORTEST_PATH_TREE_H
+
+/**
+ * @file shortest_path_tree_test.h
+ * @brief Contains the declarations for testing the one-to-many searches and the shortest path tree export. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <random_graph_test.h>
+#include <search/search/ucs.h>
+
+namespace search
+{
+
+    namespace search_shortest_path_tree_tests
+    {
+        struct ShortestPathTreeTestParameters
+        {
+            const std::size_t num_nodes;               // Number of nodes in the graph
+            const std::size_t num_edges;               // Number of random edges in the graph
+            const std::size_t num_targets;             // Number of random targets
+            const utils::PriorityQueueType queue_type; // Priority queue used by the search
+            const std::uint32_t seed;                  // Seed of the graph and target generator
+        };
+
+        /**
+         * @class ShortestPathTreeTest
+         * @brief This class is a test fixture for testing the one-to-many searches and the shortest path tree export.
+         * It sets up the random 2D graph of `RandomGraphTest`, a random root and a list of random targets.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class ShortestPathTreeTest : public search_random_graph_tests::RandomGraphTest<ShortestPathTreeTestParameters>
+        {
+        protected:
+            const Node<T, D> *root_node = nullptr;                             // Root of the tree
+            std::vector<const Node<T, D> *> target_nodes;                      // Targets of the one-to-many search
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                ShortestPathTreeTestParameters props = GetParam();
+                this->build_graph(props.num_nodes, props.num_edges, props.seed);
+                root_node = this->random_node();
+                for (std::size_t i = 0; i < props.num_targets; ++i)
+                {
+                    target_nodes.push_back(this->random_node());
+                }
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_SHORTEST_PATH_TREE_H
@@ -0,0 +1,32 @@
+#ifndef SEARCH_TEST_SMA_STAR_H
+#define SEARCH_TEST_SMA_STAR_H
+
+/**
+ * @file sma_star_test.h
+ * @brief Contains the declarations for testing SMA*. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <random_grid_test.h>
+#include <search/search/sma_star.h>
+
+namespace search
+{
+
+    namespace search_sma_star_tests
+    {
+        using search_random_grid_tests::RandomGridTestParameters;
+
+        /**
+         * @class SmaStarTest
+         * @brief This class is a test fixture for testing the SMA* algorithm.
+         * It runs on the random obstacle grid of `RandomGridTest`.
+         */
+        class SmaStarTest : public search_random_grid_tests::RandomGridTest
+        {
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_SMA_STAR_H
@@ -0,0 +1,74 @@
+#ifndef SEARCH_TEST_STATIC_AGGREGATE_COST_H
+#define SEARCH_TEST_STATIC_AGGREGATE_COST_H
+
+/**
+ * @file static_aggregate_cost_test.h
+ * @brief Contains the declarations for testing the StaticAggregateCost. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <search/cost/default_cost.h>
+#include <search/cost/distance_cost.h>
+#include <search/cost/aggregate_cost.h>
+#include <search/cost/static_aggregate_cost.h>
+#include <search/environment/graph.h>
+
+namespace search
+{
+
+    namespace search_static_aggregate_cost_tests
+    {
+        struct StaticAggregateCostTestParameters
+        {
+            const std::array<double, 2> from_value; // Value of node A
+            const std::array<double, 2> to_value;   // Value of node B
+            const std::array<double, 3> weights;    // Weights of the Euclidean, Manhattan and default costs
+        };
+
+        /**
+         * @class StaticAggregateCostTest
+         * @brief This class is a test fixture for testing the StaticAggregateCost.
+         * It evaluates the same weighted combination of costs with the StaticAggregateCost and the AggregateCost.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class StaticAggregateCostTest : public ::testing::TestWithParam<StaticAggregateCostTestParameters>
+        {
+            using T = double;
+            static constexpr unsigned int D = 2;
+
+        protected:
+            double static_cost = 0.0;    // Cost computed by the StaticAggregateCost
+            double aggregate_cost = 0.0; // Cost computed by the AggregateCost
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                StaticAggregateCostTestParameters props = GetParam();
+                // Make nodes
+                NodeValue<T, D> from_value;
+                from_value.value << props.from_value[0], props.from_value[1];
+                NodeValue<T, D> to_value;
+                to_value.value << props.to_value[0], props.to_value[1];
+                Node<T, D> from_node = Node<T, D>(from_value, "A");
+                Node<T, D> to_node = Node<T, D>(to_value, "B");
+                // Set cost functions
+                DistanceCost<T, D> euclidean_cost = DistanceCost<T, D>(utils::DistanceMetric::EUCLIDEAN);
+                DistanceCost<T, D> manhattan_cost = DistanceCost<T, D>(utils::DistanceMetric::MANHATTAN);
+                DefaultCost<T, D> default_cost = DefaultCost<T, D>(2.0);
+                // Combine them both ways
+                StaticAggregateCost cost_function = StaticAggregateCost(props.weights, euclidean_cost, manhattan_cost, default_cost);
+                AggregateCost<T, D> reference_cost_function = AggregateCost<T, D>(
+                    std::vector<double>(props.weights.begin(), props.weights.end()), euclidean_cost, manhattan_cost, default_cost);
+                static_cost = cost_function.get_cost(from_node, to_node);
+                aggregate_cost = reference_cost_function.get_cost(from_node, to_node);
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_STATIC_AGGREGATE_COST_H
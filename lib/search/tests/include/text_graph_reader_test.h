@@ -0,0 +1,115 @@
+#ifndef SEARCH_TEST_TEXT_GRAPH_READER_H
+#define SEARCH_TEST_TEXT_GRAPH_READER_H
+
+/**
+ * @file text_graph_reader_test.h
+ * @brief Contains the declarations for testing the text graph readers. Use this to define your helpers.
+ */
+
+#include <cstdio>
+#include <random>
+#include <fstream>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <search/io/text_graph_reader.h>
+
+namespace search
+{
+
+    namespace search_text_graph_reader_tests
+    {
+        struct TextGraphReaderTestParameters
+        {
+            const std::size_t num_nodes;   // Number of nodes in the graph
+            const std::size_t num_edges;   // Number of random edges in the graph
+            const std::size_t num_threads; // Number of threads used to read the files
+            const std::string separator;   // Field separator
+        };
+
+        /**
+         * @class TextGraphReaderTest
+         * @brief This class is a test fixture for testing the text graph readers.
+         * It writes a random edge list and node value file, with a header, comments and blank lines, and reads them back.
+         */
+        class TextGraphReaderTest : public ::testing::TestWithParam<TextGraphReaderTestParameters>
+        {
+        protected:
+            std::string edge_path;                                        // Path of the edge list
+            std::string node_path;                                        // Path of the node value file
+            std::vector<std::pair<std::size_t, std::size_t>> edges;       // Edges written to the edge list
+            std::vector<std::pair<std::size_t, std::size_t>> read_edges;  // Edges read back, in CSR order
+            std::vector<NodeValue<double, 2>> node_values;                // Node values written to the node value file
+            std::vector<NodeValue<double, 2>> read_node_values_;          // Node values read back
+            std::size_t read_num_nodes = 0;                               // Number of nodes of the adjacency read back
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                TextGraphReaderTestParameters props = GetParam();
+                const std::string suffix = std::to_string(reinterpret_cast<std::uintptr_t>(this));
+                edge_path = ::testing::TempDir() + "text_graph_reader_test_edges_" + suffix + ".csv";
+                node_path = ::testing::TempDir() + "text_graph_reader_test_nodes_" + suffix + ".csv";
+                std::mt19937 generator(42);
+                std::uniform_int_distribution<std::size_t> node_distribution(0, props.num_nodes - 1);
+                std::uniform_real_distribution<double> value_distribution(-100.0, 100.0);
+                {
+                    std::ofstream file(edge_path);
+                    file << "from" << props.separator << "to" << props.separator << "weight\n";
+                    for (std::size_t idx = 0; idx < props.num_edges; ++idx)
+                    {
+                        edges.emplace_back(node_distribution(generator), node_distribution(generator));
+                        file << edges.back().first << props.separator << edges.back().second << props.separator << "1.5";
+                        file << (idx % 7 == 0 ? "\r\n" : "\n");
+                        if (idx % 100 == 0)
+                        {
+                            file << "# comment\n\n";
+                        }
+                    }
+                    // Make sure the last node appears
+                    edges.emplace_back(props.num_nodes - 1, 0);
+                    file << props.num_nodes - 1 << props.separator << 0;
+                }
+                {
+                    std::ofstream file(node_path);
+                    file.precision(17);
+                    file << "x" << props.separator << "y\n";
+                    for (std::size_t idx = 0; idx < props.num_nodes; ++idx)
+                    {
+                        NodeValue<double, 2> node_value;
+                        node_value.value << value_distribution(generator), value_distribution(generator);
+                        node_values.push_back(node_value);
+                        file << node_value.value(0) << props.separator << node_value.value(1) << "\n";
+                    }
+                }
+                // Read them back
+                const CsrAdjacency adjacency = read_edge_list(edge_path, 0, props.num_threads);
+                read_num_nodes = adjacency.get_num_nodes();
+                for (std::uint32_t id = 0; id < read_num_nodes; ++id)
+                {
+                    for (const std::uint32_t target : adjacency.get_neighbors(id))
+                    {
+                        read_edges.emplace_back(id, target);
+                    }
+                }
+                read_node_values_ = read_node_values<double, 2>(node_path, props.num_threads);
+                // The reader sorts the edges of every node by target
+                std::sort(edges.begin(), edges.end());
+            }
+
+            /**
+             * @brief Tear down the test fixture.
+             */
+            void TearDown() override
+            {
+                std::remove(edge_path.c_str());
+                std::remove(node_path.c_str());
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_TEXT_GRAPH_READER_H
@@ -0,0 +1,84 @@
+#ifndef SEARCH_TEST_UCS_H
+#define SEARCH_TEST_UCS_H
+
+/**
+ * @file ucs_test.h
+ * @brief Contains the declarations for testing UCS. Use this to define your helpers.
+ */
+
+#include <gtest/gtest.h>
+#include <search/cost/distance_cost.h>
+#include <search/environment/graph.h>
+
+namespace search
+{
+
+    namespace search_ucs_tests
+    {
+        struct UcsTestParameters
+        {
+            const std::vector<double> node_values;                        // 1D coordinate of every node in the graph
+            const std::size_t start_node_index;                           // Index of the start node
+            const std::size_t goal_node_index;                            // Index of the goal node
+            const std::vector<std::pair<std::size_t, std::size_t>> edges; // List of edges in the graph
+            const utils::PriorityQueueType queue_type;                    // Priority queue used by the search
+            const std::vector<std::string> expected_result;               // Expected result of the UCS search
+            const double expected_cost;                                   // Expected cost of the path
+        };
+
+        /**
+         * @class UcsTest
+         * @brief This class is a test fixture for testing the Uniform Cost Search (UCS) algorithm.
+         * It sets up a graph whose edge costs are the distance between the node values.
+         * @tparam T Type of the node value.
+         * @tparam D Dimension of the node value.
+         */
+        class UcsTest : public ::testing::TestWithParam<UcsTestParameters>
+        {
+            using T = double;
+            static constexpr unsigned int D = 1;
+
+        protected:
+            std::vector<std::string> result; // Path found by UCS search with names only for validation
+            double cost = 0.0;               // Cost of the path found by UCS search
+
+            /**
+             * @brief Set up the test fixture.
+             */
+            void SetUp() override
+            {
+                // Initialize or set up resources needed for tests
+                UcsTestParameters props = GetParam();
+                // Make nodes
+                std::vector<std::unique_ptr<Node<T, D>>> nodes;
+                for (std::size_t i = 0; i < props.node_values.size(); ++i)
+                {
+                    NodeValue<T, D> node_value;
+                    node_value.value << props.node_values[i];
+                    nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(i)));
+                }
+                // Set cost function
+                DistanceCost<T, D> cost_function = DistanceCost<T, D>(utils::DistanceMetric::EUCLIDEAN);
+                // Create the graph with the nodes and edges
+                Graph<T, D> graph_evn = Graph<T, D>(nodes, props.edges, cost_function);
+                // Initialize the graph environment
+                graph_evn.initialize();
+                // Run UCS search
+                std::vector<std::pair<const Node<T, D> *, double>> path = UCS<T, D, Graph<T, D>>(props.queue_type).search(
+                    *graph_evn.get_node(props.start_node_index),
+                    *graph_evn.get_node(props.goal_node_index),
+                    graph_evn);
+                // Store the result
+                result.clear();
+                for (std::pair<const Node<T, D> *, double> &node_pair : path)
+                {
+                    result.emplace_back(node_pair.first->get_name());
+                }
+                cost = path.empty() ? 0.0 : path.back().second;
+            }
+        };
+    }
+
+} // namespace search
+
+#endif // SEARCH_TEST_UCS_H
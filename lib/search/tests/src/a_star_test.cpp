@@ -0,0 +1,80 @@
+/**
+ * @file a_star_test.cpp
+ * @brief Unit tests for the A* algorithm.
+ */
+
+#include <gtest/gtest.h>
+#include <a_star_test.h>
+
+namespace search
+{
+    namespace search_a_star_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            AStarTestSuite,
+            AStarTest,
+            ::testing::Values(
+                AStarTestParameters{
+                    utils::DistanceMetric::EUCLIDEAN, // Metric of the edge costs and of the heuristic
+                    1.0,                              // Heuristic inflation factor
+                    399},                             // Index of the goal node
+                AStarTestParameters{
+                    utils::DistanceMetric::MANHATTAN,
+                    1.0,
+                    399},
+                AStarTestParameters{
+                    utils::DistanceMetric::EUCLIDEAN,
+                    2.5,
+                    219},
+                AStarTestParameters{
+                    utils::DistanceMetric::EUCLIDEAN,
+                    1.0,
+                    5}
+                ));
+
+        TEST_P(AStarTest, SearchPathWithinBound)
+        {
+            // Get the parameters for the test
+            AStarTestParameters props = GetParam();
+            // A* must find a path whenever UCS does and stay within epsilon of the optimum
+            ASSERT_GE(ucs_cost, 0.0) << "UCS did not find a path";
+            ASSERT_GE(a_star_cost, 0.0) << "A* did not find a path";
+            EXPECT_TRUE(valid_path) << "The A* path uses a non existent edge";
+            EXPECT_GE(a_star_cost + utils::floating_point_precision, ucs_cost);
+            EXPECT_LE(a_star_cost, props.epsilon * ucs_cost + utils::floating_point_precision)
+                << "The A* path is not within epsilon of the optimal path";
+        }
+
+        TEST(AStarCostHeuristicTest, InformedSearchesStayOptimalWithoutDistanceCosts)
+        {
+            using T = double;
+            constexpr unsigned int D = 2;
+            // Every edge costs 1, so the straight line distance from the detour (1, 0) to the goal overestimates its cost
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            for (const auto &[x, y] : std::vector<std::pair<T, T>>{{0.0, 0.0}, {1.0, 0.0}, {9.0, 0.0}, {10.0, 0.5}, {10.0, 0.0}})
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << x, y;
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(nodes.size())));
+            }
+            const std::vector<std::pair<std::size_t, std::size_t>> edges = {{0, 1}, {1, 4}, {0, 2}, {2, 3}, {3, 4}};
+            const DefaultCost<T, D> cost_function(1.0);
+            Graph<T, D> graph_evn(nodes, edges, cost_function);
+            graph_evn.initialize();
+            CsrGraph<T, D> csr_graph_evn(nodes, edges, cost_function);
+            csr_graph_evn.initialize();
+            EXPECT_FALSE((CostHeuristic<T, D>(&cost_function).is_informed()));
+            const DistanceCost<T, D> distance_cost(utils::DistanceMetric::MANHATTAN);
+            EXPECT_TRUE((CostHeuristic<T, D>(&distance_cost).is_informed()));
+            for (const utils::SearchAlgorithm search_algorithm : {utils::SearchAlgorithm::A_STAR, utils::SearchAlgorithm::IDA_STAR, utils::SearchAlgorithm::SMA_STAR, utils::SearchAlgorithm::ARA_STAR})
+            {
+                const std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn.search(*nodes[0], *nodes[4], search_algorithm);
+                ASSERT_FALSE(path.empty());
+                EXPECT_DOUBLE_EQ(path.back().second, 2.0) << "Graph search " << static_cast<int>(search_algorithm) << " is not optimal";
+                const std::vector<std::pair<const Node<T, D> *, double>> csr_path = csr_graph_evn.search(*nodes[0], *nodes[4], search_algorithm);
+                ASSERT_FALSE(csr_path.empty());
+                EXPECT_DOUBLE_EQ(csr_path.back().second, 2.0) << "CsrGraph search " << static_cast<int>(search_algorithm) << " is not optimal";
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/**
+ * @file ara_star_test.cpp
+ * @brief Unit tests for the ARA* algorithm and the cancellation of the searches.
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <ara_star_test.h>
+
+namespace search
+{
+    namespace search_ara_star_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            AraStarTestSuite,
+            AraStarTest,
+            ::testing::Values(
+                RandomGridTestParameters{
+                    1,     // Width of the grid
+                    1,     // Height of the grid
+                    false, // Whether diagonal moves are allowed
+                    0.0,   // Fraction of randomly blocked cells
+                    1},    // Seed of the obstacle generator
+                RandomGridTestParameters{
+                    40,
+                    30,
+                    false,
+                    0.2,
+                    7},
+                RandomGridTestParameters{
+                    64,
+                    48,
+                    true,
+                    0.15,
+                    3},
+                RandomGridTestParameters{
+                    12,
+                    10,
+                    true,
+                    0.2,
+                    4},
+                RandomGridTestParameters{
+                    16,
+                    16,
+                    true,
+                    0.6,
+                    5}));
+
+        TEST_P(AraStarTest, SearchMatchesUniformCostSearch)
+        {
+            const AraStar<T, D, GridEnvironment<T, D>> ara_star;
+            const std::vector<std::pair<const Node<T, D> *, double>> path = ara_star.search(*start_node, *goal_node, *grid_evn);
+            ASSERT_EQ(path.empty(), ucs_path.empty());
+            // The environment dispatch runs the same search
+            EXPECT_EQ(grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::ARA_STAR), path);
+            if (ucs_path.empty())
+            {
+                EXPECT_EQ(ara_star.get_solution_epsilon(), std::numeric_limits<double>::infinity());
+                return;
+            }
+            EXPECT_TRUE(is_valid_path(path));
+            EXPECT_NEAR(path.back().second, ucs_path.back().second, utils::floating_point_precision);
+            // Run to completion, the last path is optimal
+            EXPECT_EQ(ara_star.get_solution_epsilon(), 1.0);
+            EXPECT_GE(ara_star.get_num_iterations(), 1U);
+            EXPECT_THROW((AraStar<T, D, GridEnvironment<T, D>>(EuclideanHeuristic<T, D>(), 0.5)), std::invalid_argument);
+            EXPECT_THROW((AraStar<T, D, GridEnvironment<T, D>>(EuclideanHeuristic<T, D>(), 2.0, 0.0)), std::invalid_argument);
+        }
+
+        TEST_P(AraStarTest, CancelledSearchReturnsBoundedPath)
+        {
+            if (ucs_path.size() < 2)
+            {
+                GTEST_SKIP() << "There is no path to improve";
+            }
+            SearchWorkspace workspace;
+            CancellationToken token;
+            workspace.set_cancellation_token(&token);
+            double last_epsilon = std::numeric_limits<double>::infinity();
+            for (const std::size_t limit : {1, 50, 500, 5000, 50000, 500000})
+            {
+                token.reset();
+                const AraStar<T, D, GridEnvironment<T, D>, CancellingHeuristic> ara_star(CancellingHeuristic{&token, limit, std::make_shared<std::size_t>(0)}, 5.0, 1.0);
+                const std::vector<std::pair<const Node<T, D> *, double>> path = ara_star.search(*start_node, *goal_node, *grid_evn, workspace);
+                const double epsilon = ara_star.get_solution_epsilon();
+                if (path.empty())
+                {
+                    EXPECT_EQ(epsilon, std::numeric_limits<double>::infinity()) << "Limit: " << limit;
+                    continue;
+                }
+                // The best path so far is within its epsilon of the optimum, and more time never makes it worse
+                ASSERT_TRUE(is_valid_path(path)) << "Limit: " << limit;
+                EXPECT_LE(path.back().second, epsilon * ucs_path.back().second + utils::floating_point_precision) << "Limit: " << limit;
+                EXPECT_LE(epsilon, last_epsilon) << "Limit: " << limit;
+                last_epsilon = epsilon;
+            }
+            EXPECT_EQ(last_epsilon, 1.0);
+        }
+
+        TEST_P(AraStarTest, CancelledTokenStopsEverySearch)
+        {
+            RandomGridTestParameters props = GetParam();
+            if (ucs_path.size() < 2)
+            {
+                GTEST_SKIP() << "The start is the goal";
+            }
+            std::vector<utils::SearchAlgorithm> algorithms = {utils::SearchAlgorithm::DFS, utils::SearchAlgorithm::BFS, utils::SearchAlgorithm::UCS,
+                                                              utils::SearchAlgorithm::A_STAR, utils::SearchAlgorithm::ARA_STAR};
+            if (props.allow_diagonal)
+            {
+                algorithms.push_back(utils::SearchAlgorithm::JPS);
+            }
+            // IDA* and SMA* trade time for memory - only run them on the small grids
+            if (props.width * props.height <= 128)
+            {
+                algorithms.push_back(utils::SearchAlgorithm::IDA_STAR);
+                algorithms.push_back(utils::SearchAlgorithm::SMA_STAR);
+            }
+            SearchWorkspace workspace;
+            CancellationToken token;
+            workspace.set_cancellation_token(&token);
+            for (const utils::SearchAlgorithm algorithm : algorithms)
+            {
+                token.cancel();
+                EXPECT_TRUE(grid_evn->search(*start_node, *goal_node, algorithm, workspace).empty()) << "Algorithm: " << static_cast<int>(algorithm);
+                token.reset();
+                EXPECT_TRUE(is_valid_path(grid_evn->search(*start_node, *goal_node, algorithm, workspace))) << "Algorithm: " << static_cast<int>(algorithm);
+            }
+        }
+
+        TEST(CancellationTokenTest, Deadline)
+        {
+            using namespace std::chrono_literals;
+            CancellationToken token;
+            EXPECT_FALSE(token.is_cancelled());
+            EXPECT_FALSE(token.has_deadline());
+            token.set_deadline(CancellationToken::Clock::now() - 1ms);
+            EXPECT_TRUE(token.has_deadline());
+            EXPECT_TRUE(token.is_cancelled());
+            token.set_timeout(1h);
+            EXPECT_FALSE(token.is_cancelled());
+            token.cancel();
+            EXPECT_TRUE(token.is_cancelled());
+            token.reset();
+            EXPECT_FALSE(token.is_cancelled());
+            EXPECT_FALSE(token.has_deadline());
+            const CancellationToken expired(0s);
+            EXPECT_TRUE(expired.is_cancelled());
+        }
+    }
+}
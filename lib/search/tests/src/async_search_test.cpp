@@ -0,0 +1,215 @@
+/**
+ * @file async_search_test.cpp
+ * @brief Unit tests for the work-stealing executor and the asynchronous searches.
+ */
+
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <async_search_test.h>
+
+namespace search
+{
+    namespace search_async_search_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            AsyncSearchTestSuite,
+            AsyncSearchTest,
+            ::testing::Values(
+                AsyncSearchTestParameters{
+                    1,  // Number of nodes in the graph
+                    0,  // Number of random edges in the graph
+                    4,  // Number of random queries
+                    1,  // Number of executor threads
+                    1}, // Seed of the graph and query generator
+                AsyncSearchTestParameters{
+                    50,
+                    200,
+                    64,
+                    2,
+                    7},
+                AsyncSearchTestParameters{
+                    500,
+                    2500,
+                    256,
+                    4,
+                    3},
+                AsyncSearchTestParameters{
+                    2000,
+                    4000,
+                    128,
+                    8,
+                    11}));
+
+        TEST_P(AsyncSearchTest, AsyncSearchMatchesSearch)
+        {
+            for (const utils::SearchAlgorithm search_algorithm : {utils::SearchAlgorithm::BFS, utils::SearchAlgorithm::UCS, utils::SearchAlgorithm::A_STAR})
+            {
+                std::vector<std::future<std::vector<std::pair<const Node<T, D> *, double>>>> futures;
+                for (std::size_t idx = 0; idx < queries.size(); ++idx)
+                {
+                    const utils::TaskPriority priority = static_cast<utils::TaskPriority>(idx % 3);
+                    futures.emplace_back(graph_evn->search_async(*graph_evn->get_node(queries[idx].first),
+                                                                 *graph_evn->get_node(queries[idx].second),
+                                                                 search_algorithm, priority, nullptr, *executor));
+                }
+                for (std::size_t idx = 0; idx < queries.size(); ++idx)
+                {
+                    const std::vector<std::pair<const Node<T, D> *, double>> path = futures[idx].get();
+                    const std::vector<std::pair<const Node<T, D> *, double>> expected = graph_evn->search(
+                        *graph_evn->get_node(queries[idx].first),
+                        *graph_evn->get_node(queries[idx].second),
+                        search_algorithm);
+                    ASSERT_EQ(path.empty(), expected.empty());
+                    if (search_algorithm == utils::SearchAlgorithm::BFS)
+                    {
+                        EXPECT_EQ(path.size(), expected.size());
+                    }
+                    else if (!path.empty())
+                    {
+                        EXPECT_NEAR(path.back().second, expected.back().second, utils::floating_point_precision);
+                    }
+                }
+            }
+        }
+
+        TEST_P(AsyncSearchTest, AsyncSearchUsesDefaultExecutor)
+        {
+            const Node<T, D> &start_node = *graph_evn->get_node(queries.front().first);
+            const Node<T, D> &goal_node = *graph_evn->get_node(queries.front().second);
+            EXPECT_GE(WorkStealingExecutor::get_default().get_num_threads(), 1U);
+            EXPECT_EQ(graph_evn->search_async(start_node, goal_node, utils::SearchAlgorithm::UCS).get(),
+                      graph_evn->search(start_node, goal_node, utils::SearchAlgorithm::UCS));
+        }
+
+        TEST_P(AsyncSearchTest, CancelledAsyncSearchReturnsEmptyPath)
+        {
+            CancellationToken token;
+            token.cancel();
+            for (const std::pair<std::size_t, std::size_t> &query : queries)
+            {
+                if (query.first == query.second)
+                {
+                    continue; // The start is the goal before the token is polled
+                }
+                EXPECT_TRUE(graph_evn->search_async(*graph_evn->get_node(query.first),
+                                                    *graph_evn->get_node(query.second),
+                                                    utils::SearchAlgorithm::UCS, utils::TaskPriority::NORMAL, &token, *executor)
+                                .get()
+                                .empty());
+            }
+            // The token is not kept by the workspace of the worker
+            const std::pair<std::size_t, std::size_t> &query = queries.front();
+            EXPECT_EQ(graph_evn->search_async(*graph_evn->get_node(query.first), *graph_evn->get_node(query.second),
+                                              utils::SearchAlgorithm::UCS, utils::TaskPriority::NORMAL, nullptr, *executor)
+                          .get(),
+                      graph_evn->search(*graph_evn->get_node(query.first), *graph_evn->get_node(query.second), utils::SearchAlgorithm::UCS));
+        }
+
+        TEST(WorkStealingExecutorTest, HigherPrioritiesRunFirst)
+        {
+            WorkStealingExecutor executor(1);
+            EXPECT_EQ(executor.get_num_threads(), 1U);
+            // Hold the only worker until every task is queued
+            std::promise<void> gate;
+            std::shared_future<void> opened = gate.get_future().share();
+            std::future<void> blocker = executor.submit([opened]()
+                                                        { opened.wait(); });
+            std::mutex mutex;
+            std::vector<int> order;
+            std::vector<std::future<void>> futures;
+            for (const utils::TaskPriority priority : {utils::TaskPriority::LOW, utils::TaskPriority::NORMAL, utils::TaskPriority::HIGH,
+                                                       utils::TaskPriority::LOW, utils::TaskPriority::HIGH})
+            {
+                futures.emplace_back(executor.submit([&, priority]()
+                                                     {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    order.push_back(static_cast<int>(priority)); },
+                                                     priority));
+            }
+            gate.set_value();
+            blocker.get();
+            for (std::future<void> &future : futures)
+            {
+                future.get();
+            }
+            EXPECT_EQ(order, (std::vector<int>{0, 0, 1, 2, 2}));
+        }
+
+        TEST(WorkStealingExecutorTest, TasksRunOnEveryWorker)
+        {
+            WorkStealingExecutor executor(4);
+            EXPECT_FALSE(executor.is_worker_thread());
+            std::atomic<std::size_t> num_nested = 0;
+            std::vector<std::future<std::size_t>> futures;
+            for (std::size_t idx = 0; idx < 1000; ++idx)
+            {
+                futures.emplace_back(executor.submit([&executor, &num_nested, idx]()
+                                                     {
+                    EXPECT_TRUE(executor.is_worker_thread());
+                    // Tasks submitted by a task go to the deque of its worker and get stolen by the others
+                    executor.submit([&num_nested]()
+                                    { ++num_nested; });
+                    return idx * idx; }));
+            }
+            for (std::size_t idx = 0; idx < futures.size(); ++idx)
+            {
+                EXPECT_EQ(futures[idx].get(), idx * idx);
+            }
+            EXPECT_THROW(executor.submit([]() -> int
+                                         { throw std::runtime_error("Task failed"); })
+                             .get(),
+                         std::runtime_error);
+        }
+
+        TEST(WorkStealingExecutorTest, DestructorRunsQueuedTasks)
+        {
+            std::atomic<std::size_t> num_runs = 0;
+            {
+                WorkStealingExecutor executor(2);
+                for (std::size_t idx = 0; idx < 256; ++idx)
+                {
+                    executor.submit([&num_runs]()
+                                    { ++num_runs; },
+                                    static_cast<utils::TaskPriority>(idx % 3));
+                }
+            }
+            EXPECT_EQ(num_runs.load(), 256U);
+        }
+
+        TEST(WorkStealingExecutorTest, NestedLoopsStayOnTheirThread)
+        {
+            const auto count_threads = [](std::vector<std::thread::id> &thread_ids)
+            {
+                std::mutex mutex;
+                return parallel_for(thread_ids.size(), 4, [&](const std::size_t, const std::size_t begin, const std::size_t end)
+                                    {
+                    for (std::size_t idx = begin; idx < end; ++idx)
+                    {
+                        const std::lock_guard<std::mutex> lock(mutex);
+                        thread_ids[idx] = std::this_thread::get_id();
+                    } },
+                                    1);
+            };
+            std::vector<std::thread::id> thread_ids(8);
+            EXPECT_EQ(count_threads(thread_ids), 4U);
+            // Loops run by a worker or by a chunk of another loop do not spawn threads
+            WorkStealingExecutor executor(2);
+            EXPECT_TRUE(executor.submit([&]()
+                                        { return count_threads(thread_ids) == 1 &&
+                                                 std::ranges::all_of(thread_ids, [](const std::thread::id id)
+                                                                     { return id == std::this_thread::get_id(); }); })
+                            .get());
+            std::vector<std::size_t> nested_chunks(4);
+            parallel_for(nested_chunks.size(), 4, [&](const std::size_t chunk, const std::size_t, const std::size_t)
+                         {
+                std::vector<std::thread::id> chunk_thread_ids(8);
+                nested_chunks[chunk] = count_threads(chunk_thread_ids); },
+                         1);
+            EXPECT_EQ(nested_chunks, std::vector<std::size_t>(4, 1));
+            EXPECT_FALSE(ParallelRegion::is_active());
+        }
+    }
+
+} // namespace search
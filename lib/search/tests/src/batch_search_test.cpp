@@ -0,0 +1,155 @@
+/**
+ * @file batch_search_test.cpp
+ * @brief Unit tests for the batched searches.
+ */
+
+#include <gtest/gtest.h>
+#include <batch_search_test.h>
+
+namespace search
+{
+    namespace search_batch_search_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            BatchSearchTestSuite,
+            BatchSearchTest,
+            ::testing::Values(
+                BatchSearchTestParameters{
+                    1,  // Number of nodes in the graph
+                    0,  // Number of random edges in the graph
+                    3,  // Number of random queries
+                    1,  // Number of distinct start nodes the queries are drawn from
+                    1,  // Number of threads answering the queries
+                    1}, // Seed of the graph and query generator
+                BatchSearchTestParameters{
+                    50,
+                    200,
+                    0,
+                    1,
+                    4,
+                    5},
+                BatchSearchTestParameters{
+                    50,
+                    200,
+                    64,
+                    64,
+                    2,
+                    7},
+                BatchSearchTestParameters{
+                    500,
+                    2500,
+                    300,
+                    10,
+                    4,
+                    3},
+                BatchSearchTestParameters{
+                    2000,
+                    3000,
+                    200,
+                    5,
+                    8,
+                    11}));
+
+        TEST_P(BatchSearchTest, BatchMatchesSearch)
+        {
+            for (const utils::SearchAlgorithm search_algorithm : {utils::SearchAlgorithm::BFS, utils::SearchAlgorithm::UCS, utils::SearchAlgorithm::A_STAR})
+            {
+                const SearchBatchResult<T, D> result = graph_evn->search_batch(queries, search_algorithm, GetParam().num_threads);
+                ASSERT_EQ(result.size(), queries.size());
+                for (std::size_t query = 0; query < queries.size(); ++query)
+                {
+                    const std::vector<std::pair<const Node<T, D> *, double>> expected = graph_evn->search(*queries[query].start_node, *queries[query].goal_node, search_algorithm);
+                    const std::vector<std::pair<const Node<T, D> *, double>> path = result.get_path(query);
+                    ASSERT_EQ(result.has_path(query), !expected.empty());
+                    if (expected.empty())
+                    {
+                        EXPECT_TRUE(path.empty());
+                        EXPECT_EQ(result.get_cost(query), std::numeric_limits<double>::infinity());
+                        continue;
+                    }
+                    EXPECT_EQ(path.front().first, queries[query].start_node);
+                    EXPECT_EQ(path.back().first, queries[query].goal_node);
+                    EXPECT_EQ(result.get_cost(query), path.back().second);
+                    if (search_algorithm == utils::SearchAlgorithm::BFS)
+                    {
+                        EXPECT_EQ(path, expected);
+                        continue;
+                    }
+                    // Grouped queries may pick another path of the same cost
+                    EXPECT_NEAR(result.get_cost(query), expected.back().second, utils::floating_point_precision);
+                    for (std::size_t idx = 1; idx < path.size(); ++idx)
+                    {
+                        EXPECT_NEAR(path[idx].second - path[idx - 1].second, graph_evn->get_cost(*path[idx - 1].first, *path[idx].first), utils::floating_point_precision);
+                    }
+                }
+            }
+        }
+
+        TEST_P(BatchSearchTest, ColumnsHoldEveryPath)
+        {
+            const SearchBatchResult<T, D> result = graph_evn->search_batch(queries, utils::SearchAlgorithm::UCS, GetParam().num_threads);
+            const std::span<const std::size_t> offsets = result.get_offsets();
+            ASSERT_EQ(offsets.size(), queries.size() + 1);
+            EXPECT_EQ(offsets.front(), 0U);
+            EXPECT_EQ(offsets.back(), result.get_nodes().size());
+            EXPECT_EQ(offsets.back(), result.get_step_costs().size());
+            for (std::size_t query = 0; query < queries.size(); ++query)
+            {
+                EXPECT_LE(offsets[query], offsets[query + 1]);
+                EXPECT_EQ(result.get_path_nodes(query).size(), offsets[query + 1] - offsets[query]);
+                EXPECT_EQ(result.get_path_nodes(query).data(), result.get_nodes().data() + offsets[query]);
+                EXPECT_EQ(result.get_path_costs(query).data(), result.get_step_costs().data() + offsets[query]);
+            }
+        }
+
+        TEST_P(BatchSearchTest, DefaultBatchMatchesBatch)
+        {
+            // The environment wide implementation runs every query on its own
+            const SearchBatchResult<T, D> expected = graph_evn->search_batch(queries, utils::SearchAlgorithm::UCS, GetParam().num_threads);
+            const SearchBatchResult<T, D> result = graph_evn->Environment<T, D>::search_batch(queries, utils::SearchAlgorithm::UCS, GetParam().num_threads);
+            ASSERT_EQ(result.size(), expected.size());
+            for (std::size_t query = 0; query < queries.size(); ++query)
+            {
+                EXPECT_EQ(result.get_path(query), graph_evn->search(*queries[query].start_node, *queries[query].goal_node, utils::SearchAlgorithm::UCS));
+                ASSERT_EQ(result.has_path(query), expected.has_path(query));
+                if (expected.has_path(query))
+                {
+                    EXPECT_NEAR(result.get_cost(query), expected.get_cost(query), utils::floating_point_precision);
+                }
+            }
+        }
+
+        TEST_P(BatchSearchTest, SearchManySettlesEveryGoal)
+        {
+            if (queries.empty())
+            {
+                GTEST_SKIP() << "There are no queries";
+            }
+            const std::uint32_t start_id = graph_evn->get_node_id(*queries.front().start_node);
+            std::vector<std::uint32_t> goal_ids;
+            for (const SearchQuery<T, D> &query : queries)
+            {
+                goal_ids.push_back(graph_evn->get_node_id(*query.goal_node));
+            }
+            SearchWorkspace workspace;
+            const UCS<T, D, Graph<T, D>> ucs;
+            const std::size_t num_settled = ucs.search_many(start_id, goal_ids, *graph_evn, workspace);
+            std::size_t num_reached = 0;
+            std::vector<std::uint32_t> distinct_goal_ids = goal_ids;
+            std::sort(distinct_goal_ids.begin(), distinct_goal_ids.end());
+            distinct_goal_ids.erase(std::unique(distinct_goal_ids.begin(), distinct_goal_ids.end()), distinct_goal_ids.end());
+            for (const std::uint32_t goal_id : distinct_goal_ids)
+            {
+                const std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn->search(*queries.front().start_node, *graph_evn->get_node(goal_id), utils::SearchAlgorithm::UCS);
+                ASSERT_EQ(workspace.is_reached(goal_id), !path.empty());
+                if (!path.empty())
+                {
+                    ++num_reached;
+                    EXPECT_NEAR(workspace.get_cost(goal_id), path.back().second, utils::floating_point_precision);
+                }
+            }
+            EXPECT_EQ(num_settled, num_reached);
+        }
+    }
+
+} // namespace search
@@ -0,0 +1,73 @@
+/**
+ * @file bfs_test.cpp
+ * @brief Unit tests for the Breadth First Search (BFS) algorithm.
+ */
+
+#include <gtest/gtest.h>
+#include <bfs_test.h>
+
+namespace search
+{
+    namespace search_bfs_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            BfsTestSuite,
+            BfsTest,
+            ::testing::Values(
+                BfsTestParameters{
+                    5,                                // Number of nodes in the graph
+                    0,                                // Index of the start node
+                    4,                                // Index of the goal node
+                    {{0, 1}, {1, 2}, {2, 3}, {3, 4}}, // List of edges in the graph
+                    {"0", "1", "2", "3", "4"}},       // Expected result of the BFS search
+                BfsTestParameters{
+                    5,
+                    0,
+                    4,
+                    {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {0, 3}},
+                    {"0", "3", "4"}},
+                BfsTestParameters{
+                    4,
+                    3,
+                    0,
+                    {{0, 1}, {0, 2}, {1, 3}, {2, 3}},
+                    {}},
+                BfsTestParameters{
+                    3,
+                    1,
+                    1,
+                    {{0, 1}, {1, 2}},
+                    {"1"}}
+                ));
+
+        TEST_P(BfsTest, SearchPathExists)
+        {
+            // Get the parameters for the test
+            BfsTestParameters props = GetParam();
+            // Check if the result contains the expected path
+            EXPECT_EQ(result, props.expected_result)
+                << "The path for BFS search does not match the expected result";
+        }
+
+        TEST_F(BfsLargeGraphTest, ShortestHopCountAcrossThreads)
+        {
+            CsrGraph<T, D> graph_evn = CsrGraph<T, D>(nodes, edges, cost_function);
+            graph_evn.initialize();
+            for (const std::size_t num_threads : {1, 4})
+            {
+                std::vector<std::pair<const Node<T, D> *, double>> path = BFS<T, D, CsrGraph<T, D>>(num_threads).search(
+                    *graph_evn.get_node(0), *graph_evn.get_node(width * height - 1), graph_evn);
+                // Corner to corner of a 4-connected grid takes (width - 1) + (height - 1) hops
+                ASSERT_EQ(path.size(), width + height - 1) << "BFS did not return a shortest path with " << num_threads << " threads";
+                EXPECT_DOUBLE_EQ(path.back().second, static_cast<double>(width + height - 2));
+                for (std::size_t idx = 1; idx < path.size(); ++idx)
+                {
+                    const std::size_t from = std::stoul(path[idx - 1].first->get_name());
+                    const std::size_t to = std::stoul(path[idx].first->get_name());
+                    const std::size_t delta = from > to ? from - to : to - from;
+                    EXPECT_TRUE(delta == 1 || delta == width) << "BFS path uses a non existent edge";
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/**
+ * @file csr_graph_test.cpp
+ * @brief Unit tests for the CSR graph environment.
+ */
+
+#include <gtest/gtest.h>
+#include <csr_graph_test.h>
+
+namespace search
+{
+    namespace search_csr_graph_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            CsrGraphTestSuite,
+            CsrGraphTest,
+            ::testing::Values(
+                CsrGraphTestParameters{
+                    5,                                // Number of nodes in the graph
+                    0,                                // Index of the start node
+                    4,                                // Index of the goal node
+                    {{0, 1}, {1, 2}, {2, 3}, {3, 4}}, // List of edges in the graph
+                    {"0", "1", "2", "3", "4"}},       // Expected result of the DFS search
+                CsrGraphTestParameters{
+                    4,
+                    0,
+                    3,
+                    {{0, 1}, {0, 2}, {1, 3}, {2, 3}},
+                    {"0", "2", "3"}},
+                CsrGraphTestParameters{
+                    4,
+                    3,
+                    0,
+                    {{0, 1}, {0, 2}, {1, 3}, {2, 3}},
+                    {}}
+                ));
+
+        TEST_P(CsrGraphTest, SearchPathExists)
+        {
+            // Get the parameters for the test
+            CsrGraphTestParameters props = GetParam();
+            // Check if the result contains the expected path
+            EXPECT_EQ(result, props.expected_result)
+                << "The path for DFS search on the CSR graph does not match the expected result";
+        }
+
+        TEST_P(CsrGraphTest, AllEdgesStored)
+        {
+            // Get the parameters for the test
+            CsrGraphTestParameters props = GetParam();
+            // Check that every edge made it into the CSR adjacency
+            EXPECT_EQ(num_edges, props.edges.size())
+                << "The CSR adjacency does not hold every edge of the graph";
+        }
+
+        TEST(CsrGraphNodeIdTest, NodeIdsFollowTheNodeOrder)
+        {
+            using T = double;
+            constexpr unsigned int D = 1;
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            for (std::size_t i = 0; i < 100; ++i)
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << static_cast<T>(i);
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(i)));
+            }
+            // Ids follow the given order, not the node addresses
+            std::vector<Node<T, D> *> shuffled_nodes;
+            for (std::size_t i = 0; i < nodes.size(); ++i)
+            {
+                shuffled_nodes.push_back(nodes[(37 * i) % nodes.size()].get());
+            }
+            const DefaultCost<T, D> cost_function;
+            CsrGraph<T, D> graph_evn(shuffled_nodes, std::vector<std::pair<std::size_t, std::size_t>>{{0, 1}}, cost_function);
+            graph_evn.initialize();
+            for (std::uint32_t id = 0; id < shuffled_nodes.size(); ++id)
+            {
+                EXPECT_EQ(graph_evn.get_node_id(*shuffled_nodes[id]), id);
+            }
+            NodeValue<T, D> foreign_value;
+            foreign_value.value << 0.0;
+            const Node<T, D> foreign_node(foreign_value, "foreign");
+            EXPECT_THROW(graph_evn.get_node_id(foreign_node), std::invalid_argument);
+        }
+    }
+}
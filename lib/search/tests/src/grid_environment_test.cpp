@@ -0,0 +1,145 @@
+/**
+ * @file grid_environment_test.cpp
+ * @brief Unit tests for the GridEnvironment and JPS.
+ */
+
+#include <gtest/gtest.h>
+#include <grid_environment_test.h>
+
+namespace search
+{
+    namespace search_grid_environment_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            GridEnvironmentTestSuite,
+            GridEnvironmentTest,
+            ::testing::Values(
+                RandomGridTestParameters{
+                    1,     // Width of the grid
+                    1,     // Height of the grid
+                    true,  // Whether diagonal moves are allowed
+                    0.0,   // Fraction of randomly blocked cells
+                    1},    // Seed of the obstacle generator
+                RandomGridTestParameters{
+                    32,
+                    32,
+                    true,
+                    0.0,
+                    1},
+                RandomGridTestParameters{
+                    64,
+                    48,
+                    true,
+                    0.2,
+                    7},
+                RandomGridTestParameters{
+                    50,
+                    50,
+                    true,
+                    0.35,
+                    11},
+                RandomGridTestParameters{
+                    40,
+                    30,
+                    false,
+                    0.25,
+                    3},
+                RandomGridTestParameters{
+                    30,
+                    30,
+                    true,
+                    0.6,
+                    5}));
+
+        TEST_P(GridEnvironmentTest, SearchMatchesUniformCostSearch)
+        {
+            RandomGridTestParameters props = GetParam();
+            const std::vector<std::pair<const Node<T, D> *, double>> a_star_path = grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::A_STAR);
+            const std::vector<std::pair<const Node<T, D> *, double>> bfs_path = grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::BFS);
+            const std::vector<std::pair<const Node<T, D> *, double>> dfs_path = grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::DFS);
+            ASSERT_EQ(a_star_path.empty(), ucs_path.empty());
+            ASSERT_EQ(bfs_path.empty(), ucs_path.empty());
+            ASSERT_EQ(dfs_path.empty(), ucs_path.empty());
+            EXPECT_TRUE(follows_grid_moves(ucs_path));
+            EXPECT_TRUE(follows_grid_moves(a_star_path));
+            EXPECT_TRUE(follows_grid_moves(bfs_path));
+            EXPECT_TRUE(follows_grid_moves(dfs_path));
+            if (!ucs_path.empty())
+            {
+                EXPECT_NEAR(a_star_path.back().second, ucs_path.back().second, utils::floating_point_precision);
+                EXPECT_EQ(ucs_path.front().first->get_node_value().value, start_node->get_node_value().value);
+                EXPECT_EQ(ucs_path.back().first->get_node_value().value, goal_node->get_node_value().value);
+            }
+            if (!props.allow_diagonal)
+            {
+                EXPECT_THROW(grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::JPS), std::invalid_argument);
+                return;
+            }
+            const std::vector<std::pair<const Node<T, D> *, double>> jps_path = grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::JPS);
+            ASSERT_EQ(jps_path.empty(), ucs_path.empty());
+            EXPECT_TRUE(follows_grid_moves(jps_path)) << "The JPS path does not follow the grid moves";
+            if (!ucs_path.empty())
+            {
+                EXPECT_NEAR(jps_path.back().second, ucs_path.back().second, utils::floating_point_precision);
+            }
+        }
+
+        TEST_P(GridEnvironmentTest, JumpPointSearchMatchesEveryGoal)
+        {
+            RandomGridTestParameters props = GetParam();
+            if (!props.allow_diagonal)
+            {
+                GTEST_SKIP() << "JPS needs diagonal moves";
+            }
+            SearchWorkspace workspace;
+            for (std::uint32_t goal_id = 0; goal_id < grid_evn->get_num_nodes(); goal_id += 7)
+            {
+                const Node<T, D> &goal = *grid_evn->get_node(goal_id);
+                const std::vector<std::pair<const Node<T, D> *, double>> ucs_path = grid_evn->search(*start_node, goal, utils::SearchAlgorithm::UCS, workspace);
+                const std::vector<std::pair<const Node<T, D> *, double>> jps_path = grid_evn->search(*start_node, goal, utils::SearchAlgorithm::JPS, workspace);
+                ASSERT_EQ(jps_path.empty(), ucs_path.empty()) << "Goal id: " << goal_id;
+                if (!ucs_path.empty())
+                {
+                    EXPECT_NEAR(jps_path.back().second, ucs_path.back().second, utils::floating_point_precision) << "Goal id: " << goal_id;
+                    EXPECT_EQ(jps_path.back().first, &goal);
+                }
+            }
+        }
+
+        TEST(GridEnvironmentLayoutTest, CellsAndMoves)
+        {
+            GridEnvironment<double, 3> grid({4, 3, 2}, true);
+            EXPECT_EQ(grid.get_num_nodes(), 24U);
+            EXPECT_EQ(grid.get_id({1, 2, 1}), 1U + 2U * 4U + 1U * 12U);
+            EXPECT_EQ(grid.get_coordinates(21), (GridEnvironment<double, 3>::Coordinates{1, 2, 1}));
+            EXPECT_EQ(grid.get_memory_usage(), sizeof(std::uint64_t));
+            std::size_t num_moves = 0;
+            grid.for_each_edge(grid.get_id({1, 1, 0}), [&](const std::uint32_t, const double)
+                               { ++num_moves; });
+            EXPECT_EQ(num_moves, 17U); // The 3 x 3 x 2 block around the cell
+            // Blocking an axis neighbor removes the moves that would cut through it
+            grid.set_blocked({2, 1, 0});
+            num_moves = 0;
+            grid.for_each_edge(grid.get_id({1, 1, 0}), [&](const std::uint32_t neighbor_id, const double)
+                               {
+                ++num_moves;
+                EXPECT_NE(grid.get_coordinates(neighbor_id)[0], 2U); });
+            EXPECT_EQ(num_moves, 11U);
+            EXPECT_TRUE(grid.is_blocked(grid.get_id({2, 1, 0})));
+            EXPECT_FALSE(grid.is_free({-1, 0, 0}));
+            EXPECT_THROW(grid.set_blocked({4, 0, 0}), std::out_of_range);
+            EXPECT_THROW((GridEnvironment<double, 2>({0, 5})), std::invalid_argument);
+            // Nodes are materialized once per cell and map back to their cell
+            const Node<double, 3> *node = grid.get_node(21);
+            EXPECT_EQ(grid.get_node(21), node);
+            EXPECT_EQ(grid.get_node_id(*node), 21U);
+            NodeValue<double, 3> outside;
+            outside.value << 0.5, 0.0, 0.0;
+            EXPECT_THROW(grid.get_node_id(Node<double, 3>(outside)), std::invalid_argument);
+            EXPECT_THROW(grid.search(*grid.get_node(0), *grid.get_node(23), utils::SearchAlgorithm::JPS), std::invalid_argument);
+            const std::vector<std::pair<const Node<double, 3> *, double>> path = grid.search(*grid.get_node(0), *grid.get_node(23), utils::SearchAlgorithm::UCS);
+            ASSERT_FALSE(path.empty());
+            EXPECT_NEAR(path.back().second, std::sqrt(2.0) + std::sqrt(3.0) + 1.0, utils::floating_point_precision);
+        }
+    }
+}
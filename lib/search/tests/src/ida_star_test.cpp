@@ -0,0 +1,144 @@
+/**
+ * @file ida_star_test.cpp
+ * @brief Unit tests for the IDA* algorithm.
+ */
+
+#include <gtest/gtest.h>
+#include <ida_star_test.h>
+
+namespace search
+{
+    namespace search_ida_star_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            IdaStarTestSuite,
+            IdaStarTest,
+            ::testing::Values(
+                RandomGridTestParameters{
+                    2,     // Width of the grid
+                    2,     // Height of the grid
+                    false, // Whether diagonal moves are allowed
+                    0.0,   // Fraction of randomly blocked cells
+                    1},    // Seed of the obstacle generator
+                RandomGridTestParameters{
+                    12,
+                    10,
+                    false,
+                    0.0,
+                    1},
+                RandomGridTestParameters{
+                    10,
+                    10,
+                    false,
+                    0.2,
+                    7},
+                RandomGridTestParameters{
+                    8,
+                    8,
+                    true,
+                    0.15,
+                    3},
+                RandomGridTestParameters{
+                    8,
+                    8,
+                    false,
+                    0.4,
+                    1}));
+
+        TEST_P(IdaStarTest, SearchMatchesUniformCostSearch)
+        {
+            RandomGridTestParameters props = GetParam();
+            const IdaStar<T, D, GridEnvironment<T, D>> ida_star;
+            const std::vector<std::pair<const Node<T, D> *, double>> path = ida_star.search(*start_node, *goal_node, *grid_evn);
+            ASSERT_EQ(path.empty(), ucs_path.empty());
+            // The environment dispatch runs the same search
+            EXPECT_EQ(grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::IDA_STAR), path);
+            if (ucs_path.empty())
+            {
+                return;
+            }
+            EXPECT_TRUE(is_valid_path(path));
+            EXPECT_NEAR(path.back().second, ucs_path.back().second, utils::floating_point_precision);
+            EXPECT_GE(ida_star.get_num_iterations(), 1U);
+            EXPECT_LE(ida_star.get_num_reexpansions(), ida_star.get_num_expansions());
+            EXPECT_FALSE(ida_star.is_memory_limited());
+            if (props.width > 1 && props.obstacle_density > 0.0 && !props.allow_diagonal)
+            {
+                // Obstacles force detours past the first bound, so later iterations repeat work
+                EXPECT_GT(ida_star.get_num_iterations(), 1U);
+                EXPECT_GT(ida_star.get_num_reexpansions(), 0U);
+            }
+        }
+
+        TEST_P(IdaStarTest, MemoryLimitCutsLongPaths)
+        {
+            // Every parameter set has a path of at least 3 nodes
+            ASSERT_GE(ucs_path.size(), 3U);
+            // Room for the path only up to the node before the goal, with no successors
+            const IdaStar<T, D, GridEnvironment<T, D>> ida_star(EuclideanHeuristic<T, D>(), 48 * (ucs_path.size() - 2));
+            EXPECT_TRUE(ida_star.search(*start_node, *goal_node, *grid_evn).empty());
+            EXPECT_TRUE(ida_star.is_memory_limited());
+            EXPECT_EQ(ida_star.get_memory_limit(), 48 * (ucs_path.size() - 2));
+            EXPECT_THROW((IdaStar<T, D, GridEnvironment<T, D>>(EuclideanHeuristic<T, D>(), 1)), std::invalid_argument);
+        }
+
+        TEST(IdaStarEdgeCaseTest, TrivialAndUnreachableGoals)
+        {
+            using T = int;
+            constexpr unsigned int D = 2;
+            // A wall down the middle column cuts the corners apart
+            GridEnvironment<T, D> grid_evn(GridEnvironment<T, D>::Coordinates{3, 3}, false);
+            for (std::uint32_t y = 0; y < 3; ++y)
+            {
+                grid_evn.set_blocked({1, y}, true);
+            }
+            grid_evn.initialize();
+            NodeValue<T, D> start_value;
+            start_value.value << 0, 0;
+            NodeValue<T, D> goal_value;
+            goal_value.value << 2, 2;
+            const Node<T, D> start_node(start_value);
+            const Node<T, D> goal_node(goal_value);
+            const IdaStar<T, D, GridEnvironment<T, D>> ida_star;
+            EXPECT_TRUE(ida_star.search(start_node, goal_node, grid_evn).empty());
+            EXPECT_TRUE(grid_evn.search(start_node, goal_node, utils::SearchAlgorithm::IDA_STAR).empty());
+            const std::vector<std::pair<const Node<T, D> *, double>> path = ida_star.search(start_node, start_node, grid_evn);
+            ASSERT_EQ(path.size(), 1U);
+            EXPECT_EQ(path.front().first->get_node_value().value, start_value.value);
+            EXPECT_EQ(path.front().second, 0.0);
+        }
+
+        TEST(IdaStarEdgeCaseTest, MemoryCutOffIsReported)
+        {
+            using T = double;
+            constexpr unsigned int D = 2;
+            // The cheap path 0 -> 1 -> 2 runs through a node with too many successors to fit, the detour 0 -> 3 -> 4 -> 5 -> 2 fits
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            for (std::size_t idx = 0; idx < 106; ++idx)
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << static_cast<T>(idx), 0.0;
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(idx)));
+            }
+            std::vector<std::pair<std::size_t, std::size_t>> edges = {{0, 1}, {1, 2}, {0, 3}, {3, 4}, {4, 5}, {5, 2}};
+            for (std::size_t idx = 6; idx < nodes.size(); ++idx)
+            {
+                edges.emplace_back(1, idx);
+            }
+            const DefaultCost<T, D> cost_function(1.0);
+            Graph<T, D> graph_evn(nodes, edges, cost_function);
+            graph_evn.initialize();
+            const IdaStar<T, D, Graph<T, D>, ZeroHeuristic<T, D>> ida_star(ZeroHeuristic<T, D>(), 512);
+            const std::vector<std::pair<const Node<T, D> *, double>> path = ida_star.search(*nodes[0], *nodes[2], graph_evn);
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(path.back().second, 4.0);
+            EXPECT_TRUE(ida_star.is_memory_limited()) << "The costlier path is not reported";
+            // With room for every successor the cheap path is found
+            const IdaStar<T, D, Graph<T, D>, ZeroHeuristic<T, D>> roomy_ida_star;
+            const std::vector<std::pair<const Node<T, D> *, double>> roomy_path = roomy_ida_star.search(*nodes[0], *nodes[2], graph_evn);
+            ASSERT_FALSE(roomy_path.empty());
+            EXPECT_EQ(roomy_path.back().second, 2.0);
+            EXPECT_FALSE(roomy_ida_star.is_memory_limited());
+        }
+    }
+}
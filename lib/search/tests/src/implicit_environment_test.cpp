@@ -0,0 +1,301 @@
+/**
+ * @file implicit_environment_test.cpp
+ * @brief Unit tests for the ImplicitEnvironment and the StateTable.
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <implicit_environment_test.h>
+
+namespace search
+{
+    namespace search_implicit_environment_tests
+    {
+        TEST(StateTableTest, InternsStatesUnderDenseIds)
+        {
+            StateTable<double, 3> state_table;
+            const std::size_t num_states = 10000;
+            for (std::size_t idx = 0; idx < num_states; ++idx)
+            {
+                const std::pair<std::uint32_t, bool> inserted = state_table.insert(math::ColumnVector<double, 3>(idx * 0.5, -1.0 * idx, 7.0));
+                EXPECT_EQ(inserted.first, idx);
+                EXPECT_TRUE(inserted.second);
+            }
+            EXPECT_EQ(state_table.size(), num_states);
+            // Ids survive the rehashes and duplicates are not inserted again
+            for (std::size_t idx = 0; idx < num_states; idx += 97)
+            {
+                const math::ColumnVector<double, 3> state(idx * 0.5, -1.0 * idx, 7.0);
+                EXPECT_EQ(state_table.insert(state), std::make_pair(static_cast<std::uint32_t>(idx), false));
+                EXPECT_EQ(state_table.find(state), static_cast<std::uint32_t>(idx));
+                EXPECT_EQ(state_table.get_state(static_cast<std::uint32_t>(idx)), state);
+            }
+            EXPECT_EQ(state_table.size(), num_states);
+            EXPECT_FALSE(state_table.find(math::ColumnVector<double, 3>(0.25, 0.0, 7.0)).has_value());
+            EXPECT_THROW(state_table.get_state(static_cast<std::uint32_t>(num_states)), std::out_of_range);
+            EXPECT_GE(state_table.get_memory_usage(), num_states * (3 * sizeof(double) + sizeof(std::uint64_t)));
+            state_table.clear();
+            EXPECT_EQ(state_table.size(), 0U);
+            EXPECT_FALSE(state_table.find(math::ColumnVector<double, 3>(0.0, 0.0, 7.0)).has_value());
+            EXPECT_EQ(state_table.insert(math::ColumnVector<double, 3>(1.0, 2.0, 3.0)), std::make_pair(0U, true));
+        }
+
+        TEST_F(ImplicitEnvironmentTest, SearchMatchesGridEnvironment)
+        {
+            const std::unique_ptr<Node<T, D>> start_node = make_node(0, 0);
+            const std::unique_ptr<Node<T, D>> goal_node = make_node(width - 1, height - 1);
+            for (const utils::SearchAlgorithm search_algorithm : {utils::SearchAlgorithm::UCS, utils::SearchAlgorithm::A_STAR, utils::SearchAlgorithm::BFS, utils::SearchAlgorithm::DFS})
+            {
+                const std::vector<std::pair<const Node<T, D> *, double>> grid_path = grid_evn->search(*start_node, *goal_node, search_algorithm);
+                const std::vector<std::pair<const Node<T, D> *, double>> implicit_path = implicit_evn->search(*start_node, *goal_node, search_algorithm);
+                ASSERT_EQ(implicit_path.empty(), grid_path.empty());
+                if (grid_path.empty())
+                {
+                    continue;
+                }
+                EXPECT_EQ(implicit_path.front().first->get_node_value().value, start_node->get_node_value().value);
+                EXPECT_EQ(implicit_path.back().first->get_node_value().value, goal_node->get_node_value().value);
+                if (search_algorithm == utils::SearchAlgorithm::UCS || search_algorithm == utils::SearchAlgorithm::A_STAR)
+                {
+                    EXPECT_NEAR(implicit_path.back().second, grid_path.back().second, utils::floating_point_precision);
+                }
+                else if (search_algorithm == utils::SearchAlgorithm::BFS)
+                {
+                    EXPECT_EQ(implicit_path.size(), grid_path.size());
+                }
+                // Every step is a move of the lattice
+                for (std::size_t idx = 1; idx < implicit_path.size(); ++idx)
+                {
+                    EXPECT_NEAR(implicit_path[idx].second - implicit_path[idx - 1].second,
+                                implicit_evn->get_cost(*implicit_path[idx - 1].first, *implicit_path[idx].first),
+                                utils::floating_point_precision);
+                }
+            }
+            EXPECT_LE(implicit_evn->get_num_nodes(), static_cast<std::size_t>(width * height));
+            EXPECT_THROW(implicit_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::JPS), std::invalid_argument);
+        }
+
+        TEST_F(ImplicitEnvironmentTest, StatesPersistAcrossQueries)
+        {
+            const std::unique_ptr<Node<T, D>> start_node = make_node(0, 0);
+            const std::unique_ptr<Node<T, D>> goal_node = make_node(width - 1, height - 1);
+            const std::vector<std::pair<const Node<T, D> *, double>> path = implicit_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::UCS);
+            ASSERT_FALSE(path.empty());
+            const std::size_t num_states = implicit_evn->get_num_nodes();
+            // Path nodes map back to their state ids and the same query generates no new state
+            const std::uint32_t goal_id = implicit_evn->get_node_id(*goal_node);
+            EXPECT_EQ(implicit_evn->get_node_id(*path.back().first), goal_id);
+            EXPECT_EQ(implicit_evn->get_node(goal_id), path.back().first);
+            SearchWorkspace workspace;
+            EXPECT_EQ(implicit_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::UCS, workspace), path);
+            EXPECT_EQ(implicit_evn->get_num_nodes(), num_states);
+            EXPECT_GT(implicit_evn->get_memory_usage(), 0U);
+            // A blocked goal is interned but never reached
+            const std::unique_ptr<Node<T, D>> outside_node = make_node(width, 0);
+            EXPECT_TRUE(implicit_evn->search(*start_node, *outside_node, utils::SearchAlgorithm::A_STAR, workspace).empty());
+            EXPECT_EQ(implicit_evn->get_num_nodes(), num_states + 1);
+            EXPECT_THROW(implicit_evn->get_cost(*start_node, *goal_node), std::invalid_argument);
+            implicit_evn->initialize();
+            EXPECT_EQ(implicit_evn->get_num_nodes(), 0U);
+            EXPECT_NEAR(implicit_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::A_STAR, workspace).back().second, path.back().second, utils::floating_point_precision);
+        }
+
+        TEST_F(ImplicitEnvironmentTest, AsyncSearchesRunOneAtATime)
+        {
+            // Queries share the states they intern, so they are serialized on the executor
+            WorkStealingExecutor executor(4);
+            const std::unique_ptr<Node<T, D>> start_node = make_node(0, 0);
+            std::vector<std::unique_ptr<Node<T, D>>> goal_nodes;
+            std::vector<std::future<std::vector<std::pair<const Node<T, D> *, double>>>> futures;
+            for (int y = 0; y < height; y += 3)
+            {
+                for (int x = y % width; x < width; x += 7)
+                {
+                    goal_nodes.emplace_back(make_node(x, y));
+                    futures.emplace_back(implicit_evn->search_async(*start_node, *goal_nodes.back(), utils::SearchAlgorithm::UCS,
+                                                                    utils::TaskPriority::NORMAL, nullptr, executor));
+                }
+            }
+            for (std::size_t idx = 0; idx < futures.size(); ++idx)
+            {
+                const std::vector<std::pair<const Node<T, D> *, double>> path = futures[idx].get();
+                const std::vector<std::pair<const Node<T, D> *, double>> grid_path = grid_evn->search(*start_node, *goal_nodes[idx], utils::SearchAlgorithm::UCS);
+                ASSERT_EQ(path.empty(), grid_path.empty());
+                if (!path.empty())
+                {
+                    EXPECT_NEAR(path.back().second, grid_path.back().second, utils::floating_point_precision);
+                }
+            }
+        }
+
+        TEST(ImplicitEnvironmentAsyncTest, WaitingQueriesLeaveTheWorkersFree)
+        {
+            WorkStealingExecutor executor(2);
+            ImplicitEnvironment<int, 2, LatticeGenerator> implicit_evn(LatticeGenerator{0, 0, nullptr}, 1U << 22);
+            NodeValue<int, 2> node_value;
+            node_value.value << 0, 0;
+            const Node<int, 2> start_node(node_value, "start");
+            node_value.value << 5000, 5000;
+            const Node<int, 2> far_node(node_value, "far");
+            node_value.value << 2, 1;
+            const Node<int, 2> near_node(node_value, "near");
+            // The first query runs until it is cancelled, the others wait for it without taking a worker
+            CancellationToken token;
+            std::future<std::vector<std::pair<const Node<int, 2> *, double>>> far_future = implicit_evn.search_async(start_node, far_node, utils::SearchAlgorithm::UCS,
+                                                                                                                      utils::TaskPriority::NORMAL, &token, executor);
+            std::vector<std::future<std::vector<std::pair<const Node<int, 2> *, double>>>> near_futures;
+            for (std::size_t idx = 0; idx < 4; ++idx)
+            {
+                near_futures.emplace_back(implicit_evn.search_async(start_node, near_node, utils::SearchAlgorithm::UCS, utils::TaskPriority::HIGH, nullptr, executor));
+            }
+            std::future<bool> other_task = executor.submit([]()
+                                                           { return true; });
+            const std::future_status other_status = other_task.wait_for(std::chrono::seconds(10));
+            const std::future_status near_status = near_futures.front().wait_for(std::chrono::seconds(0));
+            token.cancel();
+            EXPECT_EQ(other_status, std::future_status::ready) << "A waiting query holds a worker";
+            EXPECT_EQ(near_status, std::future_status::timeout) << "A query ran before the one ahead of it";
+            try
+            {
+                EXPECT_TRUE(far_future.get().empty());
+            }
+            catch (const std::length_error &)
+            {
+                // The far query may run out of states before it is cancelled
+            }
+            for (std::future<std::vector<std::pair<const Node<int, 2> *, double>>> &near_future : near_futures)
+            {
+                const std::vector<std::pair<const Node<int, 2> *, double>> path = near_future.get();
+                ASSERT_FALSE(path.empty());
+                EXPECT_NEAR(path.back().second, 1.0 + std::sqrt(2.0), utils::floating_point_precision);
+            }
+        }
+
+        TEST_F(ImplicitEnvironmentTest, SearchBatchMatchesSearch)
+        {
+            // Queries sharing a start run as one search, on several threads for the grid and on the calling thread otherwise
+            std::vector<std::unique_ptr<Node<T, D>>> batch_nodes;
+            std::vector<SearchQuery<T, D>> queries;
+            for (int y = 0; y < height; y += 4)
+            {
+                for (int x = (3 * y) % width; x < width; x += 9)
+                {
+                    batch_nodes.emplace_back(make_node((y % 8 == 0) ? 0 : width - 1, (y % 8 == 0) ? 0 : height - 1));
+                    batch_nodes.emplace_back(make_node(x, y));
+                    queries.push_back({batch_nodes[batch_nodes.size() - 2].get(), batch_nodes.back().get()});
+                }
+            }
+            for (const utils::SearchAlgorithm search_algorithm : {utils::SearchAlgorithm::UCS, utils::SearchAlgorithm::BFS})
+            {
+                const SearchBatchResult<T, D> grid_batch = grid_evn->search_batch(queries, search_algorithm, 4);
+                const SearchBatchResult<T, D> implicit_batch = implicit_evn->search_batch(queries, search_algorithm, 4);
+                ASSERT_EQ(grid_batch.size(), queries.size());
+                ASSERT_EQ(implicit_batch.size(), queries.size());
+                for (std::size_t query = 0; query < queries.size(); ++query)
+                {
+                    const std::vector<std::pair<const Node<T, D> *, double>> path = grid_evn->search(*queries[query].start_node, *queries[query].goal_node, search_algorithm);
+                    ASSERT_EQ(grid_batch.has_path(query), !path.empty());
+                    ASSERT_EQ(implicit_batch.has_path(query), !path.empty());
+                    if (path.empty())
+                    {
+                        continue;
+                    }
+                    if (search_algorithm == utils::SearchAlgorithm::UCS)
+                    {
+                        EXPECT_NEAR(grid_batch.get_cost(query), path.back().second, utils::floating_point_precision);
+                        EXPECT_NEAR(implicit_batch.get_cost(query), path.back().second, utils::floating_point_precision);
+                    }
+                    else
+                    {
+                        EXPECT_EQ(grid_batch.get_path_nodes(query).size(), path.size());
+                        EXPECT_EQ(implicit_batch.get_path_nodes(query).size(), path.size());
+                    }
+                    EXPECT_EQ(implicit_batch.get_path_nodes(query).back()->get_node_value().value, queries[query].goal_node->get_node_value().value);
+                }
+            }
+        }
+
+        TEST_F(ImplicitEnvironmentTest, ManyToManySearchMatchesGridEnvironment)
+        {
+            std::vector<std::unique_ptr<Node<T, D>>> matrix_nodes;
+            std::vector<const Node<T, D> *> sources;
+            std::vector<const Node<T, D> *> targets;
+            for (int idx = 0; idx < 6; ++idx)
+            {
+                matrix_nodes.emplace_back(make_node((7 * idx) % width, (5 * idx) % height));
+                sources.push_back(matrix_nodes.back().get());
+                matrix_nodes.emplace_back(make_node(width - 1 - (3 * idx) % width, height - 1 - (4 * idx) % height));
+                targets.push_back(matrix_nodes.back().get());
+            }
+            // Implicit searches intern states, so they run on one thread whatever the thread count - grid searches do not
+            static_assert(!ConcurrentEnvironment<ImplicitEnvironment<T, D, LatticeGenerator>, T, D>);
+            static_assert(ConcurrentEnvironment<GridEnvironment<T, D>, T, D>);
+            const math::DynamicMatrix<double> implicit_distances = ManyToManySearch<T, D, ImplicitEnvironment<T, D, LatticeGenerator>>(4).search(sources, targets, *implicit_evn);
+            const math::DynamicMatrix<double> grid_distances = ManyToManySearch<T, D, GridEnvironment<T, D>>(4).search(sources, targets, *grid_evn);
+            for (std::size_t row = 0; row < sources.size(); ++row)
+            {
+                for (std::size_t column = 0; column < targets.size(); ++column)
+                {
+                    if (std::isinf(grid_distances(row, column)))
+                    {
+                        EXPECT_TRUE(std::isinf(implicit_distances(row, column)));
+                    }
+                    else
+                    {
+                        EXPECT_NEAR(implicit_distances(row, column), grid_distances(row, column), utils::floating_point_precision);
+                    }
+                }
+            }
+            // Expanding the frontier of a search reaches new states, which have no row in an all pairs matrix
+            const ImplicitEnvironment<T, D, LatticeGenerator> unbounded_evn(LatticeGenerator{0, 0, nullptr});
+            const std::unique_ptr<Node<T, D>> corner_node = make_node(0, 0);
+            const std::unique_ptr<Node<T, D>> next_node = make_node(1, 0);
+            ASSERT_EQ(unbounded_evn.search(*corner_node, *next_node, utils::SearchAlgorithm::UCS).size(), 2U);
+            EXPECT_THROW((ManyToManySearch<T, D, ImplicitEnvironment<T, D, LatticeGenerator>>(4).floyd_warshall(unbounded_evn)), std::invalid_argument);
+            // A fully interned lattice has every edge inside the matrix
+            const ImplicitEnvironment<T, D, LatticeGenerator> small_evn(LatticeGenerator{3, 3, nullptr});
+            const std::unique_ptr<Node<T, D>> far_corner_node = make_node(2, 2);
+            const std::unique_ptr<Node<T, D>> outside_node = make_node(3, 3);
+            EXPECT_TRUE(small_evn.search(*corner_node, *outside_node, utils::SearchAlgorithm::BFS).empty());
+            ASSERT_EQ(small_evn.get_num_nodes(), 10U);
+            const math::DynamicMatrix<double> all_pairs = ManyToManySearch<T, D, ImplicitEnvironment<T, D, LatticeGenerator>>(1).floyd_warshall(small_evn);
+            EXPECT_NEAR(all_pairs(small_evn.get_node_id(*corner_node), small_evn.get_node_id(*far_corner_node)), 2.0 * std::sqrt(2.0), utils::floating_point_precision);
+        }
+
+        TEST_F(ImplicitEnvironmentTest, ThrowingAsyncSearchReleasesItsToken)
+        {
+            // One worker, so both queries run with the same workspace
+            WorkStealingExecutor executor(1);
+            const std::unique_ptr<Node<T, D>> start_node = make_node(0, 0);
+            const std::unique_ptr<Node<T, D>> goal_node = make_node(width - 1, height - 1);
+            ImplicitEnvironment<T, D, LatticeGenerator> capped_evn(LatticeGenerator{width, height, &blocked}, 10);
+            CancellationToken token;
+            EXPECT_THROW(capped_evn.search_async(*start_node, *goal_node, utils::SearchAlgorithm::UCS, utils::TaskPriority::NORMAL, &token, executor).get(),
+                         std::length_error);
+            token.cancel();
+            const std::vector<std::pair<const Node<T, D> *, double>> grid_path = grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::UCS);
+            ASSERT_FALSE(grid_path.empty());
+            EXPECT_FALSE(implicit_evn->search_async(*start_node, *goal_node, utils::SearchAlgorithm::UCS, utils::TaskPriority::NORMAL, nullptr, executor).get().empty());
+        }
+
+        TEST(ImplicitEnvironmentUnboundedTest, SearchesAnUnboundedLattice)
+        {
+            // The lattice moves are as long as the distance they cover, so the Euclidean heuristic never overestimates
+            ImplicitEnvironment<int, 2, LatticeGenerator, EuclideanHeuristic<int, 2>> implicit_evn(LatticeGenerator{0, 0, nullptr}, StateTable<int, 2>::max_size(), 0, EuclideanHeuristic<int, 2>());
+            NodeValue<int, 2> start_value;
+            start_value.value << -20, 5;
+            NodeValue<int, 2> goal_value;
+            goal_value.value << 280, 105;
+            const Node<int, 2> start_node(start_value, "start");
+            const Node<int, 2> goal_node(goal_value, "goal");
+            const std::vector<std::pair<const Node<int, 2> *, double>> path = implicit_evn.search(start_node, goal_node, utils::SearchAlgorithm::A_STAR);
+            ASSERT_EQ(path.size(), 301U);
+            EXPECT_NEAR(path.back().second, 200.0 + 100.0 * std::sqrt(2.0), utils::floating_point_precision);
+            // A capped environment runs out of states instead of memory
+            ImplicitEnvironment<int, 2, LatticeGenerator> capped_evn(LatticeGenerator{0, 0, nullptr}, 1000);
+            EXPECT_EQ(capped_evn.get_max_states(), 1000U);
+            EXPECT_THROW(capped_evn.search(start_node, goal_node, utils::SearchAlgorithm::UCS), std::length_error);
+        }
+    }
+
+} // namespace search
@@ -0,0 +1,144 @@
+/**
+ * @file kd_tree_test.cpp
+ * @brief Unit tests for the KdTree.
+ */
+
+#include <gtest/gtest.h>
+#include <kd_tree_test.h>
+#include <search/environment/graph.h>
+#include <search/cost/distance_cost.h>
+
+namespace search
+{
+    namespace search_kd_tree_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            KdTreeTestSuite,
+            KdTreeTest,
+            ::testing::Values(
+                KdTreeTestParameters{
+                    1,                                 // Number of indexed node values
+                    10,                                // Coordinates are drawn from [-max_coordinate, max_coordinate]
+                    utils::DistanceMetric::EUCLIDEAN,  // Distance metric
+                    8,                                 // Maximum number of values in a leaf
+                    3,                                 // Number of neighbors of the k nearest queries
+                    5.0},                              // Radius of the radius queries
+                KdTreeTestParameters{
+                    1000,
+                    100,
+                    utils::DistanceMetric::EUCLIDEAN,
+                    8,
+                    10,
+                    20.0},
+                KdTreeTestParameters{
+                    1000,
+                    100,
+                    utils::DistanceMetric::MANHATTAN,
+                    1,
+                    10,
+                    30.0},
+                KdTreeTestParameters{
+                    2000,
+                    3,
+                    utils::DistanceMetric::EUCLIDEAN,
+                    4,
+                    25,
+                    1.5},
+                KdTreeTestParameters{
+                    2000,
+                    3,
+                    utils::DistanceMetric::MANHATTAN,
+                    16,
+                    25,
+                    2.0}));
+
+        TEST_P(KdTreeTest, QueriesMatchLinearScan)
+        {
+            KdTreeTestParameters props = GetParam();
+            ASSERT_EQ(kd_tree->size(), props.num_values);
+            for (Eigen::Index idx = 0; idx < queries.cols(); ++idx)
+            {
+                const math::ColumnVector<double, 3> query = queries.col(idx);
+                const std::vector<std::pair<std::uint32_t, double>> expected = scan(query);
+                const std::pair<std::uint32_t, double> nearest = kd_tree->nearest(query);
+                EXPECT_EQ(nearest.first, expected.front().first) << "Query " << idx;
+                EXPECT_NEAR(nearest.second, expected.front().second, utils::floating_point_precision);
+                const std::vector<std::pair<std::uint32_t, double>> k_nearest = kd_tree->k_nearest(query, props.k);
+                ASSERT_EQ(k_nearest.size(), std::min(props.k, expected.size()));
+                for (std::size_t rank = 0; rank < k_nearest.size(); ++rank)
+                {
+                    EXPECT_EQ(k_nearest[rank].first, expected[rank].first) << "Query " << idx << " rank " << rank;
+                    EXPECT_NEAR(k_nearest[rank].second, expected[rank].second, utils::floating_point_precision);
+                }
+                const std::vector<std::pair<std::uint32_t, double>> within = kd_tree->radius_search(query, props.radius);
+                const std::size_t num_within = std::count_if(expected.begin(), expected.end(), [&](const std::pair<std::uint32_t, double> &match)
+                                                             { return match.second <= props.radius; });
+                ASSERT_EQ(within.size(), num_within) << "Query " << idx;
+                for (std::size_t rank = 0; rank < within.size(); ++rank)
+                {
+                    EXPECT_EQ(within[rank].first, expected[rank].first);
+                }
+            }
+        }
+
+        TEST_P(KdTreeTest, BatchMatchesSingleQueries)
+        {
+            KdTreeTestParameters props = GetParam();
+            const std::vector<std::pair<std::uint32_t, double>> nearest = kd_tree->nearest_batch(queries, 4);
+            const std::vector<std::vector<std::pair<std::uint32_t, double>>> k_nearest = kd_tree->k_nearest_batch(queries, props.k, 4);
+            const std::vector<std::vector<std::pair<std::uint32_t, double>>> within = kd_tree->radius_search_batch(queries, props.radius, 4);
+            ASSERT_EQ(nearest.size(), static_cast<std::size_t>(queries.cols()));
+            ASSERT_EQ(k_nearest.size(), static_cast<std::size_t>(queries.cols()));
+            ASSERT_EQ(within.size(), static_cast<std::size_t>(queries.cols()));
+            for (Eigen::Index idx = 0; idx < queries.cols(); ++idx)
+            {
+                const math::ColumnVector<double, 3> query = queries.col(idx);
+                EXPECT_EQ(nearest[idx], kd_tree->nearest(query));
+                EXPECT_EQ(k_nearest[idx], kd_tree->k_nearest(query, props.k));
+                EXPECT_EQ(within[idx], kd_tree->radius_search(query, props.radius));
+            }
+        }
+
+        TEST(KdTreeEnvironmentTest, SnapsCoordinatesToGraphNodes)
+        {
+            using T = double;
+            constexpr unsigned int D = 2;
+            // A 10 x 10 lattice of nodes connected to their right and upper neighbors
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            std::vector<std::pair<std::size_t, std::size_t>> edges;
+            for (int y = 0; y < 10; ++y)
+            {
+                for (int x = 0; x < 10; ++x)
+                {
+                    NodeValue<T, D> node_value;
+                    node_value.value << x, y;
+                    nodes.emplace_back(std::make_unique<Node<T, D>>(node_value));
+                    const std::size_t id = static_cast<std::size_t>(y * 10 + x);
+                    if (x < 9)
+                    {
+                        edges.emplace_back(id, id + 1);
+                    }
+                    if (y < 9)
+                    {
+                        edges.emplace_back(id, id + 10);
+                    }
+                }
+            }
+            DistanceCost<T, D> cost_function = DistanceCost<T, D>(utils::DistanceMetric::EUCLIDEAN);
+            Graph<T, D> graph_evn = Graph<T, D>(nodes, edges, cost_function);
+            graph_evn.initialize();
+            const KdTree<T, D> kd_tree(graph_evn);
+            EXPECT_EQ(kd_tree.size(), graph_evn.get_num_nodes());
+            const std::pair<std::uint32_t, double> start = kd_tree.nearest(math::ColumnVector<double, D>(0.2, -0.4));
+            const std::pair<std::uint32_t, double> goal = kd_tree.nearest(math::ColumnVector<double, D>(6.9, 3.2));
+            EXPECT_EQ(graph_evn.get_node_value(start.first).value, (math::ColumnVector<T, D>(0.0, 0.0)));
+            EXPECT_EQ(graph_evn.get_node_value(goal.first).value, (math::ColumnVector<T, D>(7.0, 3.0)));
+            const std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn.search(*graph_evn.get_node(start.first), *graph_evn.get_node(goal.first), utils::SearchAlgorithm::UCS);
+            ASSERT_FALSE(path.empty());
+            EXPECT_NEAR(path.back().second, 10.0, utils::floating_point_precision);
+            const KdTree<T, D> empty_tree(std::vector<NodeValue<T, D>>{});
+            EXPECT_THROW(empty_tree.nearest(math::ColumnVector<double, D>(0.0, 0.0)), std::out_of_range);
+            EXPECT_TRUE(empty_tree.k_nearest(math::ColumnVector<double, D>(0.0, 0.0), 3).empty());
+        }
+    }
+}
@@ -0,0 +1,160 @@
+/**
+ * @file lpa_star_test.cpp
+ * @brief Unit tests for the LPA* algorithm and the graph mutation API.
+ */
+
+#include <gtest/gtest.h>
+#include <lpa_star_test.h>
+
+namespace search
+{
+    namespace search_lpa_star_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            LpaStarTestSuite,
+            LpaStarTest,
+            ::testing::Values(
+                LpaStarTestParameters{
+                    399,                                           // Index of the goal node
+                    {{EdgeChangeKind::UPDATE, 399 - 20, 399, 50.0}, // Edge changes
+                     {EdgeChangeKind::UPDATE, 398, 399, 50.0},
+                     {EdgeChangeKind::UPDATE, 399 - 20, 399, 1.0},
+                     {EdgeChangeKind::ADD, 0, 399, 10.0},
+                     {EdgeChangeKind::UPDATE, 0, 399, 100.0}}},
+                LpaStarTestParameters{
+                    219,
+                    {{EdgeChangeKind::REMOVE, 0, 1, 0.0},
+                     {EdgeChangeKind::REMOVE, 0, 20, 0.0},
+                     {EdgeChangeKind::ADD, 0, 20, 1.0},
+                     {EdgeChangeKind::UPDATE, 20, 40, 0.0},
+                     {EdgeChangeKind::ADD, 0, 1, 3.0}}},
+                LpaStarTestParameters{
+                    5,
+                    {{EdgeChangeKind::REMOVE, 4, 5, 0.0},
+                     {EdgeChangeKind::REMOVE, 25, 5, 0.0},
+                     {EdgeChangeKind::REMOVE, 6, 5, 0.0},
+                     {EdgeChangeKind::ADD, 6, 5, 2.0}}}));
+
+        TEST_P(LpaStarTest, ReplanMatchesSearchFromScratch)
+        {
+            // Get the parameters for the test
+            LpaStarTestParameters props = GetParam();
+            const Node<T, D> &start_node = *graph_evn->get_node(0);
+            const Node<T, D> &goal_node = *graph_evn->get_node(props.goal_node_index);
+            LpaStar<T, D, Graph<T, D>> lpa_star(*graph_evn, start_node, goal_node);
+            std::vector<std::pair<const Node<T, D> *, double>> path = lpa_star.search();
+            for (const EdgeChange &change : props.changes)
+            {
+                const std::uint64_t version = graph_evn->get_version();
+                apply(change);
+                EXPECT_GT(graph_evn->get_version(), version);
+                lpa_star.notify_edge_change(change.from, change.to);
+                path = lpa_star.search();
+                const std::vector<std::pair<const Node<T, D> *, double>> ucs_path = graph_evn->search(start_node, goal_node, utils::SearchAlgorithm::UCS);
+                ASSERT_EQ(path.empty(), ucs_path.empty());
+                if (!path.empty())
+                {
+                    EXPECT_NEAR(path.back().second, ucs_path.back().second, utils::floating_point_precision);
+                    EXPECT_EQ(path.front().first, &start_node);
+                    EXPECT_EQ(path.back().first, &goal_node);
+                    EXPECT_TRUE(is_valid_path(path)) << "The LPA* path does not follow the graph edges";
+                }
+            }
+        }
+
+        TEST_P(LpaStarTest, RepairTouchesLessThanFullSearch)
+        {
+            // A change far away from the path must not trigger a full replan
+            LpaStarTestParameters props = GetParam();
+            LpaStar<T, D, Graph<T, D>> lpa_star(*graph_evn, *graph_evn->get_node(0), *graph_evn->get_node(props.goal_node_index));
+            lpa_star.search();
+            const std::size_t initial_expansions = lpa_star.get_num_expansions();
+            graph_evn->update_edge_cost(399, 398, 7.0);
+            lpa_star.notify_edge_change(399, 398);
+            lpa_star.search();
+            EXPECT_LT(lpa_star.get_num_expansions(), initial_expansions);
+        }
+
+        TEST_P(LpaStarTest, CancelledSearchResumes)
+        {
+            // A cancelled search keeps its expansions and the next search finishes the repair
+            LpaStarTestParameters props = GetParam();
+            const Node<T, D> &start_node = *graph_evn->get_node(0);
+            const Node<T, D> &goal_node = *graph_evn->get_node(props.goal_node_index);
+            LpaStar<T, D, Graph<T, D>> lpa_star(*graph_evn, start_node, goal_node);
+            CancellationToken token;
+            token.cancel();
+            EXPECT_TRUE(lpa_star.search(token).empty());
+            token.reset();
+            const std::vector<std::pair<const Node<T, D> *, double>> path = lpa_star.search(token);
+            const std::vector<std::pair<const Node<T, D> *, double>> ucs_path = graph_evn->search(start_node, goal_node, utils::SearchAlgorithm::UCS);
+            ASSERT_EQ(path.empty(), ucs_path.empty());
+            if (!path.empty())
+            {
+                EXPECT_NEAR(path.back().second, ucs_path.back().second, utils::floating_point_precision);
+            }
+        }
+
+        TEST_F(LpaStarTest, GraphMutations)
+        {
+            const std::size_t num_edges = graph_evn->get_num_edges();
+            graph_evn->add_edge(0, 399, 3.0);
+            EXPECT_EQ(graph_evn->get_num_edges(), num_edges + 1);
+            EXPECT_EQ(graph_evn->get_neighbor_ids(0).back(), 399U);
+            EXPECT_EQ(graph_evn->get_predecessor_ids(399).back(), 0U);
+            EXPECT_EQ(graph_evn->get_node(0)->get_neighbors().back(), graph_evn->get_node(399));
+            EXPECT_DOUBLE_EQ(graph_evn->get_cost(*graph_evn->get_node(0), *graph_evn->get_node(399)), 3.0);
+            graph_evn->update_edge_cost(0, 399, 4.0);
+            EXPECT_DOUBLE_EQ(graph_evn->get_cost(*graph_evn->get_node(0), *graph_evn->get_node(399)), 4.0);
+            const std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn->search(*graph_evn->get_node(0), *graph_evn->get_node(399), utils::SearchAlgorithm::UCS);
+            EXPECT_EQ(path.size(), 2U);
+            graph_evn->remove_edge(0, 399);
+            EXPECT_EQ(graph_evn->get_num_edges(), num_edges);
+            EXPECT_EQ(graph_evn->get_neighbor_ids(0).size(), 2U);
+            EXPECT_EQ(graph_evn->get_predecessor_ids(399).size(), 2U);
+            EXPECT_EQ(graph_evn->get_node(0)->get_neighbors().size(), 2U);
+            EXPECT_THROW(graph_evn->remove_edge(0, 399), std::invalid_argument);
+            EXPECT_THROW(graph_evn->update_edge_cost(0, 2, 1.0), std::invalid_argument);
+            EXPECT_THROW(graph_evn->add_edge(0, 400), std::out_of_range);
+        }
+
+        TEST(LpaStarZeroCostTest, ZeroCostCyclesAndSelfLoops)
+        {
+            using T = double;
+            constexpr unsigned int D = 1;
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << static_cast<T>(i);
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(i)));
+            }
+            // A line 0 -> ... -> 5 with zero cost two cycles and self loops listed before the forward edges
+            const std::vector<std::pair<std::size_t, std::size_t>> edges = {
+                {1, 1}, {2, 1}, {1, 2}, {3, 3}, {3, 2}, {2, 3}, {0, 1}, {4, 3}, {3, 4}, {5, 5}, {5, 4}, {4, 5}};
+            DefaultCost<T, D> cost_function = DefaultCost<T, D>(0.0);
+            Graph<T, D> graph_evn = Graph<T, D>(nodes, edges, cost_function);
+            graph_evn.initialize(true);
+            const Node<T, D> &start_node = *graph_evn.get_node(0);
+            const Node<T, D> &goal_node = *graph_evn.get_node(5);
+            LpaStar<T, D, Graph<T, D>, ZeroHeuristic<T, D>> lpa_star(graph_evn, start_node, goal_node);
+            const auto check = [&](const std::vector<std::pair<const Node<T, D> *, double>> &path, const double expected_cost)
+            {
+                ASSERT_EQ(path.size(), 6U) << "LPA* must walk the line without revisiting a node";
+                for (std::size_t i = 0; i < path.size(); ++i)
+                {
+                    EXPECT_EQ(path[i].first, graph_evn.get_node(i));
+                }
+                EXPECT_DOUBLE_EQ(path.back().second, expected_cost);
+            };
+            check(lpa_star.search(), 0.0);
+            // Give one forward edge a cost - the zero cost cycles stay around it
+            graph_evn.update_edge_cost(2, 3, 1.0);
+            lpa_star.notify_edge_change(2, 3);
+            check(lpa_star.search(), 1.0);
+            graph_evn.update_edge_cost(2, 3, 0.0);
+            lpa_star.notify_edge_change(2, 3);
+            check(lpa_star.search(), 0.0);
+        }
+    }
+}
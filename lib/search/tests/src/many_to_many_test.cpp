@@ -0,0 +1,108 @@
+/**
+ * @file many_to_many_test.cpp
+ * @brief Unit tests for the many-to-many distance matrices.
+ */
+
+#include <gtest/gtest.h>
+#include <many_to_many_test.h>
+
+namespace search
+{
+    namespace search_many_to_many_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            ManyToManyTestSuite,
+            ManyToManyTest,
+            ::testing::Values(
+                ManyToManyTestParameters{
+                    1,  // Number of nodes in the graph
+                    0,  // Number of random edges in the graph
+                    1,  // Number of random sources
+                    1,  // Number of random targets
+                    64, // Side of the Floyd-Warshall tiles
+                    1,  // Number of threads filling the matrices
+                    1}, // Seed of the graph, source and target generator
+                ManyToManyTestParameters{
+                    30,
+                    120,
+                    7,
+                    0,
+                    1,
+                    2,
+                    5},
+                ManyToManyTestParameters{
+                    50,
+                    200,
+                    10,
+                    20,
+                    7,
+                    4,
+                    7},
+                ManyToManyTestParameters{
+                    150,
+                    400,
+                    25,
+                    40,
+                    64,
+                    8,
+                    3},
+                ManyToManyTestParameters{
+                    200,
+                    2000,
+                    40,
+                    40,
+                    32,
+                    3,
+                    11}));
+
+        TEST_P(ManyToManyTest, MatrixMatchesSearch)
+        {
+            const ManyToManySearch<T, D, Graph<T, D>> many_to_many(GetParam().num_threads);
+            const math::DynamicMatrix<double> distances = many_to_many.search(source_nodes, target_nodes, *graph_evn);
+            ASSERT_EQ(static_cast<std::size_t>(distances.rows()), source_nodes.size());
+            ASSERT_EQ(static_cast<std::size_t>(distances.cols()), target_nodes.size());
+            for (std::size_t row = 0; row < source_nodes.size(); ++row)
+            {
+                for (std::size_t column = 0; column < target_nodes.size(); ++column)
+                {
+                    const std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn->search(*source_nodes[row], *target_nodes[column], utils::SearchAlgorithm::UCS);
+                    if (path.empty())
+                    {
+                        EXPECT_EQ(distances(row, column), std::numeric_limits<double>::infinity());
+                        continue;
+                    }
+                    EXPECT_NEAR(distances(row, column), path.back().second, utils::floating_point_precision);
+                }
+            }
+        }
+
+        TEST_P(ManyToManyTest, FloydWarshallMatchesMatrix)
+        {
+            const ManyToManySearch<T, D, Graph<T, D>> many_to_many(GetParam().num_threads);
+            const math::DynamicMatrix<double> all_pairs = many_to_many.floyd_warshall(*graph_evn, GetParam().block_size);
+            ASSERT_EQ(static_cast<std::size_t>(all_pairs.rows()), graph_evn->get_num_nodes());
+            ASSERT_EQ(static_cast<std::size_t>(all_pairs.cols()), graph_evn->get_num_nodes());
+            std::vector<const Node<T, D> *> all_nodes;
+            for (std::size_t id = 0; id < graph_evn->get_num_nodes(); ++id)
+            {
+                all_nodes.push_back(graph_evn->get_node(id));
+            }
+            const math::DynamicMatrix<double> distances = many_to_many.search(all_nodes, all_nodes, *graph_evn);
+            for (std::size_t row = 0; row < all_nodes.size(); ++row)
+            {
+                EXPECT_EQ(all_pairs(row, row), 0.0);
+                for (std::size_t column = 0; column < all_nodes.size(); ++column)
+                {
+                    if (distances(row, column) == std::numeric_limits<double>::infinity())
+                    {
+                        EXPECT_EQ(all_pairs(row, column), std::numeric_limits<double>::infinity());
+                        continue;
+                    }
+                    EXPECT_NEAR(all_pairs(row, column), distances(row, column), 1e3 * utils::floating_point_precision);
+                }
+            }
+            EXPECT_THROW(many_to_many.floyd_warshall(*graph_evn, 0), std::invalid_argument);
+        }
+    }
+
+} // namespace search
@@ -0,0 +1,148 @@
+/**
+ * @file mapped_graph_test.cpp
+ * @brief Unit tests for the memory mapped graph environment.
+ */
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <mapped_graph_test.h>
+
+namespace search
+{
+    namespace search_mapped_graph_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            MappedGraphTestSuite,
+            MappedGraphTest,
+            ::testing::Values(
+                MappedGraphTestParameters{
+                    utils::SearchAlgorithm::UCS, // Search algorithm to run on both graphs
+                    true,                        // Whether the file stores the edge costs
+                    107},                        // Index of the goal node (the start is node 0)
+                MappedGraphTestParameters{
+                    utils::SearchAlgorithm::UCS,
+                    false,
+                    50},
+                MappedGraphTestParameters{
+                    utils::SearchAlgorithm::A_STAR,
+                    true,
+                    107},
+                MappedGraphTestParameters{
+                    utils::SearchAlgorithm::A_STAR,
+                    false,
+                    107},
+                MappedGraphTestParameters{
+                    utils::SearchAlgorithm::BFS,
+                    true,
+                    70},
+                MappedGraphTestParameters{
+                    utils::SearchAlgorithm::DFS,
+                    true,
+                    33}));
+
+        TEST_P(MappedGraphTest, MatchesInMemoryGraph)
+        {
+            const MappedGraphTestParameters props = GetParam();
+            // Stored edge costs carry no metric, so the informed searches run without an estimate and may break ties differently
+            if (!props.write_edge_costs || props.search_algorithm != utils::SearchAlgorithm::A_STAR)
+            {
+                EXPECT_EQ(result, expected) << "The path on the mapped graph does not match the in memory graph";
+            }
+            EXPECT_NEAR(cost, expected_cost, utils::floating_point_precision)
+                << "The cost on the mapped graph does not match the in memory graph";
+            // Only the start, goal and path nodes are materialized - distance costs are evaluated on the mapped values
+            EXPECT_EQ(num_materialized, result.size());
+        }
+
+        TEST(MappedGraphFileTest, RejectsInvalidFiles)
+        {
+            using T = double;
+            constexpr unsigned int D = 1;
+            const std::string path = ::testing::TempDir() + "mapped_graph_test_invalid.graph";
+            // Not a graph file
+            {
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                file << "definitely not a graph file, but long enough to hold a header......................................................";
+            }
+            MappedGraph<T, D> mapped_graph_evn(path);
+            EXPECT_THROW(mapped_graph_evn.initialize(), std::invalid_argument);
+            // A graph file of another node value type
+            std::vector<std::unique_ptr<Node<int, D>>> nodes;
+            nodes.emplace_back(std::make_unique<Node<int, D>>(NodeValue<int, D>{math::ColumnVector<int, D>::Zero()}, "a"));
+            nodes.emplace_back(std::make_unique<Node<int, D>>(NodeValue<int, D>{math::ColumnVector<int, D>::Zero()}, "b"));
+            DistanceCost<int, D> cost_function = DistanceCost<int, D>();
+            Graph<int, D> graph_evn = Graph<int, D>(nodes, {{0, 1}}, cost_function);
+            graph_evn.initialize();
+            write_graph_file<int, D>(path, graph_evn);
+            EXPECT_THROW(mapped_graph_evn.initialize(), std::invalid_argument);
+            // The same file with the right node value type
+            MappedGraph<int, D> int_mapped_graph_evn(path);
+            int_mapped_graph_evn.initialize();
+            EXPECT_EQ(int_mapped_graph_evn.get_num_nodes(), 2);
+            EXPECT_EQ(int_mapped_graph_evn.get_num_edges(), 1);
+            EXPECT_EQ(int_mapped_graph_evn.get_node(1)->get_name(), "b");
+            std::remove(path.c_str());
+            // A missing file
+            EXPECT_THROW(mapped_graph_evn.initialize(), std::runtime_error);
+        }
+
+        TEST(MappedGraphFileTest, RejectsCorruptAdjacency)
+        {
+            using T = double;
+            constexpr unsigned int D = 1;
+            const std::string path = ::testing::TempDir() + "mapped_graph_test_corrupt.graph";
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            for (const std::string name : {"a", "b", "c"})
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << static_cast<T>(nodes.size());
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, name));
+            }
+            DistanceCost<T, D> cost_function = DistanceCost<T, D>();
+            Graph<T, D> graph_evn = Graph<T, D>(nodes, {{0, 1}, {1, 2}, {0, 2}}, cost_function);
+            graph_evn.initialize();
+            write_graph_file<T, D>(path, graph_evn);
+            std::string pristine;
+            {
+                std::ifstream file(path, std::ios::binary);
+                pristine.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            }
+            GraphFileHeader header;
+            std::memcpy(&header, pristine.data(), sizeof(GraphFileHeader));
+            // Rewrite the file with one value overwritten at `offset`
+            const auto corrupt = [&]<typename U>(const std::uint64_t offset, const U value)
+            {
+                std::string bytes = pristine;
+                std::memcpy(bytes.data() + offset, &value, sizeof(U));
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            };
+            MappedGraph<T, D> mapped_graph_evn(path);
+            mapped_graph_evn.initialize();
+            EXPECT_EQ(mapped_graph_evn.get_num_edges(), 3);
+            // Out edge offsets that decrease and run past the edges
+            corrupt(header.offsets_offset + sizeof(std::uint64_t), std::uint64_t{7});
+            EXPECT_THROW(mapped_graph_evn.initialize(), std::invalid_argument);
+            // An out edge target past the nodes
+            corrupt(header.targets_offset, std::uint32_t{3});
+            EXPECT_THROW(mapped_graph_evn.initialize(), std::invalid_argument);
+            // An in edge offset that decreases
+            corrupt(header.reverse_offsets_offset + sizeof(std::uint64_t), std::uint64_t{2});
+            EXPECT_THROW(mapped_graph_evn.initialize(), std::invalid_argument);
+            // An in edge target past the nodes
+            corrupt(header.reverse_targets_offset + sizeof(std::uint32_t), std::numeric_limits<std::uint32_t>::max());
+            EXPECT_THROW(mapped_graph_evn.initialize(), std::invalid_argument);
+            // Name offsets that decrease
+            corrupt(header.name_offsets_offset + sizeof(std::uint64_t), std::uint64_t{3});
+            EXPECT_THROW(mapped_graph_evn.initialize(), std::invalid_argument);
+            // Name offsets past the end of the file
+            corrupt(header.name_offsets_offset + 3 * sizeof(std::uint64_t), std::uint64_t{1} << 40);
+            EXPECT_THROW(mapped_graph_evn.initialize(), std::invalid_argument);
+            // The untouched file maps again
+            corrupt(0, header.magic);
+            mapped_graph_evn.initialize();
+            EXPECT_EQ(mapped_graph_evn.get_node(2)->get_name(), "c");
+            std::remove(path.c_str());
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file node_arena_test.cpp
+ * @brief Unit tests for the NodeArena and memory resource support.
+ */
+
+#include <gtest/gtest.h>
+#include <node_arena_test.h>
+
+namespace search
+{
+    namespace search_node_arena_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            NodeArenaTestSuite,
+            NodeArenaTest,
+            ::testing::Values(
+                NodeArenaTestParameters{
+                    4,                                // Number of nodes
+                    0,                                // Start node index
+                    3,                                // Goal node index
+                    {{0, 1}, {1, 2}, {2, 3}},         // Edges
+                    {"0", "1", "2", "3"}},            // Expected result
+                NodeArenaTestParameters{
+                    6,
+                    0,
+                    5,
+                    {{0, 1}, {0, 2}, {1, 3}, {2, 4}, {4, 5}, {3, 5}},
+                    {"0", "2", "4", "5"}},
+                NodeArenaTestParameters{
+                    3,
+                    0,
+                    2,
+                    {{0, 1}},
+                    {}}));
+
+        TEST_P(NodeArenaTest, SearchOutOfFixedBuffers)
+        {
+            NodeArenaTestParameters props = GetParam();
+            EXPECT_EQ(result, props.expected_result);
+            std::vector<std::size_t> expected_counts(props.num_nodes, 0);
+            for (const std::pair<std::size_t, std::size_t> &edge : props.edges)
+            {
+                ++expected_counts[edge.first];
+            }
+            EXPECT_EQ(neighbor_counts, expected_counts);
+        }
+
+        TEST(NodeArenaConnectTest, SizesNeighborListsOnce)
+        {
+            CountingResource upstream(std::pmr::get_default_resource());
+            NodeArena<int, 1> arena(1024, &upstream);
+            for (int i = 0; i < 100; ++i)
+            {
+                arena.create(NodeValue<int, 1>{math::ColumnVector<int, 1>::Constant(i)}, "", utils::NodeIdentity::DENSE);
+            }
+            std::vector<std::pair<std::size_t, std::size_t>> edges;
+            for (std::size_t i = 0; i < 100; ++i)
+            {
+                for (std::size_t j = 1; j <= i % 7; ++j)
+                {
+                    edges.emplace_back(i, (i + j) % 100);
+                }
+            }
+            arena.connect(edges);
+            for (std::size_t i = 0; i < 100; ++i)
+            {
+                EXPECT_EQ(arena[i]->get_neighbors().size(), i % 7);
+                EXPECT_EQ(arena[i]->get_neighbors().capacity(), i % 7);
+                for (std::size_t j = 0; j < arena[i]->get_neighbors().size(); ++j)
+                {
+                    EXPECT_EQ(arena[i]->get_neighbors()[j], arena[(i + j + 1) % 100]);
+                }
+            }
+            // Nodes and neighbor lists come from a few geometrically growing arena buffers
+            EXPECT_GT(upstream.num_allocations, 0);
+            EXPECT_LT(upstream.num_allocations, 10);
+            EXPECT_THROW(arena.connect({{0, 100}}), std::out_of_range);
+        }
+
+        TEST(NodeArenaDfsTest, NodeBasedSearchUsesWorkspaceResource)
+        {
+            NodeArena<int, 1> arena;
+            for (int i = 0; i < 5; ++i)
+            {
+                arena.create(NodeValue<int, 1>{math::ColumnVector<int, 1>::Constant(i)}, std::to_string(i));
+            }
+            arena.connect({{0, 1}, {1, 2}, {0, 3}, {3, 4}, {2, 4}});
+            NeighborListEnvironment<int, 1> env;
+            CountingResource resource(std::pmr::get_default_resource());
+            SearchWorkspace workspace(&resource);
+            const std::vector<std::pair<const Node<int, 1> *, double>> path = env.search(*arena[0], *arena[4], utils::SearchAlgorithm::DFS, workspace);
+            std::vector<std::string> names;
+            for (const std::pair<const Node<int, 1> *, double> &node : path)
+            {
+                names.push_back(node.first->get_name());
+            }
+            EXPECT_EQ(names, (std::vector<std::string>{"0", "3", "4"}));
+            EXPECT_DOUBLE_EQ(path.back().second, 2.0);
+            EXPECT_GT(resource.num_allocations, 0);
+        }
+    }
+}
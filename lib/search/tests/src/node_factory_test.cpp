@@ -0,0 +1,111 @@
+/**
+ * @file node_factory_test.cpp
+ * @brief Unit tests for the parallel node factory.
+ */
+
+#include <thread>
+#include <gtest/gtest.h>
+#include <node_factory_test.h>
+
+namespace search
+{
+    namespace search_node_factory_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            NodeFactoryTestSuite,
+            NodeFactoryTest,
+            ::testing::Values(
+                NodeFactoryTestParameters{
+                    10,                        // Number of nodes to make
+                    utils::NodeIdentity::UUID, // Identity policy of the nodes
+                    1},                        // Number of threads used to make the nodes
+                NodeFactoryTestParameters{
+                    20000,
+                    utils::NodeIdentity::UUID,
+                    4},
+                NodeFactoryTestParameters{
+                    50000,
+                    utils::NodeIdentity::DENSE,
+                    8},
+                NodeFactoryTestParameters{
+                    0,
+                    utils::NodeIdentity::DENSE,
+                    8}));
+
+        TEST_P(NodeFactoryTest, MakesDistinctNodesInOrder)
+        {
+            NodeFactoryTestParameters props = GetParam();
+            ASSERT_EQ(nodes.size(), props.count);
+            std::set<std::uint64_t> ids;
+            std::set<std::string> names;
+            for (std::size_t idx = 0; idx < nodes.size(); ++idx)
+            {
+                EXPECT_EQ(nodes[idx].get_node_value().value(0), static_cast<long>(idx));
+                EXPECT_EQ(nodes[idx].get_identity(), props.identity);
+                ids.insert(nodes[idx].get_id());
+                if (props.identity == utils::NodeIdentity::UUID)
+                {
+                    names.insert(nodes[idx].get_name());
+                }
+            }
+            EXPECT_EQ(ids.size(), props.count) << "Node ids must be unique";
+            if (props.identity == utils::NodeIdentity::UUID)
+            {
+                EXPECT_EQ(names.size(), props.count) << "Node UUIDs must be unique";
+            }
+            const std::vector<Node<long, 1> *> pointers = nodes.get_pointers();
+            ASSERT_EQ(pointers.size(), props.count);
+            for (std::size_t idx = 0; idx < pointers.size(); ++idx)
+            {
+                EXPECT_EQ(pointers[idx], &nodes[idx]);
+            }
+        }
+
+        TEST(NodeFactoryConcurrencyTest, ConstructNodesFromManyThreads)
+        {
+            using T = int;
+            constexpr unsigned int D = 1;
+            constexpr std::size_t num_threads = 8;
+            constexpr std::size_t count = 2000;
+            std::vector<std::vector<std::unique_ptr<Node<T, D>>>> nodes(num_threads);
+            {
+                std::vector<std::jthread> workers;
+                for (std::size_t thread = 0; thread < num_threads; ++thread)
+                {
+                    workers.emplace_back([&nodes, thread]()
+                                         {
+                        for (std::size_t idx = 0; idx < count; ++idx)
+                        {
+                            nodes[thread].emplace_back(std::make_unique<Node<T, D>>(NodeValue<T, D>()));
+                        } });
+                }
+            }
+            std::set<std::uint64_t> ids;
+            std::set<std::string> names;
+            for (const std::vector<std::unique_ptr<Node<T, D>>> &thread_nodes : nodes)
+            {
+                for (const std::unique_ptr<Node<T, D>> &node : thread_nodes)
+                {
+                    ids.insert(node->get_id());
+                    names.insert(node->get_name());
+                }
+            }
+            EXPECT_EQ(ids.size(), num_threads * count) << "Node ids must be unique across threads";
+            EXPECT_EQ(names.size(), num_threads * count) << "Node UUIDs must be unique across threads";
+        }
+
+        TEST(NodeFactoryErrorTest, FailedConstructionUnwinds)
+        {
+            using T = int;
+            constexpr unsigned int D = 1;
+            EXPECT_THROW((make_nodes<T, D>(100000, [](const std::size_t idx)
+                                           {
+                if (idx == 77777)
+                {
+                    throw std::runtime_error("value factory failed");
+                }
+                return NodeValue<T, D>(); }, utils::NodeIdentity::DENSE, 4)),
+                         std::runtime_error);
+        }
+    }
+}
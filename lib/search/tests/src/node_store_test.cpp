@@ -0,0 +1,108 @@
+/**
+ * @file node_store_test.cpp
+ * @brief Unit tests for the NodeStore.
+ */
+
+#include <gtest/gtest.h>
+#include <node_store_test.h>
+
+namespace search
+{
+    namespace search_node_store_tests
+    {
+        // More than the initial capacity so the store grows at least once
+        std::vector<std::array<int, 3>> make_node_values(const int count)
+        {
+            std::vector<std::array<int, 3>> node_values;
+            for (int i = 0; i < count; ++i)
+            {
+                node_values.push_back({i, -2 * i, i * i % 7});
+            }
+            return node_values;
+        }
+
+        INSTANTIATE_TEST_SUITE_P(
+            NodeStoreTestSuite,
+            NodeStoreTest,
+            ::testing::Values(
+                NodeStoreTestParameters{
+                    {{0, 0, 0}, {3, 4, 0}, {1, 2, 2}}, // Value of every node in the store
+                    {0, 0, 0},                         // Value to measure from
+                    utils::DistanceMetric::EUCLIDEAN}, // Distance metric
+                NodeStoreTestParameters{
+                    {{0, 0, 0}, {3, 4, 0}, {1, 2, 2}},
+                    {1, -1, 1},
+                    utils::DistanceMetric::MANHATTAN},
+                NodeStoreTestParameters{
+                    make_node_values(50),
+                    {5, 5, 5},
+                    utils::DistanceMetric::EUCLIDEAN},
+                NodeStoreTestParameters{
+                    make_node_values(50),
+                    {-3, 7, 0},
+                    utils::DistanceMetric::MANHATTAN}));
+
+        TEST_P(NodeStoreTest, KernelsMatchDistanceCost)
+        {
+            ASSERT_EQ(distances.size(), expected_distances.size());
+            for (std::size_t idx = 0; idx < expected_distances.size(); ++idx)
+            {
+                EXPECT_NEAR(distances[idx], expected_distances[idx], utils::floating_point_precision)
+                    << "One-to-many distance to node " << idx << " does not match DistanceCost";
+                EXPECT_NEAR(gathered_distances[idx], expected_distances[idx], utils::floating_point_precision)
+                    << "Gathered distance to node " << idx << " does not match DistanceCost";
+            }
+        }
+
+        TEST(NodeStoreHeuristicTest, BulkHeuristicsMatchHeuristic)
+        {
+            using T = double;
+            constexpr unsigned int D = 2;
+            std::vector<NodeValue<T, D>> values(10);
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                values[i].value << static_cast<T>(i), static_cast<T>(i % 3);
+            }
+            NodeStore<T, D> store(values);
+            ManhattanHeuristic<T, D> heuristic(0.5);
+            std::vector<double> heuristics(store.size());
+            heuristic.get_heuristics(store, values[4], heuristics);
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                EXPECT_NEAR(heuristics[i], heuristic.get_heuristic(values[i], values[4]), utils::floating_point_precision);
+            }
+            EXPECT_THROW(store.get_distances(values[0].value, utils::DistanceMetric::EUCLIDEAN, std::span<double>(heuristics).first(3)),
+                         std::invalid_argument);
+        }
+
+        TEST(NodeStoreEdgeCostTest, PrecomputedDistanceCostsMatchDistanceCost)
+        {
+            using T = int;
+            constexpr unsigned int D = 2;
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            std::vector<std::pair<std::size_t, std::size_t>> edges;
+            for (int i = 0; i < 12; ++i)
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << i * i - 7, 3 * (i % 4);
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(i)));
+                edges.emplace_back(i, (i * 5 + 1) % 12);
+                edges.emplace_back(i, (i * 7 + 3) % 12);
+            }
+            for (const utils::DistanceMetric distance_metric : {utils::DistanceMetric::EUCLIDEAN, utils::DistanceMetric::MANHATTAN})
+            {
+                // The precompute sweeps a NodeStore for a plain DistanceCost
+                DistanceCost<T, D> cost_function = DistanceCost<T, D>(distance_metric);
+                CsrGraph<T, D> graph_evn = CsrGraph<T, D>(nodes, edges, cost_function);
+                graph_evn.initialize(true);
+                ASSERT_TRUE(graph_evn.has_precomputed_edge_costs());
+                for (std::uint32_t id = 0; id < graph_evn.get_num_nodes(); ++id)
+                {
+                    graph_evn.for_each_edge(id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                            { EXPECT_NEAR(edge_cost, cost_function.get_cost(*nodes[id], *nodes[neighbor_id]), utils::floating_point_precision)
+                                                  << "Precomputed cost of the edge from " << id << " to " << neighbor_id << " does not match DistanceCost"; });
+                }
+            }
+        }
+    }
+}
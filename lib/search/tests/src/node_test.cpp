@@ -0,0 +1,79 @@
+/**
+ * @file node_test.cpp
+ * @brief Unit tests for the Node.
+ */
+
+#include <gtest/gtest.h>
+#include <node_test.h>
+
+namespace search
+{
+    namespace search_node_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            NodeTestSuite,
+            NodeTest,
+            ::testing::Values(
+                NodeTestParameters{
+                    utils::NodeIdentity::UUID, // Identity policy of the nodes
+                    ""},                       // Name given to the nodes
+                NodeTestParameters{
+                    utils::NodeIdentity::UUID,
+                    "node"},
+                NodeTestParameters{
+                    utils::NodeIdentity::DENSE,
+                    ""},
+                NodeTestParameters{
+                    utils::NodeIdentity::DENSE,
+                    "node"}));
+
+        TEST_P(NodeTest, EqualityFollowsIdentity)
+        {
+            EXPECT_NE(*first_node, *second_node) << "Distinct nodes must not compare equal";
+            EXPECT_EQ(*first_node, *copied_node) << "A copy of a node must compare equal to it";
+            EXPECT_NE(first_node->get_id(), second_node->get_id()) << "Distinct nodes must get distinct ids";
+            EXPECT_EQ(first_node->get_identity(), GetParam().identity);
+        }
+
+        TEST_P(NodeTest, NamesAreStable)
+        {
+            NodeTestParameters props = GetParam();
+            if (!props.name.empty())
+            {
+                EXPECT_EQ(first_node->get_name(), props.name);
+            }
+            else
+            {
+                EXPECT_FALSE(first_node->get_name().empty()) << "A default name must be generated";
+                EXPECT_NE(first_node->get_name(), second_node->get_name()) << "Default names must be unique";
+            }
+            // Repeated calls return the same string
+            EXPECT_EQ(&first_node->get_name(), &first_node->get_name());
+            EXPECT_EQ(first_node->get_name(), copied_node->get_name());
+        }
+
+        TEST(NodeDenseIdentityTest, GraphSearchWithDenseNodes)
+        {
+            using T = int;
+            constexpr unsigned int D = 1;
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                nodes.emplace_back(std::make_unique<Node<T, D>>(NodeValue<T, D>(), "", utils::NodeIdentity::DENSE));
+            }
+            DefaultCost<T, D> cost_function = DefaultCost<T, D>();
+            Graph<T, D> graph_evn = Graph<T, D>(nodes, {{0, 1}, {1, 2}, {2, 3}}, cost_function);
+            graph_evn.initialize();
+            for (utils::SearchAlgorithm search_algorithm : {utils::SearchAlgorithm::DFS, utils::SearchAlgorithm::BFS,
+                                                            utils::SearchAlgorithm::UCS})
+            {
+                std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn.search(*nodes[0], *nodes[3], search_algorithm);
+                ASSERT_EQ(path.size(), 4);
+                for (std::size_t i = 0; i < path.size(); ++i)
+                {
+                    EXPECT_EQ(*path[i].first, *nodes[i]);
+                }
+            }
+        }
+    }
+}
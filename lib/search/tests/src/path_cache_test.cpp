@@ -0,0 +1,106 @@
+/**
+ * @file path_cache_test.cpp
+ * @brief Unit tests for the PathCache.
+ */
+
+#include <thread>
+#include <gtest/gtest.h>
+#include <path_cache_test.h>
+
+namespace search
+{
+    namespace search_path_cache_tests
+    {
+        TEST_F(PathCacheTest, RepeatedQueriesHitTheCache)
+        {
+            PathCache<T, D, Graph<T, D>> path_cache(*graph_evn);
+            const std::vector<std::pair<const Node<T, D> *, double>> expected = graph_evn->search(at(0, 0), at(5, 3), utils::SearchAlgorithm::UCS);
+            EXPECT_EQ(path_cache.search(at(0, 0), at(5, 3), utils::SearchAlgorithm::UCS), expected);
+            EXPECT_EQ(path_cache.get_num_hits(), 0U);
+            EXPECT_EQ(path_cache.get_num_misses(), 1U);
+            EXPECT_EQ(path_cache.search(at(0, 0), at(5, 3), utils::SearchAlgorithm::UCS), expected);
+            EXPECT_EQ(path_cache.get_num_hits(), 1U);
+            // Another algorithm or another goal is another key
+            EXPECT_EQ(path_cache.search(at(0, 0), at(5, 3), utils::SearchAlgorithm::A_STAR).back().second, expected.back().second);
+            EXPECT_TRUE(path_cache.search(at(5, 3), at(0, 0), utils::SearchAlgorithm::UCS).empty());
+            EXPECT_TRUE(path_cache.search(at(5, 3), at(0, 0), utils::SearchAlgorithm::UCS).empty());
+            EXPECT_EQ(path_cache.get_num_hits(), 2U);
+            EXPECT_EQ(path_cache.get_num_misses(), 3U);
+            EXPECT_EQ(path_cache.size(), 3U);
+            EXPECT_GT(path_cache.get_memory_usage(), 0U);
+            path_cache.clear();
+            EXPECT_EQ(path_cache.size(), 0U);
+            EXPECT_EQ(path_cache.get_memory_usage(), 0U);
+            EXPECT_EQ(path_cache.get_num_hits(), 2U);
+        }
+
+        TEST_F(PathCacheTest, GraphChangesInvalidateTheCache)
+        {
+            PathCache<T, D, Graph<T, D>> path_cache(*graph_evn);
+            EXPECT_NEAR(path_cache.search(at(0, 0), at(2, 0), utils::SearchAlgorithm::UCS).back().second, 4.0, utils::floating_point_precision);
+            // Edge cost change - the goal is only reachable along the bottom row
+            graph_evn->update_edge_cost(0, 1, 10.0);
+            EXPECT_NEAR(path_cache.search(at(0, 0), at(2, 0), utils::SearchAlgorithm::UCS).back().second, 12.0, utils::floating_point_precision);
+            EXPECT_EQ(path_cache.get_num_hits(), 0U);
+            // Cost function change - drops the updated edge cost too
+            graph_evn->set_cost_function(default_cost);
+            EXPECT_EQ(&graph_evn->get_cost_function(), &default_cost);
+            EXPECT_NEAR(path_cache.search(at(0, 0), at(2, 0), utils::SearchAlgorithm::UCS).back().second, 2.0, utils::floating_point_precision);
+            // Edge removal
+            graph_evn->remove_edge(1, 2);
+            EXPECT_TRUE(path_cache.search(at(0, 0), at(2, 0), utils::SearchAlgorithm::UCS).empty());
+            EXPECT_EQ(path_cache.size(), 1U);
+            EXPECT_TRUE(path_cache.search(at(0, 0), at(2, 0), utils::SearchAlgorithm::UCS).empty());
+            EXPECT_EQ(path_cache.get_num_hits(), 1U);
+            EXPECT_EQ(path_cache.get_num_misses(), 4U);
+        }
+
+        TEST_F(PathCacheTest, LeastRecentlyUsedPathsAreEvicted)
+        {
+            // Measure one entry with an unbounded cache
+            PathCache<T, D, Graph<T, D>> probe(*graph_evn);
+            probe.search(at(0, 0), at(1, 0), utils::SearchAlgorithm::UCS);
+            const std::size_t entry_size = probe.get_memory_usage();
+            // Room for two single edge paths
+            PathCache<T, D, Graph<T, D>> path_cache(*graph_evn, 2 * entry_size);
+            path_cache.search(at(0, 0), at(1, 0), utils::SearchAlgorithm::UCS); // A
+            path_cache.search(at(1, 0), at(2, 0), utils::SearchAlgorithm::UCS); // B
+            path_cache.search(at(0, 0), at(1, 0), utils::SearchAlgorithm::UCS); // A again - B is now least recently used
+            path_cache.search(at(2, 0), at(3, 0), utils::SearchAlgorithm::UCS); // C evicts B
+            EXPECT_EQ(path_cache.size(), 2U);
+            EXPECT_LE(path_cache.get_memory_usage(), path_cache.get_memory_budget());
+            path_cache.search(at(0, 0), at(1, 0), utils::SearchAlgorithm::UCS); // A hit
+            path_cache.search(at(2, 0), at(3, 0), utils::SearchAlgorithm::UCS); // C hit
+            EXPECT_EQ(path_cache.get_num_hits(), 3U);
+            path_cache.search(at(1, 0), at(2, 0), utils::SearchAlgorithm::UCS); // B miss
+            EXPECT_EQ(path_cache.get_num_misses(), 4U);
+            // Paths larger than the budget are returned but not cached
+            const std::vector<std::pair<const Node<T, D> *, double>> long_path = path_cache.search(at(0, 0), at(7, 7), utils::SearchAlgorithm::UCS);
+            EXPECT_EQ(long_path.size(), 15U);
+            EXPECT_EQ(path_cache.size(), 2U);
+        }
+
+        TEST_F(PathCacheTest, ConcurrentQueries)
+        {
+            PathCache<T, D, Graph<T, D>> path_cache(*graph_evn);
+            std::vector<std::jthread> workers;
+            for (int worker = 0; worker < 4; ++worker)
+            {
+                workers.emplace_back([&]()
+                                     {
+                    SearchWorkspace workspace;
+                    for (int round = 0; round < 3; ++round)
+                    {
+                        for (int x = 0; x < size; ++x)
+                        {
+                            const std::vector<std::pair<const Node<T, D> *, double>> path = path_cache.search(at(0, 0), at(x, x), utils::SearchAlgorithm::A_STAR, workspace);
+                            EXPECT_NEAR(path.back().second, 3.0 * x, utils::floating_point_precision);
+                        }
+                    } });
+            }
+            workers.clear();
+            EXPECT_EQ(path_cache.get_num_hits() + path_cache.get_num_misses(), 4U * 3U * size);
+            EXPECT_EQ(path_cache.size(), static_cast<std::size_t>(size));
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/**
+ * @file shortest_path_tree_test.cpp
+ * @brief Unit tests for the one-to-many searches and the shortest path tree export.
+ */
+
+#include <gtest/gtest.h>
+#include <shortest_path_tree_test.h>
+
+namespace search
+{
+    namespace search_shortest_path_tree_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            ShortestPathTreeTestSuite,
+            ShortestPathTreeTest,
+            ::testing::Values(
+                ShortestPathTreeTestParameters{
+                    1,                                    // Number of nodes in the graph
+                    0,                                    // Number of random edges in the graph
+                    1,                                    // Number of random targets
+                    utils::PriorityQueueType::D_ARY_HEAP, // Priority queue used by the search
+                    1},                                   // Seed of the graph and target generator
+                ShortestPathTreeTestParameters{
+                    50,
+                    200,
+                    5,
+                    utils::PriorityQueueType::D_ARY_HEAP,
+                    7},
+                ShortestPathTreeTestParameters{
+                    50,
+                    200,
+                    5,
+                    utils::PriorityQueueType::RADIX_HEAP,
+                    7},
+                ShortestPathTreeTestParameters{
+                    800,
+                    1600,
+                    20,
+                    utils::PriorityQueueType::D_ARY_HEAP,
+                    3},
+                ShortestPathTreeTestParameters{
+                    800,
+                    4000,
+                    3,
+                    utils::PriorityQueueType::RADIX_HEAP,
+                    11}));
+
+        TEST_P(ShortestPathTreeTest, FullTreeMatchesSearch)
+        {
+            const UCS<T, D, Graph<T, D>> ucs(GetParam().queue_type);
+            const ShortestPathTree<T, D> tree = ucs.get_shortest_path_tree(*root_node, {}, *graph_evn);
+            const std::uint32_t root_id = graph_evn->get_node_id(*root_node);
+            ASSERT_EQ(tree.size(), graph_evn->get_num_nodes());
+            ASSERT_EQ(tree.get_distances().size(), tree.size());
+            ASSERT_EQ(tree.get_parents().size(), tree.size());
+            EXPECT_EQ(tree.get_root_id(), root_id);
+            EXPECT_EQ(tree.get_parent(root_id), root_id);
+            EXPECT_EQ(tree.get_distance(root_id), 0.0);
+            for (std::uint32_t id = 0; id < tree.size(); ++id)
+            {
+                const std::vector<std::pair<const Node<T, D> *, double>> expected = graph_evn->search(*root_node, *graph_evn->get_node(id), utils::SearchAlgorithm::UCS);
+                ASSERT_EQ(tree.contains(id), !expected.empty());
+                if (expected.empty())
+                {
+                    EXPECT_EQ(tree.get_distance(id), std::numeric_limits<double>::infinity());
+                    EXPECT_EQ(tree.get_parent(id), (ShortestPathTree<T, D>::no_parent));
+                    EXPECT_TRUE(tree.get_path(id, *graph_evn).empty());
+                    continue;
+                }
+                EXPECT_NEAR(tree.get_distance(id), expected.back().second, 1e3 * utils::floating_point_precision);
+                if (id != root_id)
+                {
+                    // Every tree edge is an edge of the graph on a cheapest path
+                    const std::uint32_t parent_id = tree.get_parent(id);
+                    ASSERT_TRUE(tree.contains(parent_id));
+                    EXPECT_NEAR(tree.get_distance(parent_id) + graph_evn->get_cost(*graph_evn->get_node(parent_id), *graph_evn->get_node(id)),
+                                tree.get_distance(id), utils::floating_point_precision);
+                }
+                const std::vector<std::pair<const Node<T, D> *, double>> path = tree.get_path(id, *graph_evn);
+                ASSERT_FALSE(path.empty());
+                EXPECT_EQ(path.front().first, root_node);
+                EXPECT_EQ(path.back().first, graph_evn->get_node(id));
+                EXPECT_EQ(path.back().second, tree.get_distance(id));
+            }
+        }
+
+        TEST_P(ShortestPathTreeTest, TargetsStopTheSearch)
+        {
+            const UCS<T, D, Graph<T, D>> ucs(GetParam().queue_type);
+            SearchWorkspace workspace;
+            const ShortestPathTree<T, D> full_tree = ucs.get_shortest_path_tree(*root_node, {}, *graph_evn, workspace);
+            const ShortestPathTree<T, D> tree = ucs.get_shortest_path_tree(*root_node, target_nodes, *graph_evn, workspace);
+            std::size_t num_nodes = 0;
+            std::size_t num_full_nodes = 0;
+            double max_target_distance = 0.0;
+            for (const Node<T, D> *target_node : target_nodes)
+            {
+                const std::uint32_t target_id = graph_evn->get_node_id(*target_node);
+                ASSERT_EQ(tree.contains(target_id), full_tree.contains(target_id));
+                if (full_tree.contains(target_id))
+                {
+                    EXPECT_EQ(tree.get_distance(target_id), full_tree.get_distance(target_id));
+                    max_target_distance = std::max(max_target_distance, tree.get_distance(target_id));
+                }
+            }
+            for (std::uint32_t id = 0; id < tree.size(); ++id)
+            {
+                num_nodes += tree.contains(id);
+                num_full_nodes += full_tree.contains(id);
+                if (tree.contains(id))
+                {
+                    // Only nodes no farther than the farthest target are settled
+                    EXPECT_EQ(tree.get_distance(id), full_tree.get_distance(id));
+                    EXPECT_LE(tree.get_distance(id), max_target_distance + utils::floating_point_precision);
+                }
+            }
+            EXPECT_LE(num_nodes, num_full_nodes);
+        }
+    }
+
+} // namespace search
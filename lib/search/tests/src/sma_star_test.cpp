@@ -0,0 +1,131 @@
+/**
+ * @file sma_star_test.cpp
+ * @brief Unit tests for the SMA* algorithm.
+ */
+
+#include <gtest/gtest.h>
+#include <sma_star_test.h>
+
+namespace search
+{
+    namespace search_sma_star_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            SmaStarTestSuite,
+            SmaStarTest,
+            ::testing::Values(
+                RandomGridTestParameters{
+                    3,     // Width of the grid
+                    2,     // Height of the grid
+                    true,  // Whether diagonal moves are allowed
+                    0.0,   // Fraction of randomly blocked cells
+                    1},    // Seed of the obstacle generator
+                RandomGridTestParameters{
+                    16,
+                    16,
+                    true,
+                    0.0,
+                    1},
+                RandomGridTestParameters{
+                    20,
+                    16,
+                    true,
+                    0.25,
+                    7},
+                RandomGridTestParameters{
+                    16,
+                    16,
+                    false,
+                    0.3,
+                    3},
+                RandomGridTestParameters{
+                    12,
+                    12,
+                    true,
+                    0.45,
+                    14}));
+
+        TEST_P(SmaStarTest, SearchMatchesUniformCostSearch)
+        {
+            const SmaStar<T, D, GridEnvironment<T, D>> sma_star;
+            const std::vector<std::pair<const Node<T, D> *, double>> path = sma_star.search(*start_node, *goal_node, *grid_evn);
+            ASSERT_EQ(path.empty(), ucs_path.empty());
+            // The environment dispatch runs the same search
+            EXPECT_EQ(grid_evn->search(*start_node, *goal_node, utils::SearchAlgorithm::SMA_STAR), path);
+            if (ucs_path.empty())
+            {
+                return;
+            }
+            EXPECT_TRUE(is_valid_path(path));
+            EXPECT_NEAR(path.back().second, ucs_path.back().second, utils::floating_point_precision);
+            // Everything fits, so nothing is forgotten or expanded again
+            EXPECT_EQ(sma_star.get_num_forgotten(), 0U);
+            EXPECT_EQ(sma_star.get_num_reexpansions(), 0U);
+        }
+
+        TEST_P(SmaStarTest, TightMemoryStaysOptimalWhileThePathFits)
+        {
+            // Every parameter set has a path of at least 3 nodes
+            ASSERT_GE(ucs_path.size(), 3U);
+            const std::size_t bytes_per_node = SmaStar<T, D, GridEnvironment<T, D>>().get_memory_limit() / SmaStar<T, D, GridEnvironment<T, D>>().get_max_nodes();
+            bool forgot = false;
+            for (const std::size_t max_nodes : {ucs_path.size() - 1, ucs_path.size(), ucs_path.size() + 2, 2 * ucs_path.size(), 4 * ucs_path.size()})
+            {
+                // No path fits below the size of the optimal one and SMA* would thrash - the expansion limit ends it
+                const std::size_t max_expansions = 100000;
+                const SmaStar<T, D, GridEnvironment<T, D>> sma_star(EuclideanHeuristic<T, D>(), bytes_per_node * max_nodes, max_expansions);
+                ASSERT_EQ(sma_star.get_max_nodes(), max_nodes);
+                const std::vector<std::pair<const Node<T, D> *, double>> path = sma_star.search(*start_node, *goal_node, *grid_evn);
+                EXPECT_LE(sma_star.get_num_expansions(), max_expansions);
+                if (max_nodes < ucs_path.size())
+                {
+                    EXPECT_TRUE(path.empty()) << "Max nodes: " << max_nodes;
+                    continue;
+                }
+                if (path.empty() && max_nodes < 2 * ucs_path.size())
+                {
+                    // Barely fitting paths may not be found before the expansion limit
+                    EXPECT_EQ(sma_star.get_num_expansions(), max_expansions) << "Max nodes: " << max_nodes;
+                    continue;
+                }
+                ASSERT_TRUE(is_valid_path(path)) << "Max nodes: " << max_nodes;
+                EXPECT_LE(path.size(), max_nodes);
+                if (path.size() == ucs_path.size())
+                {
+                    EXPECT_NEAR(path.back().second, ucs_path.back().second, utils::floating_point_precision) << "Max nodes: " << max_nodes;
+                }
+                EXPECT_GE(path.back().second + utils::floating_point_precision, ucs_path.back().second);
+                forgot = forgot || sma_star.get_num_forgotten() > 0;
+                EXPECT_LE(sma_star.get_num_reexpansions(), sma_star.get_num_expansions());
+            }
+            EXPECT_TRUE(forgot) << "No memory limit forced SMA* to forget nodes";
+            EXPECT_THROW((SmaStar<T, D, GridEnvironment<T, D>>(EuclideanHeuristic<T, D>(), bytes_per_node)), std::invalid_argument);
+        }
+
+        TEST(SmaStarEdgeCaseTest, TrivialAndUnreachableGoals)
+        {
+            using T = int;
+            constexpr unsigned int D = 2;
+            // A wall down the middle column cuts the corners apart
+            GridEnvironment<T, D> grid_evn(GridEnvironment<T, D>::Coordinates{3, 3}, false);
+            for (std::uint32_t y = 0; y < 3; ++y)
+            {
+                grid_evn.set_blocked({1, y}, true);
+            }
+            grid_evn.initialize();
+            NodeValue<T, D> start_value;
+            start_value.value << 0, 0;
+            NodeValue<T, D> goal_value;
+            goal_value.value << 2, 2;
+            const Node<T, D> start_node(start_value);
+            const Node<T, D> goal_node(goal_value);
+            const SmaStar<T, D, GridEnvironment<T, D>> sma_star;
+            EXPECT_TRUE(sma_star.search(start_node, goal_node, grid_evn).empty());
+            EXPECT_TRUE(grid_evn.search(start_node, goal_node, utils::SearchAlgorithm::SMA_STAR).empty());
+            const std::vector<std::pair<const Node<T, D> *, double>> path = sma_star.search(start_node, start_node, grid_evn);
+            ASSERT_EQ(path.size(), 1U);
+            EXPECT_EQ(path.front().first->get_node_value().value, start_value.value);
+            EXPECT_EQ(path.front().second, 0.0);
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file static_aggregate_cost_test.cpp
+ * @brief Unit tests for the StaticAggregateCost.
+ */
+
+#include <gtest/gtest.h>
+#include <static_aggregate_cost_test.h>
+
+namespace search
+{
+    namespace search_static_aggregate_cost_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            StaticAggregateCostTestSuite,
+            StaticAggregateCostTest,
+            ::testing::Values(
+                StaticAggregateCostTestParameters{
+                    {0.0, 0.0},       // Value of node A
+                    {3.0, 4.0},       // Value of node B
+                    {1.0, 1.0, 1.0}}, // Weights of the Euclidean, Manhattan and default costs
+                StaticAggregateCostTestParameters{
+                    {1.0, -2.0},
+                    {-3.5, 4.0},
+                    {0.5, 0.25, 2.0}},
+                StaticAggregateCostTestParameters{
+                    {1.0, 1.0},
+                    {1.0, 1.0},
+                    {1.0, 0.0, 0.0}}));
+
+        TEST_P(StaticAggregateCostTest, MatchesAggregateCost)
+        {
+            // Both aggregates must compute the same weighted sum
+            EXPECT_NEAR(static_cost, aggregate_cost, utils::floating_point_precision)
+                << "The StaticAggregateCost does not match the AggregateCost";
+        }
+
+        TEST(StaticAggregateCostWeightsTest, CompileTimeWeightsMatchAggregateCost)
+        {
+            using T = double;
+            constexpr unsigned int D = 2;
+            using CostFunction = StaticAggregateCost<T, D, StaticWeights<0.5, 0.25, 2.0>, DistanceCost<T, D>, DistanceCost<T, D>, DefaultCost<T, D>>;
+            static_assert(CostFunction::get_weights()[2] == 2.0, "The weights must be known at compile time");
+            NodeValue<T, D> from_value;
+            from_value.value << 1.0, -2.0;
+            NodeValue<T, D> to_value;
+            to_value.value << -3.5, 4.0;
+            Node<T, D> from_node = Node<T, D>(from_value, "A");
+            Node<T, D> to_node = Node<T, D>(to_value, "B");
+            DistanceCost<T, D> euclidean_cost = DistanceCost<T, D>(utils::DistanceMetric::EUCLIDEAN);
+            DistanceCost<T, D> manhattan_cost = DistanceCost<T, D>(utils::DistanceMetric::MANHATTAN);
+            DefaultCost<T, D> default_cost = DefaultCost<T, D>(2.0);
+            CostFunction cost_function = CostFunction(euclidean_cost, manhattan_cost, default_cost);
+            AggregateCost<T, D> reference_cost_function = AggregateCost<T, D>(
+                std::vector<double>{0.5, 0.25, 2.0}, euclidean_cost, manhattan_cost, default_cost);
+            EXPECT_NEAR(cost_function.get_cost(from_node, to_node), reference_cost_function.get_cost(from_node, to_node), utils::floating_point_precision)
+                << "The StaticAggregateCost with compile time weights does not match the AggregateCost";
+        }
+
+        TEST(StaticAggregateCostGraphTest, UsableAsGraphCost)
+        {
+            using T = double;
+            constexpr unsigned int D = 1;
+            static constexpr std::array<double, 2> weights = {1.0, 0.5};
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << static_cast<T>(i);
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(i)));
+            }
+            // Each edge costs its length plus half the default cost of 1
+            StaticAggregateCost<T, D, DistanceCost<T, D>, DefaultCost<T, D>> cost_function(
+                weights, DistanceCost<T, D>(utils::DistanceMetric::EUCLIDEAN), DefaultCost<T, D>());
+            Graph<T, D> graph_evn = Graph<T, D>(nodes, {{0, 1}, {1, 2}, {0, 2}}, cost_function);
+            graph_evn.initialize();
+            std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn.search(
+                *graph_evn.get_node(0), *graph_evn.get_node(2), utils::SearchAlgorithm::UCS);
+            ASSERT_EQ(path.size(), 2) << "UCS should take the direct edge";
+            EXPECT_NEAR(path.back().second, 2.5, utils::floating_point_precision)
+                << "The cost of the UCS path does not match the expected cost";
+        }
+    }
+}
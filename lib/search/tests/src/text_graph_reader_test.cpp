@@ -0,0 +1,104 @@
+/**
+ * @file text_graph_reader_test.cpp
+ * @brief Unit tests for the text graph readers.
+ */
+
+#include <gtest/gtest.h>
+#include <text_graph_reader_test.h>
+#include <search/cost/default_cost.h>
+#include <search/environment/graph.h>
+#include <search/environment/csr_graph.h>
+
+namespace search
+{
+    namespace search_text_graph_reader_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            TextGraphReaderTestSuite,
+            TextGraphReaderTest,
+            ::testing::Values(
+                TextGraphReaderTestParameters{
+                    10,   // Number of nodes in the graph
+                    30,   // Number of random edges in the graph
+                    1,    // Number of threads used to read the files
+                    ","}, // Field separator
+                TextGraphReaderTestParameters{
+                    500,
+                    20000,
+                    4,
+                    ","},
+                TextGraphReaderTestParameters{
+                    1000,
+                    5000,
+                    7,
+                    "\t"},
+                TextGraphReaderTestParameters{
+                    3,
+                    2,
+                    16,
+                    " "}));
+
+        TEST_P(TextGraphReaderTest, ReadsEdgesAndNodeValues)
+        {
+            EXPECT_EQ(read_num_nodes, GetParam().num_nodes);
+            EXPECT_EQ(read_edges, edges) << "The edges read back do not match the edges written";
+            ASSERT_EQ(read_node_values_.size(), node_values.size());
+            for (std::size_t idx = 0; idx < node_values.size(); ++idx)
+            {
+                EXPECT_EQ(read_node_values_[idx].value, node_values[idx].value) << "Node value " << idx << " does not match";
+            }
+        }
+
+        TEST(TextGraphReaderErrorTest, RejectsBadFiles)
+        {
+            const std::string path = ::testing::TempDir() + "text_graph_reader_test_bad.csv";
+            {
+                std::ofstream file(path);
+                file << "0,1\n1,two\n";
+            }
+            EXPECT_THROW(read_edge_list(path), std::invalid_argument);
+            {
+                std::ofstream file(path);
+                file << "0,1\n1,5\n";
+            }
+            EXPECT_THROW(read_edge_list(path, 3), std::out_of_range);
+            EXPECT_EQ(read_edge_list(path).get_num_nodes(), 6);
+            EXPECT_THROW((read_node_values<int, 3>(path)), std::invalid_argument);
+            std::remove(path.c_str());
+        }
+
+        TEST(TextGraphReaderCsrGraphTest, PrebuiltAdjacencyMatchesGraph)
+        {
+            using T = int;
+            constexpr unsigned int D = 1;
+            const std::string path = ::testing::TempDir() + "text_graph_reader_test_csr_graph.csv";
+            const std::vector<std::pair<std::size_t, std::size_t>> edges = {{0, 1}, {0, 2}, {1, 3}, {2, 3}, {3, 4}, {2, 4}};
+            {
+                std::ofstream file(path);
+                for (const std::pair<std::size_t, std::size_t> &edge : edges)
+                {
+                    file << edge.first << " " << edge.second << "\n";
+                }
+            }
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            for (std::size_t i = 0; i < 5; ++i)
+            {
+                nodes.emplace_back(std::make_unique<Node<T, D>>(NodeValue<T, D>(), std::to_string(i)));
+            }
+            DefaultCost<T, D> cost_function = DefaultCost<T, D>();
+            Graph<T, D> graph_evn = Graph<T, D>(nodes, edges, cost_function);
+            graph_evn.initialize();
+            CsrGraph<T, D> csr_graph_evn = CsrGraph<T, D>(nodes, read_edge_list(path, nodes.size()), cost_function);
+            csr_graph_evn.initialize(true);
+            csr_graph_evn.initialize(); // Re-initializing keeps the adjacency
+            EXPECT_EQ(csr_graph_evn.get_num_edges(), edges.size());
+            for (utils::SearchAlgorithm search_algorithm : {utils::SearchAlgorithm::DFS, utils::SearchAlgorithm::BFS, utils::SearchAlgorithm::UCS})
+            {
+                EXPECT_EQ(csr_graph_evn.search(*nodes[0], *nodes[4], search_algorithm),
+                          graph_evn.search(*nodes[0], *nodes[4], search_algorithm));
+            }
+            EXPECT_THROW((CsrGraph<T, D>(nodes, read_edge_list(path, 7), cost_function)), std::invalid_argument);
+            std::remove(path.c_str());
+        }
+    }
+}
@@ -0,0 +1,180 @@
+/**
+ * @file ucs_test.cpp
+ * @brief Unit tests for the Uniform Cost Search (UCS) algorithm.
+ */
+
+#include <gtest/gtest.h>
+#include <ucs_test.h>
+
+namespace search
+{
+    namespace search_ucs_tests
+    {
+        INSTANTIATE_TEST_SUITE_P(
+            UcsTestSuite,
+            UcsTest,
+            ::testing::Values(
+                UcsTestParameters{
+                    {0.0, 1.0, 2.0, 3.0},                     // 1D coordinate of every node in the graph
+                    0,                                        // Index of the start node
+                    3,                                        // Index of the goal node
+                    {{0, 1}, {1, 2}, {2, 3}},                 // List of edges in the graph
+                    utils::PriorityQueueType::D_ARY_HEAP,     // Priority queue used by the search
+                    {"0", "1", "2", "3"},                     // Expected result of the UCS search
+                    3.0},                                     // Expected cost of the path
+                UcsTestParameters{
+                    {0.0, 10.0, 1.0, 2.0, 3.0},
+                    0,
+                    4,
+                    {{0, 1}, {1, 4}, {0, 2}, {2, 3}, {3, 4}},
+                    utils::PriorityQueueType::D_ARY_HEAP,
+                    {"0", "2", "3", "4"},
+                    3.0},
+                UcsTestParameters{
+                    {0.0, 10.0, 1.0, 2.0, 3.0},
+                    0,
+                    4,
+                    {{0, 1}, {1, 4}, {0, 2}, {2, 3}, {3, 4}},
+                    utils::PriorityQueueType::RADIX_HEAP,
+                    {"0", "2", "3", "4"},
+                    3.0},
+                UcsTestParameters{
+                    {0.0, 5.0, 1.0, 4.0},
+                    0,
+                    3,
+                    {{0, 1}, {1, 3}, {0, 2}, {2, 3}},
+                    utils::PriorityQueueType::RADIX_HEAP,
+                    {"0", "2", "3"},
+                    4.0},
+                UcsTestParameters{
+                    {0.0, 1.0, 2.0},
+                    2,
+                    0,
+                    {{0, 1}, {1, 2}},
+                    utils::PriorityQueueType::D_ARY_HEAP,
+                    {},
+                    0.0}
+                ));
+
+        TEST_P(UcsTest, SearchPathExists)
+        {
+            // Get the parameters for the test
+            UcsTestParameters props = GetParam();
+            // Check if the result contains the expected path
+            EXPECT_EQ(result, props.expected_result)
+                << "The path for UCS search does not match the expected result";
+            EXPECT_NEAR(cost, props.expected_cost, utils::floating_point_precision)
+                << "The cost of the UCS path does not match the expected cost";
+        }
+
+        TEST(UcsWorkspaceTest, ReusedWorkspaceMatchesFreshSearch)
+        {
+            using T = double;
+            constexpr unsigned int D = 1;
+            // A line of nodes 0 - 1 - ... - 9 with edges in both directions
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            std::vector<std::pair<std::size_t, std::size_t>> edges;
+            for (std::size_t i = 0; i < 10; ++i)
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << static_cast<T>(i * i);
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(i)));
+                if (i > 0)
+                {
+                    edges.emplace_back(i - 1, i);
+                    edges.emplace_back(i, i - 1);
+                }
+            }
+            DistanceCost<T, D> cost_function = DistanceCost<T, D>(utils::DistanceMetric::EUCLIDEAN);
+            Graph<T, D> graph_evn = Graph<T, D>(nodes, edges, cost_function);
+            graph_evn.initialize();
+            // Run every query twice through one workspace and compare with a fresh search
+            SearchWorkspace workspace;
+            for (int repeat = 0; repeat < 2; ++repeat)
+            {
+                for (std::size_t start = 0; start < 10; ++start)
+                {
+                    for (std::size_t goal = 0; goal < 10; ++goal)
+                    {
+                        const Node<T, D> &start_node = *graph_evn.get_node(start);
+                        const Node<T, D> &goal_node = *graph_evn.get_node(goal);
+                        EXPECT_EQ(graph_evn.search(start_node, goal_node, utils::SearchAlgorithm::UCS, workspace),
+                                  graph_evn.search(start_node, goal_node, utils::SearchAlgorithm::UCS))
+                            << "Reusing the workspace changed the UCS result from " << start << " to " << goal;
+                    }
+                }
+            }
+        }
+
+        TEST(UcsRadixHeapTest, CostsPastTheKeyRangeThrow)
+        {
+            using T = double;
+            constexpr unsigned int D = 1;
+            // 1e13 quantizes to 1e19, which fits the 64 bit keys, 2e13 does not
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << static_cast<T>(i) * 1e13;
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(i)));
+            }
+            const DistanceCost<T, D> cost_function(utils::DistanceMetric::EUCLIDEAN);
+            Graph<T, D> graph_evn(nodes, {{0, 1}, {1, 2}}, cost_function);
+            graph_evn.initialize();
+            const UCS<T, D, Graph<T, D>> radix_ucs(utils::PriorityQueueType::RADIX_HEAP);
+            const std::vector<std::pair<const Node<T, D> *, double>> path = radix_ucs.search(*nodes[0], *nodes[1], graph_evn);
+            ASSERT_EQ(path.size(), 2U);
+            EXPECT_EQ(path.back().second, 1e13);
+            EXPECT_THROW(radix_ucs.search(*nodes[0], *nodes[2], graph_evn), std::overflow_error);
+            // A coarser quantum or the d-ary heap reach the far node
+            EXPECT_EQ((UCS<T, D, Graph<T, D>>(utils::PriorityQueueType::RADIX_HEAP, 1.0).search(*nodes[0], *nodes[2], graph_evn).back().second), 2e13);
+            EXPECT_EQ((UCS<T, D, Graph<T, D>>().search(*nodes[0], *nodes[2], graph_evn).back().second), 2e13);
+        }
+
+        TEST(UcsPrecomputedCostTest, PrecomputedEdgeCostsMatchCostFunction)
+        {
+            using T = double;
+            constexpr unsigned int D = 1;
+            // A line of nodes 0 - 1 - ... - 9 with edges in both directions
+            std::vector<std::unique_ptr<Node<T, D>>> nodes;
+            std::vector<std::pair<std::size_t, std::size_t>> edges;
+            for (std::size_t i = 0; i < 10; ++i)
+            {
+                NodeValue<T, D> node_value;
+                node_value.value << static_cast<T>(i * i);
+                nodes.emplace_back(std::make_unique<Node<T, D>>(node_value, std::to_string(i)));
+                if (i > 0)
+                {
+                    edges.emplace_back(i - 1, i);
+                    edges.emplace_back(i, i - 1);
+                }
+            }
+            DistanceCost<T, D> cost_function = DistanceCost<T, D>(utils::DistanceMetric::EUCLIDEAN);
+            Graph<T, D> graph_evn = Graph<T, D>(nodes, edges, cost_function);
+            graph_evn.initialize();
+            Graph<T, D> precomputed_graph_evn = Graph<T, D>(nodes, edges, cost_function);
+            precomputed_graph_evn.initialize(true);
+            EXPECT_FALSE(graph_evn.has_precomputed_edge_costs());
+            EXPECT_TRUE(precomputed_graph_evn.has_precomputed_edge_costs());
+            // Every stored edge cost must match the cost function
+            for (std::uint32_t id = 0; id < precomputed_graph_evn.get_num_nodes(); ++id)
+            {
+                precomputed_graph_evn.for_each_edge(id, [&](const std::uint32_t neighbor_id, const double edge_cost)
+                                                    { EXPECT_DOUBLE_EQ(edge_cost, cost_function.get_cost(*nodes[id], *nodes[neighbor_id])); });
+            }
+            // Searches on both graphs must agree
+            for (std::size_t start = 0; start < 10; ++start)
+            {
+                for (std::size_t goal = 0; goal < 10; ++goal)
+                {
+                    const std::vector<std::pair<const Node<T, D> *, double>> path = graph_evn.search(
+                        *graph_evn.get_node(start), *graph_evn.get_node(goal), utils::SearchAlgorithm::UCS);
+                    const std::vector<std::pair<const Node<T, D> *, double>> precomputed_path = precomputed_graph_evn.search(
+                        *precomputed_graph_evn.get_node(start), *precomputed_graph_evn.get_node(goal), utils::SearchAlgorithm::UCS);
+                    EXPECT_EQ(path, precomputed_path)
+                        << "Precomputed edge costs changed the UCS result from " << start << " to " << goal;
+                }
+            }
+        }
+    }
+}
@@ -17,13 +17,39 @@ namespace utils
         MANHATTAN
     };
 
+    // Node identity policies
+    enum class NodeIdentity : uint8_t
+    {
+        UUID,
+        DENSE
+    };
+
     // Search Algorithms
     enum class SearchAlgorithm : uint8_t
     {
         DFS,
         BFS,
         UCS,
-        A_STAR
+        A_STAR,
+        JPS,
+        IDA_STAR,
+        SMA_STAR,
+        ARA_STAR
+    };
+
+    // Priority queues used by the best-first search algorithms
+    enum class PriorityQueueType : uint8_t
+    {
+        D_ARY_HEAP,
+        RADIX_HEAP
+    };
+
+    // Priorities of the tasks run by the search executor - higher priorities run first
+    enum class TaskPriority : uint8_t
+    {
+        HIGH,
+        NORMAL,
+        LOW
     };
 
     // Floating point precision